@@ -24,6 +24,7 @@
 
 #define OPENTXS_ARG_BACKUP_DIRECTORY "backupdirectory"
 #define OPENTXS_ARG_BINDIP "bindip"
+#define OPENTXS_ARG_BLOCKCHAIN_SHARDING "blockchainsharding"
 #define OPENTXS_ARG_BLOCKCHAIN_SYNC "blockchainsync"
 #define OPENTXS_ARG_BLOCK_STORAGE_LEVEL "blockstoragelevel"
 #define OPENTXS_ARG_COMMANDPORT "commandport"
@@ -39,6 +40,7 @@
 #define OPENTXS_ARG_LISTENNOTIFY "listennotify"
 #define OPENTXS_ARG_LOGENDPOINT "logendpoint"
 #define OPENTXS_ARG_LOGLEVEL "log_level"
+#define OPENTXS_ARG_METRICSENDPOINT "metricsendpoint"
 #define OPENTXS_ARG_NAME "name"
 #define OPENTXS_ARG_NOTIFICATIONPORT "notificationport"
 #define OPENTXS_ARG_ONION "onion"
@@ -48,8 +50,10 @@
 #define OPENTXS_ARG_RESET_HEADER_DB "resetheaderdb"
 #define OPENTXS_ARG_STORAGE_PLUGIN "storageplugin"
 #define OPENTXS_ARG_TERMS "terms"
+#define OPENTXS_ARG_TRACEFILE "tracefile"
 #define OPENTXS_ARG_VERSION "version"
 #define OPENTXS_ARG_WORDS "words"
+#define OPENTXS_ARG_ZMQ_REACTOR "zmqreactor"
 
 namespace opentxs
 {
@@ -37,6 +37,7 @@ class Manager;
 }  // namespace server
 
 class Crypto;
+class Metrics;
 class Primitives;
 class Settings;
 class ThreadPool;
@@ -82,6 +83,7 @@ public:
     virtual const api::Crypto& Crypto() const = 0;
     virtual const api::Primitives& Factory() const = 0;
     virtual void HandleSignals(ShutdownCallback* callback = nullptr) const = 0;
+    virtual const api::Metrics& Metrics() const noexcept = 0;
     virtual std::string ProfileId() const = 0;
     virtual std::unique_ptr<rpc::response::Base> RPC(
         const rpc::request::Base& command) const noexcept = 0;
@@ -0,0 +1,64 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_API_METRICS_HPP
+#define OPENTXS_API_METRICS_HPP
+
+#include "opentxs/Version.hpp"  // IWYU pragma: associated
+
+#include <chrono>
+#include <string>
+
+namespace opentxs
+{
+namespace api
+{
+/** Latency and throughput metrics collected by library subsystems
+ *
+ *  Every report contains one line per metric in the form
+ *  "<name> <counter|gauge|histogram> <values>". Histogram values are
+ *  reported in microseconds.
+ */
+class Metrics
+{
+public:
+    /** Reports are published as single frame messages on this endpoint
+     *
+     *  The endpoint is set by the metricsendpoint argument. An empty string
+     *  is returned if no endpoint was configured or binding to it failed.
+     */
+    OPENTXS_EXPORT virtual auto Endpoint() const noexcept -> std::string = 0;
+    /** Publish a report at the specified interval
+     *
+     *  Publishing is disabled by default. An interval of zero disables it.
+     *  Does nothing if Endpoint() is empty.
+     */
+    OPENTXS_EXPORT virtual auto Publish(
+        const std::chrono::milliseconds interval) const noexcept -> void = 0;
+    OPENTXS_EXPORT virtual auto Report() const noexcept -> std::string = 0;
+    /** Recent hot path spans in Chrome trace event format
+     *
+     *  The output can be loaded into chrome://tracing or Perfetto. Spans are
+     *  only recorded if the library was built with OT_TRACE enabled. The
+     *  same output is written to the file named by the tracefile argument
+     *  when the process receives SIGUSR1. Each span is reported once, and
+     *  the spans of a thread are discarded when the thread exits.
+     */
+    OPENTXS_EXPORT virtual auto Trace() const noexcept -> std::string = 0;
+
+    OPENTXS_EXPORT virtual ~Metrics() = default;
+
+protected:
+    Metrics() = default;
+
+private:
+    Metrics(const Metrics&) = delete;
+    Metrics(Metrics&&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+    Metrics& operator=(Metrics&&) = delete;
+};
+}  // namespace api
+}  // namespace opentxs
+#endif
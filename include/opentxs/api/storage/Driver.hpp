@@ -8,10 +8,19 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <functional>
 #include <future>
 #include <memory>
 #include <string>
 
+namespace opentxs
+{
+namespace storage
+{
+class ObjectCache;
+}  // namespace storage
+}  // namespace opentxs
+
 namespace opentxs
 {
 namespace api
@@ -21,7 +30,19 @@ namespace storage
 class Driver
 {
 public:
+    using KeyCallback = std::function<bool(const std::string&)>;
+
+    /** Cache of deserialized objects consulted by LoadProto, if any */
+    virtual const opentxs::storage::ObjectCache* Cache() const = 0;
+
+    virtual bool DeleteFromBucket(const std::string& key, const bool bucket)
+        const = 0;
     virtual bool EmptyBucket(const bool bucket) const = 0;
+    /** Enumerate every key in the specified bucket
+     *
+     *  Enumeration stops early if the callback returns false
+     */
+    virtual bool ListBucket(const bool bucket, const KeyCallback cb) const = 0;
 
     virtual bool Load(
         const std::string& key,
@@ -53,14 +74,31 @@ public:
     virtual std::string LoadRoot() const = 0;
     virtual bool StoreRoot(const bool commit, const std::string& hash)
         const = 0;
+    /** Record the keys of all objects written while tracking is enabled
+     *
+     *  DeleteFromBucket will refuse to remove any key written since tracking
+     *  was last enabled. Disabling tracking discards the recorded keys.
+     */
+    virtual void TrackWrites(const bool enabled) const = 0;
 
     virtual ~Driver() = default;
 
+    /** Load an object which the caller may modify
+     *
+     *  The caller receives a private copy, so objects held in the cache
+     *  are never modified.
+     */
     template <class T>
     bool LoadProto(
         const std::string& hash,
         std::shared_ptr<T>& serialized,
         const bool checking = false) const;
+    /** Load an immutable object, sharing the cached instance if present */
+    template <class T>
+    bool LoadProto(
+        const std::string& hash,
+        std::shared_ptr<const T>& serialized,
+        const bool checking = false) const;
 
     template <class T>
     bool StoreProto(const T& data, std::string& key, std::string& plaintext)
@@ -9,6 +9,8 @@
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "opentxs/api/storage/Driver.hpp"
 
@@ -21,8 +23,16 @@ namespace storage
 class Plugin : public virtual Driver
 {
 public:
+    /// key, value
+    using Batch = std::vector<std::pair<std::string, std::string>>;
+
     virtual bool EmptyBucket(const bool bucket) const override = 0;
     virtual std::string LoadRoot() const override = 0;
+    /** Write a group of objects using a single commit or sync operation */
+    virtual bool StoreBatch(
+        const bool isTransaction,
+        const Batch& items,
+        const bool bucket) const = 0;
     virtual bool StoreRoot(const bool commit, const std::string& hash)
         const override = 0;
 
@@ -16,6 +16,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "opentxs/Types.hpp"
 #include "opentxs/core/Identifier.hpp"
@@ -300,6 +301,16 @@ public:
     virtual void CalculateContractID(Identifier& newID) const;
     virtual void CalculateAndSetContractID(Identifier& newID);
 
+    /** Same result as calling VerifySignature(theNym) on every contract
+     *
+     *  Contracts with a single signature which matches a single key of the
+     *  nym are passed to the key's provider as one batch. The others, and the
+     *  members of any batch which fails, are verified individually.
+     */
+    static bool VerifySignatures(
+        const std::vector<const Contract*>& contracts,
+        const identity::Nym& theNym);
+
     /** So far not overridden anywhere (used to be OTTrade.) */
     virtual bool VerifySignature(const identity::Nym& theNym) const;
     virtual bool VerifySigAuthent(const identity::Nym& theNym) const;
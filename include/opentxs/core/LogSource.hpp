@@ -20,6 +20,7 @@
 
 #include "opentxs/Types.hpp"
 #include "opentxs/core/Armored.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/StringXML.hpp"
@@ -28,6 +29,17 @@
 #include "opentxs/core/identifier/UnitDefinition.hpp"
 #include "opentxs/network/zeromq/socket/Push.hpp"
 
+namespace opentxs
+{
+namespace network
+{
+namespace zeromq
+{
+class Frame;
+}  // namespace zeromq
+}  // namespace network
+}  // namespace opentxs
+
 namespace opentxs
 {
 class OPENTXS_EXPORT LogSource
@@ -49,6 +61,11 @@ public:
     const LogSource& operator()(const String& in) const noexcept;
     const LogSource& operator()(const StringXML& in) const noexcept;
     const LogSource& operator()(const Armored& in) const noexcept;
+    /// Binary arguments are hex encoded only if the message will be logged
+    const LogSource& operator()(const OTData& in) const noexcept;
+    const LogSource& operator()(const Data& in) const noexcept;
+    const LogSource& operator()(
+        const network::zeromq::Frame& in) const noexcept;
     const LogSource& operator()(const OTIdentifier& in) const noexcept;
     const LogSource& operator()(const Identifier& in) const noexcept;
     const LogSource& operator()(const OTNymID& in) const noexcept;
@@ -78,16 +95,16 @@ public:
     ~LogSource() = default;
 
 private:
-    using Source = std::pair<OTZMQPushSocket, std::stringstream>;
-
     static std::atomic<int> verbosity_;
     static std::atomic<bool> running_;
-    static std::mutex buffer_lock_;
-    static std::map<std::thread::id, Source> buffer_;
 
     const int level_{-1};
 
-    static Source& get_buffer(std::string& id) noexcept;
+    static void append(
+        std::string& buffer,
+        const char* file,
+        const std::size_t line,
+        const char* message) noexcept;
 
     void send(const bool terminate) const noexcept;
 
@@ -9,6 +9,7 @@
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
 #include <optional>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/core/Secret.hpp"
@@ -42,6 +43,14 @@ namespace crypto
 class OPENTXS_EXPORT AsymmetricProvider
 {
 public:
+    /// One signature to be checked by VerifyBatch
+    struct BatchItem {
+        const Data& plaintext_;
+        const key::Asymmetric& key_;
+        const Data& signature_;
+        const crypto::HashType hash_;
+    };
+
     static crypto::key::asymmetric::Algorithm CurveToKeyType(
         const EcdsaCurve& curve);
     static EcdsaCurve KeyTypeToCurve(
@@ -83,6 +92,13 @@ public:
         const key::Asymmetric& theKey,
         const Data& signature,
         const crypto::HashType hashType) const = 0;
+    /** Check many signatures at once
+     *
+     *  Returns true only if every signature is valid. The default
+     *  implementation calls Verify for each item on the shared thread pool,
+     *  so providers only override it to use a native batch algorithm.
+     */
+    virtual bool VerifyBatch(const std::vector<BatchItem>& items) const;
     virtual bool VerifyContractSignature(
         const String& strContractToVerify,
         const key::Asymmetric& theKey,
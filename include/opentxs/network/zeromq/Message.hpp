@@ -8,6 +8,8 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <memory>
+
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
@@ -104,6 +106,12 @@ public:
     }
     virtual auto AddFrame(const void* input, const std::size_t size)
         -> Frame& = 0;
+    /// Shares the contents of an existing frame without copying
+    virtual auto AddFrame(const Frame& input) -> Frame& = 0;
+    /// Takes ownership of the buffer without copying
+    virtual auto AddFrame(Space&& input) -> Frame& = 0;
+    /// Holds a reference to the buffer without copying
+    virtual auto AddFrame(std::shared_ptr<const Space> input) -> Frame& = 0;
 #endif
     virtual AllocateOutput AppendBytes() noexcept = 0;
     virtual Frame& at(const std::size_t index) = 0;
@@ -17,6 +17,7 @@
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/HDSeed.hpp"
+#include "opentxs/api/Metrics.hpp"
 #include "opentxs/api/Periodic.hpp"
 #include "opentxs/api/Settings.hpp"
 #include "opentxs/api/ThreadPool.hpp"
@@ -96,6 +96,7 @@ private:
     static bool handle_30() { return ignore(); }
     /** SIGSYS, SIGUNUSED */
     static bool handle_31() { return shutdown(); }
+    static bool dump_trace();
     static bool ignore() { return false; }
     static bool shutdown();
 
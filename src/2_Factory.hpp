@@ -333,6 +333,7 @@ class Mailbox;
 class Notary;
 class Nym;
 class Nyms;
+class ObjectCache;
 class PaymentWorkflows;
 class PeerReplies;
 class PeerRequests;
@@ -793,6 +794,7 @@ public:
         const Flag& bucket) -> opentxs::api::storage::Plugin*;
     static auto StorageMultiplex(
         const api::storage::Storage& storage,
+        const storage::ObjectCache& cache,
         const Flag& primaryBucket,
         const StorageConfig& config,
         const String& primary,
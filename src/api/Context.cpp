@@ -91,10 +91,14 @@ Context::Context(
     , task_list_lock_()
     , signal_handler_lock_()
     , config_()
-    , zmq_context_(opentxs::factory::ZMQContext())
+    , zmq_context_(opentxs::factory::ZMQContext(reactor_threads(args)))
     , signal_handler_(nullptr)
     , log_(factory::Log(zmq_context_, get_arg(args, OPENTXS_ARG_LOGENDPOINT)))
     , asio_()
+    , metrics_(factory::Metrics(
+          zmq_context_,
+          get_arg(args, OPENTXS_ARG_METRICSENDPOINT),
+          get_arg(args, OPENTXS_ARG_TRACEFILE)))
     , thread_pool_()
     , crypto_(nullptr)
     , factory_(nullptr)
@@ -187,6 +191,15 @@ auto Context::get_arg(const ArgList& args, const std::string& argName)
     return {};
 }
 
+auto Context::reactor_threads(const ArgList& args) -> std::size_t
+{
+    try {
+        return std::stoul(get_arg(args, OPENTXS_ARG_ZMQ_REACTOR));
+    } catch (...) {
+        return 0;
+    }
+}
+
 auto Context::GetPasswordCaller() const -> OTCaller&
 {
     OT_ASSERT(nullptr != external_password_callback_)
@@ -592,6 +605,8 @@ Context::~Context()
     server_.clear();
     thread_pool_->Shutdown();
     thread_pool_.reset();
+    metrics_->Shutdown();
+    metrics_.reset();
     asio_->Shutdown();
     asio_.reset();
     LogSource::Shutdown();
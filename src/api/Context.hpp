@@ -26,6 +26,7 @@
 #include "opentxs/Version.hpp"
 #include "opentxs/api/Context.hpp"
 #include "opentxs/api/Legacy.hpp"
+#include "opentxs/api/Metrics.hpp"
 #include "opentxs/api/Primitives.hpp"
 #include "opentxs/api/Settings.hpp"
 #include "opentxs/api/ThreadPool.hpp"
@@ -88,6 +89,10 @@ public:
     {
         return *legacy_;
     }
+    auto Metrics() const noexcept -> const api::Metrics& final
+    {
+        return *metrics_;
+    }
     auto ProfileId() const -> std::string final;
     auto RPC(const rpc::request::Base& command) const noexcept
         -> std::unique_ptr<rpc::response::Base> final;
@@ -138,6 +143,7 @@ private:
     mutable std::unique_ptr<Signals> signal_handler_;
     std::unique_ptr<api::internal::Log> log_;
     std::unique_ptr<network::Asio> asio_;
+    std::unique_ptr<api::internal::Metrics> metrics_;
     std::unique_ptr<api::internal::ThreadPool> thread_pool_;
     std::unique_ptr<api::internal::Crypto> crypto_;
     std::unique_ptr<api::Primitives> factory_;
@@ -159,6 +165,7 @@ private:
     static auto server_instance(const int count) -> int;
     static auto get_arg(const ArgList& args, const std::string& argName)
         -> std::string;
+    static auto reactor_threads(const ArgList& args) -> std::size_t;
 
     void init_pid() const;
     auto merge_arglist(const ArgList& args) const -> const ArgList;
@@ -13,6 +13,7 @@ extern "C" {
 }
 #endif
 
+#include <cstddef>
 #include <cstdlib>
 #include <functional>
 #include <future>
@@ -67,30 +68,40 @@ Log::Log(const zmq::Context& zmq, const std::string& endpoint)
 
 void Log::callback(zmq::Message& message)
 {
-    if (message.Body().size() < 3) { return; }
+    // Each batch contains one or more groups of level, text, thread id, and
+    // completion promise frames
+    static constexpr auto group = std::size_t{4};
+    const auto body = message.Body();
 
-    const auto& levelFrame = message.Body_at(0);
-    const auto& messageFrame = message.Body_at(1);
-    const auto& id = message.Body_at(2);
+    for (auto i = std::size_t{0}; (i + group) <= body.size(); i += group) {
+        const auto& levelFrame = message.Body_at(i);
+        const auto& messageFrame = message.Body_at(i + 1);
+        const auto& id = message.Body_at(i + 2);
+        const auto& promiseFrame = message.Body_at(i + 3);
 
-    try {
-        const auto level = levelFrame.as<int>();
+        try {
+            const auto level = levelFrame.as<int>();
 
 #ifdef ANDROID
-        print_android(level, messageFrame, id);
+            print_android(level, messageFrame, id);
 #else
-        print(level, messageFrame, id);
+            print(level, messageFrame, id);
 #endif
-    } catch (...) {
-        std::cout << "Invalid level size: " << levelFrame.size() << '\n';
+        } catch (...) {
+            std::cout << "Invalid level size: " << levelFrame.size() << '\n';
 
-        OT_FAIL;
-    }
+            OT_FAIL;
+        }
 
-    if (publish_) { publish_socket_->Send(message); }
+        if (publish_) {
+            auto out = zmq::Message::Factory();
+            out->PrependEmptyFrame();
+            out->AddFrame(levelFrame);
+            out->AddFrame(messageFrame);
+            out->AddFrame(id);
+            publish_socket_->Send(out);
+        }
 
-    if (message.Body().size() >= 4) {
-        const auto& promiseFrame = message.Body_at(3);
         auto* pPromise = promiseFrame.as<std::promise<void>*>();
 
         if (nullptr != pPromise) { pPromise->set_value(); }
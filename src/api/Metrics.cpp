@@ -0,0 +1,129 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"     // IWYU pragma: associated
+#include "1_Internal.hpp"   // IWYU pragma: associated
+#include "api/Metrics.hpp"  // IWYU pragma: associated
+
+#include <memory>
+
+#include "internal/api/Factory.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "util/Metrics.hpp"
+#include "util/Trace.hpp"
+
+namespace opentxs::factory
+{
+auto Metrics(
+    const network::zeromq::Context& zmq,
+    const std::string& endpoint,
+    const std::string& traceFile) noexcept
+    -> std::unique_ptr<api::internal::Metrics>
+{
+    using ReturnType = api::implementation::Metrics;
+
+    return std::make_unique<ReturnType>(zmq, endpoint, traceFile);
+}
+}  // namespace opentxs::factory
+
+#define OT_METHOD "opentxs::api::implementation::Metrics::"
+
+namespace opentxs::api::implementation
+{
+Metrics::Metrics(
+    const opentxs::network::zeromq::Context& zmq,
+    const std::string& endpoint,
+    const std::string& traceFile) noexcept
+    : socket_(zmq.PublishSocket())
+    , endpoint_(bind(socket_.get(), endpoint))
+    , lock_()
+    , cv_()
+    , interval_(0)
+    , running_(true)
+    , publisher_()
+{
+    if (false == traceFile.empty()) { trace::SetFile(traceFile); }
+}
+
+auto Metrics::bind(
+    const opentxs::network::zeromq::socket::Publish& socket,
+    const std::string& endpoint) noexcept -> std::string
+{
+    if (endpoint.empty()) { return {}; }
+
+    if (socket.Start(endpoint)) { return endpoint; }
+
+    LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to bind to ")(endpoint)(
+        ". Metrics will not be published.")
+        .Flush();
+
+    return {};
+}
+
+auto Metrics::Publish(const std::chrono::milliseconds interval) const noexcept
+    -> void
+{
+    {
+        auto lock = Lock{lock_};
+
+        if ((false == running_) || endpoint_.empty()) { return; }
+
+        interval_ = interval;
+
+        if ((0 < interval_.count()) && (false == publisher_.joinable())) {
+            publisher_ = std::thread{&Metrics::publish, this};
+        }
+    }
+
+    cv_.notify_all();
+}
+
+auto Metrics::publish() const noexcept -> void
+{
+    auto lock = Lock{lock_};
+
+    while (running_) {
+        if (0 < interval_.count()) {
+            cv_.wait_for(lock, interval_);
+        } else {
+            cv_.wait(lock);
+        }
+
+        if ((false == running_) || (0 == interval_.count())) { continue; }
+
+        lock.unlock();
+        auto message = opentxs::network::zeromq::Message::Factory();
+        message->AddFrame(Report());
+        socket_->Send(message);
+        lock.lock();
+    }
+}
+
+auto Metrics::Report() const noexcept -> std::string
+{
+    return metrics::Registry::Get().Report();
+}
+
+auto Metrics::Trace() const noexcept -> std::string { return trace::Output(); }
+
+auto Metrics::Shutdown() noexcept -> void
+{
+    {
+        auto lock = Lock{lock_};
+        running_ = false;
+    }
+
+    cv_.notify_all();
+
+    if (publisher_.joinable()) { publisher_.join(); }
+}
+
+Metrics::~Metrics() { Shutdown(); }
+}  // namespace opentxs::api::implementation
@@ -0,0 +1,70 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "internal/api/Api.hpp"
+#include "opentxs/network/zeromq/socket/Publish.hpp"
+
+namespace opentxs
+{
+namespace network
+{
+namespace zeromq
+{
+class Context;
+}  // namespace zeromq
+}  // namespace network
+}  // namespace opentxs
+
+namespace opentxs::api::implementation
+{
+class Metrics final : virtual public api::internal::Metrics
+{
+public:
+    auto Endpoint() const noexcept -> std::string final { return endpoint_; }
+    auto Publish(const std::chrono::milliseconds interval) const noexcept
+        -> void final;
+    auto Report() const noexcept -> std::string final;
+    auto Trace() const noexcept -> std::string final;
+
+    auto Shutdown() noexcept -> void final;
+
+    Metrics(
+        const opentxs::network::zeromq::Context& zmq,
+        const std::string& endpoint,
+        const std::string& traceFile) noexcept;
+
+    ~Metrics() final;
+
+private:
+    OTZMQPublishSocket socket_;
+    // Empty if publishing is not available
+    const std::string endpoint_;
+    mutable std::mutex lock_;
+    mutable std::condition_variable cv_;
+    mutable std::chrono::milliseconds interval_;
+    mutable bool running_;
+    mutable std::thread publisher_;
+
+    static auto bind(
+        const opentxs::network::zeromq::socket::Publish& socket,
+        const std::string& endpoint) noexcept -> std::string;
+
+    auto publish() const noexcept -> void;
+
+    Metrics() = delete;
+    Metrics(const Metrics&) = delete;
+    Metrics(Metrics&&) = delete;
+    auto operator=(const Metrics&) -> Metrics& = delete;
+    auto operator=(Metrics&&) -> Metrics& = delete;
+};
+}  // namespace opentxs::api::implementation
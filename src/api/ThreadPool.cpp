@@ -7,9 +7,13 @@
 #include "1_Internal.hpp"      // IWYU pragma: associated
 #include "api/ThreadPool.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <stdexcept>
 #include <thread>
 #include <utility>
@@ -20,6 +24,7 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
@@ -54,44 +59,67 @@ auto ThreadPool::MakeWork(const zmq::Context& zmq, WorkType type) noexcept
 }
 }  // namespace opentxs::api
 
+namespace opentxs::api::internal
+{
+auto ThreadPool::Get(const api::Context& api) noexcept -> const ThreadPool&
+{
+    return dynamic_cast<const ThreadPool&>(api.ThreadPool());
+}
+
+auto ThreadPool::Get(const api::Core& api) noexcept -> const ThreadPool&
+{
+    return dynamic_cast<const ThreadPool&>(api.ThreadPool());
+}
+}  // namespace opentxs::api::internal
+
 namespace opentxs::api::implementation
 {
+namespace
+{
 constexpr auto endpoint_{"inproc://opentxs//thread_pool/1"};
-constexpr auto internal_endpoint_{"inproc://opentxs//thread_pool/internal"};
 using Direction = zmq::socket::Socket::Direction;
 
+// Identifies the pool and queue owned by the calling thread, if any, and the
+// priority of the job it is running
+thread_local const ThreadPool* local_pool_{nullptr};
+thread_local std::size_t local_queue_{0};
+thread_local ThreadPool::Priority local_priority_{ThreadPool::Priority::UI};
+}  // namespace
+
 ThreadPool::ThreadPool(const zmq::Context& zmq) noexcept
     : zmq_(zmq)
     , lock_()
     , map_()
     , running_(true)
-    , cbi_(zmq::ListenCallback::Factory([this](auto& in) { callback(in); }))
-    , workers_([&] {
-        auto out = Vector{};
-        const auto target = Capacity();
+    , queues_([] {
+        auto out = Queues{};
+        const auto target = std::max<std::size_t>(Capacity(), 1u);
         out.reserve(target);
 
-        for (unsigned int i{0}; i < target; ++i) {
-            auto& worker =
-                out.emplace_back(zmq_.PullSocket(cbi_, Direction::Connect));
-            const auto rc = worker->Start(internal_endpoint_);
-
-            OT_ASSERT(rc);
-
-            LogTrace("Started thread pool worker #")(i).Flush();
+        for (auto i = std::size_t{0}; i < target; ++i) {
+            out.emplace_back(std::make_unique<Queue>());
         }
 
         return out;
     }())
-    , int_([&] {
-        auto out = zmq_.PushSocket(Direction::Bind);
-        const auto rc = out->Start(internal_endpoint_);
+    , next_queue_(0)
+    , queued_(0)
+    , wait_lock_()
+    , cv_()
+    , queue_depth_(metrics::Registry::Get().GetGauge("thread_pool.queued"))
+    , jobs_(metrics::Registry::Get().GetCounter("thread_pool.jobs"))
+    , workers_([&] {
+        auto out = std::vector<std::thread>{};
+        out.reserve(queues_.size());
 
-        OT_ASSERT(rc);
+        for (auto i = std::size_t{0}; i < queues_.size(); ++i) {
+            out.emplace_back(&ThreadPool::work, this, i);
+            LogTrace("Started thread pool worker #")(i).Flush();
+        }
 
         return out;
     }())
-    , cbe_(zmq::ListenCallback::Factory([this](auto& in) { int_->Send(in); }))
+    , cbe_(zmq::ListenCallback::Factory([this](auto& in) { external(in); }))
     , ext_([&] {
         auto out = zmq_.PullSocket(cbe_, Direction::Bind);
         const auto rc = out->Start(endpoint_);
@@ -103,7 +131,34 @@ ThreadPool::ThreadPool(const zmq::Context& zmq) noexcept
 {
 }
 
-auto ThreadPool::callback(zmq::Message& in) noexcept -> void
+auto ThreadPool::Endpoint() const noexcept -> std::string { return endpoint_; }
+
+auto ThreadPool::enqueue(Job&& job) const noexcept -> void
+{
+    const auto index = (this == local_pool_)
+                           ? local_queue_
+                           : (next_queue_++ % queues_.size());
+    const auto priority = static_cast<std::size_t>(job.priority_);
+
+    {
+        auto& queue = *queues_.at(index);
+        auto lock = Lock{queue.lock_};
+        queue.jobs_[priority].emplace_back(std::move(job));
+        ++queued_;
+    }
+
+    queue_depth_.Add(1);
+
+    {
+        // Pairs with the predicate check in work() so the notification can
+        // not be lost
+        auto lock = Lock{wait_lock_};
+    }
+
+    cv_.notify_one();
+}
+
+auto ThreadPool::external(zmq::Message& in) noexcept -> void
 {
     const auto header = in.Header();
 
@@ -122,18 +177,8 @@ auto ThreadPool::callback(zmq::Message& in) noexcept -> void
                 OT_FAIL;
             }
         }();
-        const auto& cb = [&] {
-            auto lock = Lock{lock_};
-
-            try {
-
-                return map_.at(type);
-            } catch (...) {
-                throw std::runtime_error{"No callback for specified work type"};
-            }
-        }();
 
-        cb(in);
+        Submit(type, OTZMQMessage{in});
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -141,10 +186,93 @@ auto ThreadPool::callback(zmq::Message& in) noexcept -> void
     }
 }
 
-auto ThreadPool::Endpoint() const noexcept -> std::string { return endpoint_; }
+auto ThreadPool::Parallel(
+    const std::size_t count,
+    const std::size_t minimum,
+    const std::function<bool(std::size_t)>& job) const noexcept -> bool
+{
+    struct State {
+        const std::function<bool(std::size_t)>& job_;
+        const std::size_t count_;
+        std::atomic<std::size_t> next_{0};
+        std::atomic<bool> failed_{false};
+        std::mutex lock_{};
+        std::condition_variable cv_{};
+        bool closed_{false};
+        std::size_t active_{0};
+
+        auto Run() noexcept -> void
+        {
+            while (false == failed_.load()) {
+                const auto index = next_++;
+
+                if (index >= count_) { return; }
+
+                auto success{false};
+
+                try {
+                    success = job_(index);
+                } catch (const std::exception& e) {
+                    LogOutput(OT_METHOD)("Parallel: ")(e.what()).Flush();
+                }
+
+                if (false == success) { failed_.store(true); }
+            }
+        }
+
+        State(
+            const std::function<bool(std::size_t)>& job,
+            const std::size_t count) noexcept
+            : job_(job)
+            , count_(count)
+        {
+        }
+    };
+
+    auto state = std::make_shared<State>(job, count);
+    const auto jobs = count / std::max<std::size_t>(minimum, 1u);
+    const auto helpers = std::min(queues_.size(), jobs);
+
+    for (auto i = std::size_t{1}; running_ && (i < helpers); ++i) {
+        enqueue(Job{local_priority_, [state] {
+                        {
+                            auto lock = Lock{state->lock_};
+
+                            // The caller has returned
+                            if (state->closed_) { return; }
+
+                            ++state->active_;
+                        }
+
+                        state->Run();
+
+                        {
+                            auto lock = Lock{state->lock_};
+                            --state->active_;
+                        }
+
+                        state->cv_.notify_all();
+                    }});
+    }
+
+    state->Run();
+    auto lock = std::unique_lock<std::mutex>{state->lock_};
+    state->closed_ = true;
+    state->cv_.wait(lock, [&] { return 0u == state->active_; });
+
+    return false == state->failed_.load();
+}
 
 auto ThreadPool::Register(WorkType type, Callback handler) const noexcept
     -> bool
+{
+    return Register(type, std::move(handler), Priority::Background);
+}
+
+auto ThreadPool::Register(
+    WorkType type,
+    Callback handler,
+    Priority priority) const noexcept -> bool
 {
     if (!handler) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": invalid handler").Flush();
@@ -152,8 +280,9 @@ auto ThreadPool::Register(WorkType type, Callback handler) const noexcept
         return false;
     }
 
-    auto lock = Lock{lock_};
-    const auto [it, added] = map_.try_emplace(type, std::move(handler));
+    auto lock = std::unique_lock<std::shared_mutex>{lock_};
+    const auto [it, added] =
+        map_.try_emplace(type, Handler{std::move(handler), priority});
 
     return added;
 }
@@ -162,8 +291,126 @@ auto ThreadPool::Shutdown() noexcept -> void
 {
     if (running_.exchange(false)) {
         ext_->Close();
-        int_->Close();
+
+        {
+            auto lock = Lock{wait_lock_};
+        }
+
+        cv_.notify_all();
+
+        for (auto& worker : workers_) {
+            if (worker.joinable()) { worker.join(); }
+        }
+
         workers_.clear();
+
+        for (auto& queue : queues_) {
+            auto lock = Lock{queue->lock_};
+
+            for (auto& jobs : queue->jobs_) { jobs.clear(); }
+        }
+    }
+}
+
+auto ThreadPool::Submit(WorkType type, OTZMQMessage&& work) const noexcept
+    -> bool
+{
+    if (false == running_) { return false; }
+
+    // Handlers are never removed so the pointer remains valid
+    const auto* handler = [&]() -> const Handler* {
+        auto lock = std::shared_lock<std::shared_mutex>{lock_};
+
+        if (auto it = map_.find(type); map_.end() != it) {
+
+            return &it->second;
+        }
+
+        return nullptr;
+    }();
+
+    if (nullptr == handler) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": No callback for specified work type")
+            .Flush();
+
+        return false;
     }
+
+    enqueue(Job{handler->priority_, [handler, work = std::move(work)] {
+                    handler->callback_(work.get());
+                }});
+
+    return true;
 }
+
+auto ThreadPool::take(const std::size_t index) const noexcept
+    -> std::optional<Job>
+{
+    const auto count = queues_.size();
+
+    for (auto priority = std::size_t{0}; priority < priorities_; ++priority) {
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto victim = (index + i) % count;
+            auto& queue = *queues_[victim];
+            auto lock = Lock{queue.lock_};
+            auto& jobs = queue.jobs_[priority];
+
+            if (jobs.empty()) { continue; }
+
+            auto output = std::optional<Job>{};
+
+            if (victim == index) {
+                output.emplace(std::move(jobs.front()));
+                jobs.pop_front();
+            } else {
+                output.emplace(std::move(jobs.back()));
+                jobs.pop_back();
+            }
+
+            --queued_;
+            queue_depth_.Add(-1);
+
+            return output;
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto ThreadPool::work(const std::size_t index) noexcept -> void
+{
+    local_pool_ = this;
+    local_queue_ = index;
+
+    while (true) {
+        {
+            auto lock = Lock{wait_lock_};
+            cv_.wait(
+                lock, [&] { return (false == running_) || (0 < queued_); });
+        }
+
+        if (false == running_) { break; }
+
+        auto job = take(index);
+
+        // Another worker claimed the job first
+        if (false == job.has_value()) { continue; }
+
+        auto& [priority, run] = job.value();
+        local_priority_ = priority;
+
+        try {
+            run();
+            jobs_.Add();
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+        }
+    }
+
+    local_pool_ = nullptr;
+    local_priority_ = Priority::UI;
+}
+
+ThreadPool::~ThreadPool() { Shutdown(); }
 }  // namespace opentxs::api::implementation
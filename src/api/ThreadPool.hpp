@@ -7,16 +7,25 @@
 
 #include "opentxs/api/ThreadPool.hpp"  // IWYU pragma: associated
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
 #include <vector>
 
 #include "internal/api/Api.hpp"
-#include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/socket/Pull.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
+#include "util/Metrics.hpp"
 
 namespace opentxs
 {
@@ -25,7 +34,6 @@ namespace network
 namespace zeromq
 {
 class Context;
-class Message;
 }  // namespace zeromq
 }  // namespace network
 }  // namespace opentxs
@@ -34,33 +42,80 @@ namespace zmq = opentxs::network::zeromq;
 
 namespace opentxs::api::implementation
 {
+/** Native scheduler for work registered by type
+ *
+ *  Every worker owns one deque per priority class. Jobs submitted by a
+ *  worker are queued locally and other jobs are distributed round robin.
+ *  A worker looking for work takes the oldest job from its own deque and
+ *  otherwise steals the newest job from another worker, checking every
+ *  deque for a priority class before moving to the next one.
+ *
+ *  The zmq endpoint remains for work which is sent by other processes.
+ */
 class ThreadPool final : public internal::ThreadPool
 {
 public:
     auto Endpoint() const noexcept -> std::string final;
+    auto Parallel(
+        const std::size_t count,
+        const std::size_t minimum,
+        const std::function<bool(std::size_t)>& job) const noexcept
+        -> bool final;
     auto Register(WorkType type, Callback handler) const noexcept -> bool final;
+    auto Register(WorkType type, Callback handler, Priority priority)
+        const noexcept -> bool final;
+    auto Submit(WorkType type, OTZMQMessage&& work) const noexcept
+        -> bool final;
 
     auto Shutdown() noexcept -> void final;
 
     ThreadPool(const opentxs::network::zeromq::Context& zmq) noexcept;
 
-    ~ThreadPool() final = default;
+    ~ThreadPool() final;
 
 private:
-    using Map = std::map<WorkType, Callback>;
-    using Vector = std::vector<OTZMQPullSocket>;
+    struct Handler {
+        Callback callback_;
+        Priority priority_;
+    };
+
+    struct Job {
+        Priority priority_;
+        std::function<void()> run_;
+    };
+
+    static constexpr auto priorities_ = std::size_t{4};
+
+    struct Queue {
+        std::mutex lock_{};
+        std::array<std::deque<Job>, priorities_> jobs_{};
+    };
+
+    using Map = std::map<WorkType, Handler>;
+    using Queues = std::vector<std::unique_ptr<Queue>>;
 
     const opentxs::network::zeromq::Context& zmq_;
-    mutable std::mutex lock_;
+    mutable std::shared_mutex lock_;
     mutable Map map_;
     std::atomic<bool> running_;
-    OTZMQListenCallback cbi_;
-    Vector workers_;
-    OTZMQPushSocket int_;
+    const Queues queues_;
+    mutable std::atomic<std::size_t> next_queue_;
+    // Number of jobs in the deques. Changed under the lock of the deque which
+    // holds the job
+    mutable std::atomic<std::size_t> queued_;
+    mutable std::mutex wait_lock_;
+    mutable std::condition_variable cv_;
+    metrics::Gauge& queue_depth_;
+    metrics::Counter& jobs_;
+    std::vector<std::thread> workers_;
     OTZMQListenCallback cbe_;
     OTZMQPullSocket ext_;
 
-    auto callback(zmq::Message& in) noexcept -> void;
+    auto enqueue(Job&& job) const noexcept -> void;
+    auto take(const std::size_t index) const noexcept -> std::optional<Job>;
+
+    auto external(zmq::Message& in) noexcept -> void;
+    auto work(const std::size_t index) noexcept -> void;
 
     ThreadPool() = delete;
     ThreadPool(const ThreadPool&) = delete;
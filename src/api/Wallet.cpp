@@ -11,7 +11,6 @@
 #include <functional>
 #include <iterator>
 #include <stdexcept>
-#include <thread>
 #include <type_traits>
 
 #include "2_Factory.hpp"
@@ -20,6 +19,7 @@
 #include "Proto.tpp"
 #include "internal/api/Api.hpp"
 #include "internal/api/client/Factory.hpp"
+#include "internal/api/storage/Storage.hpp"
 #include "internal/contact/Contact.hpp"
 #include "internal/core/Core.hpp"
 #include "internal/identity/Identity.hpp"
@@ -33,6 +33,8 @@
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/client/Issuer.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/storage/Storage.hpp"
 #if OT_CASH
@@ -54,6 +56,7 @@
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/core/identifier/Server.hpp"
 #include "opentxs/core/identifier/UnitDefinition.hpp"
+#include "opentxs/crypto/HashType.hpp"
 #include "opentxs/identity/Nym.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
@@ -76,6 +79,7 @@
 #include "opentxs/protobuf/verify/Purse.hpp"
 #include "opentxs/protobuf/verify/ServerContract.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/ScopeGuard.hpp"
 
 template class opentxs::Exclusive<opentxs::Account>;
 template class opentxs::Shared<opentxs::Account>;
@@ -120,6 +124,9 @@ Wallet::Wallet(const api::internal::Core& core)
     , server_map_()
     , unit_map_()
     , issuer_map_()
+    , nym_waiters_()
+    , server_waiters_()
+    , unit_waiters_()
     , account_map_lock_()
     , nym_map_lock_()
     , server_map_lock_()
@@ -133,6 +140,10 @@ Wallet::Wallet(const api::internal::Core& core)
     , purse_lock_()
     , purse_id_lock_()
 #endif
+    , verified_()
+    , verified_order_()
+    , unsaved_()
+    , verified_lock_()
     , account_publisher_(api_.Network().ZeroMQ().PublishSocket())
     , issuer_publisher_(api_.Network().ZeroMQ().PublishSocket())
     , nym_publisher_(api_.Network().ZeroMQ().PublishSocket())
@@ -1061,6 +1072,7 @@ auto Wallet::Nym(
     const identifier::Nym& id,
     const std::chrono::milliseconds& timeout) const -> Nym_p
 {
+    const auto post = ScopeGuard{[this] { save_verified(); }};
     const std::string nym = id.str();
     Lock mapLock(nym_map_lock_);
     bool inMap = (nym_map_.find(nym) != nym_map_.end());
@@ -1076,8 +1088,9 @@ auto Wallet::Nym(
             pNym.reset(opentxs::Factory::Nym(api_, serialized, alias));
 
             if (pNym && pNym->CompareID(id)) {
-                valid = pNym->VerifyPseudonym();
+                valid = verify(*pNym);
                 pNym->SetAliasStartup(alias);
+                resolve(mapLock, nym_waiters_, nym);
             } else {
                 nym_map_.erase(nym);
             }
@@ -1090,19 +1103,7 @@ auto Wallet::Nym(
             }
 
             if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
-
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (nym_map_.find(nym) != nym_map_.end());
-                    mapLock.unlock();
-
-                    if (found) { break; }
-                }
+                wait(mapLock, nym_waiters_, nym, timeout);
 
                 return Nym(id);  // timeout of zero prevents infinite
                                  // recursion
@@ -1110,7 +1111,7 @@ auto Wallet::Nym(
         }
     } else {
         auto& pNym = nym_map_[nym].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
+        if (pNym) { valid = verify(*pNym); }
     }
 
     if (valid) { return nym_map_[nym].second; }
@@ -1120,6 +1121,7 @@ auto Wallet::Nym(
 
 auto Wallet::Nym(const proto::Nym& serialized) const -> Nym_p
 {
+    const auto post = ScopeGuard{[this] { save_verified(); }};
     const auto& id = serialized.nymid();
     const auto nymID = identifier::Nym::Factory(id);
 
@@ -1147,7 +1149,7 @@ auto Wallet::Nym(const proto::Nym& serialized) const -> Nym_p
 
         if (false == candidate.CompareID(nymID)) { return existing; }
 
-        if (candidate.VerifyPseudonym()) {
+        if (verify(candidate)) {
             LogDetail(OT_METHOD)(__FUNCTION__)(": Saving updated nym ")(id)
                 .Flush();
             candidate.WriteCredentials();
@@ -1156,6 +1158,7 @@ auto Wallet::Nym(const proto::Nym& serialized) const -> Nym_p
             auto& mapNym = nym_map_[id].second;
             // TODO update existing nym rather than destroying it
             mapNym.reset(pCandidate.release());
+            resolve(mapLock, nym_waiters_, id);
             notify(nymID);
 
             return mapNym;
@@ -1210,6 +1213,7 @@ auto Wallet::Nym(
             Lock mapLock(nym_map_lock_);
             auto& pMapNym = nym_map_[nym.ID().str()].second;
             pMapNym = pNym;
+            resolve(mapLock, nym_waiters_, nym.ID().str());
 
             {
                 auto work =
@@ -1340,6 +1344,7 @@ auto Wallet::nymfile_lock(const identifier::Nym& nymID) const -> std::mutex&
 
 auto Wallet::NymByIDPartialMatch(const std::string& partialId) const -> Nym_p
 {
+    const auto post = ScopeGuard{[this] { save_verified(); }};
     Lock mapLock(nym_map_lock_);
     bool inMap = (nym_map_.find(partialId) != nym_map_.end());
     bool valid = false;
@@ -1347,18 +1352,18 @@ auto Wallet::NymByIDPartialMatch(const std::string& partialId) const -> Nym_p
     if (!inMap) {
         for (auto& it : nym_map_) {
             if (it.first.compare(0, partialId.length(), partialId) == 0)
-                if (it.second.second->VerifyPseudonym())
+                if (verify(*it.second.second))
                     return it.second.second;
         }
         for (auto& it : nym_map_) {
             if (it.second.second->Alias().compare(
                     0, partialId.length(), partialId) == 0)
-                if (it.second.second->VerifyPseudonym())
+                if (verify(*it.second.second))
                     return it.second.second;
         }
     } else {
         auto& pNym = nym_map_[partialId].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
+        if (pNym) { valid = verify(*pNym); }
     }
 
     if (valid) { return nym_map_[partialId].second; }
@@ -2036,6 +2041,19 @@ auto Wallet::publish_unit(const identifier::UnitDefinition& id) const noexcept
     socket.Send(work);
 }
 
+auto Wallet::resolve(
+    [[maybe_unused]] const Lock& lock,
+    WaitMap& map,
+    const std::string& id) noexcept -> void
+{
+    auto it = map.find(id);
+
+    if (map.end() == it) { return; }
+
+    std::get<0>(it->second).set_value();
+    map.erase(it);
+}
+
 auto Wallet::reverse_unit_map(const UnitNameMap& map) -> Wallet::UnitNameReverse
 {
     UnitNameReverse output{};
@@ -2199,6 +2217,20 @@ void Wallet::save(
     OT_ASSERT(saved);
 }
 
+auto Wallet::save_verified() const noexcept -> void
+{
+    auto records = decltype(unsaved_){};
+
+    {
+        Lock lock(verified_lock_);
+        records.swap(unsaved_);
+    }
+
+    for (const auto& [id, digest] : records) {
+        storage().MarkVerified(id, digest);
+    }
+}
+
 auto Wallet::SaveCredentialIDs(const identity::Nym& nym) const -> bool
 {
     auto index = proto::Nym{};
@@ -2239,6 +2271,7 @@ auto Wallet::Server(
     const identifier::Server& id,
     const std::chrono::milliseconds& timeout) const -> OTServerContract
 {
+    const auto post = ScopeGuard{[this] { save_verified(); }};
     const std::string server = id.str();
     Lock mapLock(server_map_lock_);
     bool inMap = (server_map_.find(server) != server_map_.end());
@@ -2264,6 +2297,7 @@ auto Wallet::Server(
                 if (pServer) {
                     valid = true;  // Factory() performs validation
                     pServer->InitAlias(alias);
+                    resolve(mapLock, server_waiters_, server);
                 } else {
                     server_map_.erase(server);
                 }
@@ -2277,20 +2311,7 @@ auto Wallet::Server(
             }
 
             if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
-
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found =
-                        (server_map_.find(server) != server_map_.end());
-                    mapLock.unlock();
-
-                    if (found) { break; }
-                }
+                wait(mapLock, server_waiters_, server, timeout);
 
                 return Server(id);  // timeout of zero prevents infinite
                                     // recursion
@@ -2298,7 +2319,7 @@ auto Wallet::Server(
         }
     } else {
         auto& pServer = server_map_[server];
-        if (pServer) { valid = pServer->Validate(); }
+        if (pServer) { valid = validate(*pServer); }
     }
 
     if (valid) { return OTServerContract{server_map_[server]}; }
@@ -2313,7 +2334,7 @@ auto Wallet::server(std::unique_ptr<contract::Server> contract) const
         throw std::runtime_error("Null server contract");
     }
 
-    if (false == contract->Validate()) {
+    if (false == validate(*contract)) {
         throw std::runtime_error("Invalid server contract");
     }
 
@@ -2334,6 +2355,7 @@ auto Wallet::server(std::unique_ptr<contract::Server> contract) const
         {
             Lock mapLock(server_map_lock_);
             server_map_[server].reset(contract.release());
+            resolve(mapLock, server_waiters_, server);
         }
 
         publish_server(id);
@@ -2372,7 +2394,7 @@ auto Wallet::Server(const proto::ServerContract& contract) const
             opentxs::Factory::ServerContract(api_, nym, contract)};
 
         if (candidate) {
-            if (candidate->Validate()) {
+            if (validate(*candidate)) {
                 if (serverID.get() != candidate->ID()) {
                     LogOutput(OT_METHOD)(__FUNCTION__)(": Wrong contract ID.")
                         .Flush();
@@ -2392,6 +2414,7 @@ auto Wallet::Server(const proto::ServerContract& contract) const
                     {
                         Lock mapLock(server_map_lock_);
                         server_map_[server].reset(candidate.release());
+                        resolve(mapLock, server_waiters_, server);
                     }
 
                     publish_server(serverID);
@@ -2549,6 +2572,11 @@ auto Wallet::SetUnitDefinitionAlias(
     return false;
 }
 
+auto Wallet::storage() const noexcept -> const storage::StorageInternal&
+{
+    return dynamic_cast<const storage::StorageInternal&>(api_.Storage());
+}
+
 auto Wallet::UnitDefinitionList() const -> ObjectList
 {
     return api_.Storage().UnitDefinitionList();
@@ -2558,6 +2586,7 @@ auto Wallet::UnitDefinition(
     const identifier::UnitDefinition& id,
     const std::chrono::milliseconds& timeout) const -> OTUnitDefinition
 {
+    const auto post = ScopeGuard{[this] { save_verified(); }};
     const std::string unit = id.str();
     Lock mapLock(unit_map_lock_);
     bool inMap = (unit_map_.find(unit) != unit_map_.end());
@@ -2582,6 +2611,7 @@ auto Wallet::UnitDefinition(
                 if (pUnit) {
                     valid = true;  // Factory() performs validation
                     pUnit->InitAlias(alias);
+                    resolve(mapLock, unit_waiters_, unit);
                 } else {
                     unit_map_.erase(unit);
                 }
@@ -2595,19 +2625,7 @@ auto Wallet::UnitDefinition(
             }
 
             if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
-
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (unit_map_.find(unit) != unit_map_.end());
-                    mapLock.unlock();
-
-                    if (found) { break; }
-                }
+                wait(mapLock, unit_waiters_, unit, timeout);
 
                 return UnitDefinition(id);  // timeout of zero prevents infinite
                                             // recursion
@@ -2615,7 +2633,7 @@ auto Wallet::UnitDefinition(
         }
     } else {
         auto& pUnit = unit_map_[unit];
-        if (pUnit) { valid = pUnit->Validate(); }
+        if (pUnit) { valid = validate(*pUnit); }
     }
 
     if (valid) { return OTUnitDefinition{unit_map_[unit]}; }
@@ -2630,7 +2648,7 @@ auto Wallet::unit_definition(std::shared_ptr<contract::Unit>&& contract) const
         throw std::runtime_error("Null unit definition contract");
     }
 
-    if (false == contract->Validate()) {
+    if (false == validate(*contract)) {
         throw std::runtime_error("Invalid unit definition contract");
     }
 
@@ -2653,6 +2671,8 @@ auto Wallet::unit_definition(std::shared_ptr<contract::Unit>&& contract) const
             } else {
                 it->second = std::move(contract);
             }
+
+            resolve(mapLock, unit_waiters_, unit);
         }
 
         publish_unit(id);
@@ -2686,7 +2706,7 @@ auto Wallet::UnitDefinition(const proto::UnitDefinition& contract) const
         auto candidate = opentxs::Factory::UnitDefinition(api_, nym, contract);
 
         if (candidate) {
-            if (candidate->Validate()) {
+            if (validate(*candidate)) {
                 if (unitID.get() != candidate->ID()) {
                     LogOutput(OT_METHOD)(__FUNCTION__)(": Wrong contract ID.")
                         .Flush();
@@ -2712,6 +2732,8 @@ auto Wallet::UnitDefinition(const proto::UnitDefinition& contract) const
                         } else {
                             it->second = std::move(candidate);
                         }
+
+                        resolve(mapLock, unit_waiters_, unit);
                     }
 
                     publish_unit(unitID);
@@ -2828,4 +2850,105 @@ auto Wallet::SaveCredential(const proto::Credential& credential) const -> bool
 {
     return api_.Storage().Store(credential);
 }
+
+auto Wallet::validate(const contract::Signable& contract) const noexcept
+    -> bool
+{
+    const auto serialized = contract.Serialize();
+
+    return verified(contract.ID(), serialized->Bytes(), [&] {
+        return contract.Validate();
+    });
+}
+
+auto Wallet::verified(
+    const Identifier& id,
+    const ReadView bytes,
+    const std::function<bool()>& check) const noexcept -> bool
+{
+    auto hash = std::string{};
+
+    if (false == api_.Crypto().Hash().Digest(
+                     opentxs::crypto::HashType::Sha256, bytes, writer(hash))) {
+
+        return check();
+    }
+
+    {
+        Lock lock(verified_lock_);
+
+        if (0 < verified_.count(hash)) { return true; }
+    }
+
+    const auto stored = storage().CheckVerified(id, hash);
+
+    if ((false == stored) && (false == check())) { return false; }
+
+    Lock lock(verified_lock_);
+
+    if (false == stored) {
+        unsaved_.emplace_back(Identifier::Factory(id), hash);
+    }
+
+    if (verified_.emplace(hash).second) {
+        verified_order_.emplace_back(std::move(hash));
+
+        while (verified_limit_ < verified_order_.size()) {
+            verified_.erase(verified_order_.front());
+            verified_order_.pop_front();
+        }
+    }
+
+    return true;
+}
+
+auto Wallet::verify(const identity::Nym& nym) const noexcept -> bool
+{
+    auto serialized = Space{};
+
+    if (false == nym.Serialize(writer(serialized))) {
+        return nym.VerifyPseudonym();
+    }
+
+    return verified(nym.ID(), reader(serialized), [&] {
+        return nym.VerifyPseudonym();
+    });
+}
+
+auto Wallet::wait(
+    Lock& lock,
+    WaitMap& map,
+    const std::string& id,
+    const std::chrono::milliseconds& timeout) noexcept -> void
+{
+    auto it = map.find(id);
+
+    if (map.end() == it) {
+        auto promise = std::promise<void>{};
+        auto future = promise.get_future().share();
+        it = map.emplace(id, Waiter{std::move(promise), std::move(future), 0})
+                 .first;
+    }
+
+    ++std::get<2>(it->second);
+    const auto future = std::get<1>(it->second);
+    lock.unlock();
+    const auto status = future.wait_for(timeout);
+
+    if (std::future_status::ready == status) { return; }
+
+    lock.lock();
+
+    // resolve() removes the entry and readies the future together, so an
+    // entry which is not ready is still the one this caller joined
+    if (std::future_status::ready != future.wait_for(std::chrono::seconds{0})) {
+        it = map.find(id);
+
+        OT_ASSERT(map.end() != it);
+
+        if (0 == --std::get<2>(it->second)) { map.erase(it); }
+    }
+
+    lock.unlock();
+}
 }  // namespace opentxs::api::implementation
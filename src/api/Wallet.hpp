@@ -6,8 +6,11 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <functional>
+#include <future>
 #include <iosfwd>
 #include <list>
 #include <map>
@@ -18,6 +21,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "Proto.hpp"
 #include "internal/identity/Identity.hpp"
@@ -59,6 +63,11 @@ namespace internal
 {
 struct Core;
 }  // namespace internal
+
+namespace storage
+{
+class StorageInternal;
+}  // namespace storage
 }  // namespace api
 
 namespace blind
@@ -393,15 +402,24 @@ private:
     using PurseID = std::tuple<OTNymID, OTServerID, OTUnitID>;
     using UnitNameMap = std::map<std::string, proto::ContactItemType>;
     using UnitNameReverse = std::map<proto::ContactItemType, std::string>;
+    // Shared by every caller waiting for the same object to arrive, along
+    // with the number of callers still waiting
+    using Waiter =
+        std::tuple<std::promise<void>, std::shared_future<void>, std::size_t>;
+    using WaitMap = std::map<std::string, Waiter>;
 
     static const UnitNameMap unit_of_account_;
     static const UnitNameReverse unit_lookup_;
+    static constexpr auto verified_limit_ = std::size_t{4096};
 
     mutable AccountMap account_map_;
     mutable NymMap nym_map_;
     mutable ServerMap server_map_;
     mutable UnitMap unit_map_;
     mutable IssuerMap issuer_map_;
+    mutable WaitMap nym_waiters_;
+    mutable WaitMap server_waiters_;
+    mutable WaitMap unit_waiters_;
     mutable std::mutex account_map_lock_;
     mutable std::mutex nym_map_lock_;
     mutable std::mutex server_map_lock_;
@@ -415,6 +433,14 @@ private:
     mutable std::mutex purse_lock_;
     mutable std::map<PurseID, std::mutex> purse_id_lock_;
 #endif
+    // Content hashes of nyms and contracts which passed verification in
+    // this session, oldest first in verified_order_. Storage keeps the same
+    // record next to each object.
+    mutable std::set<std::string> verified_;
+    mutable std::list<std::string> verified_order_;
+    // Verification records waiting to be written by save_verified()
+    mutable std::vector<std::pair<OTIdentifier, std::string>> unsaved_;
+    mutable std::mutex verified_lock_;
     OTZMQPublishSocket account_publisher_;
     OTZMQPublishSocket issuer_publisher_;
     OTZMQPublishSocket nym_publisher_;
@@ -428,7 +454,17 @@ private:
     OTZMQRequestSocket dht_unit_requester_;
     OTZMQPushSocket find_nym_;
 
+    static auto resolve(
+        const Lock& lock,
+        WaitMap& map,
+        const std::string& id) noexcept -> void;
     static auto reverse_unit_map(const UnitNameMap& map) -> UnitNameReverse;
+    /// Releases the lock and blocks until id is resolved or timeout expires
+    static auto wait(
+        Lock& lock,
+        WaitMap& map,
+        const std::string& id,
+        const std::chrono::milliseconds& timeout) noexcept -> void;
 
     auto account_alias(const std::string& accountID, const std::string& hint)
         const -> std::string;
@@ -502,7 +538,19 @@ private:
         opentxs::NymFile* nym,
         const Lock& lock) const;
     auto SaveCredentialIDs(const identity::Nym& nym) const -> bool;
+    /// Write the records queued by verified(). Call with no map locks held.
+    auto save_verified() const noexcept -> void;
     virtual auto signer_nym(const identifier::Nym& id) const -> Nym_p = 0;
+    auto storage() const noexcept -> const storage::StorageInternal&;
+    auto validate(const contract::Signable& contract) const noexcept -> bool;
+    /// Runs check only if bytes have not previously passed verification
+    ///
+    /// New verification records are queued for save_verified()
+    auto verified(
+        const Identifier& id,
+        const ReadView bytes,
+        const std::function<bool()>& check) const noexcept -> bool;
+    auto verify(const identity::Nym& nym) const noexcept -> bool;
 
     /* Throws std::out_of_range for missing accounts */
     auto account(
@@ -21,8 +21,10 @@
 
 #include "Proto.tpp"
 #include "core/StateMachine.hpp"
+#include "internal/api/Api.hpp"
 #include "internal/api/client/Client.hpp"
 #include "internal/api/client/Factory.hpp"
+#include "internal/otx/client/Client.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Shared.hpp"
 #include "opentxs/SharedPimpl.hpp"
@@ -293,6 +295,14 @@ OTX::OTX(
         find_unit_listener_->Start(client_.Endpoints().FindUnitDefinition());
 
     OT_ASSERT(listening)
+
+    using Pool = api::internal::ThreadPool;
+    Pool::Get(client_).Register(
+        value(Pool::Work::OTXOperation),
+        [](const auto& work) {
+            otx::client::internal::Operation::ProcessThreadPool(work);
+        },
+        Pool::Priority::Wallet);
 }
 
 auto OTX::AcknowledgeBailment(
@@ -128,16 +128,20 @@ BlockchainImp::BlockchainImp(
     constexpr auto value = [](auto work) {
         return static_cast<OTZMQWorkType>(work);
     };
-    const auto& pool = api_.ThreadPool();
-    pool.Register(value(Work::BlockchainWallet), [](const auto& work) {
-        Wallet::ProcessThreadPool(work);
-    });
-    pool.Register(value(Work::SyncDataFiltersIncoming), [](const auto& work) {
-        Filters::ProcessThreadPool(work);
-    });
-    pool.Register(value(Work::CalculateBlockFilters), [](const auto& work) {
-        Filters::ProcessThreadPool(work);
-    });
+    using Priority = api::internal::ThreadPool::Priority;
+    const auto& pool = api::internal::ThreadPool::Get(api_);
+    pool.Register(
+        value(Work::BlockchainWallet),
+        [](const auto& work) { Wallet::ProcessThreadPool(work); },
+        Priority::Wallet);
+    pool.Register(
+        value(Work::SyncDataFiltersIncoming),
+        [](const auto& work) { Filters::ProcessThreadPool(work); },
+        Priority::Indexing);
+    pool.Register(
+        value(Work::CalculateBlockFilters),
+        [](const auto& work) { Filters::ProcessThreadPool(work); },
+        Priority::Indexing);
 }
 
 auto BlockchainImp::AddSyncServer(const std::string& endpoint) const noexcept
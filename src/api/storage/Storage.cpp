@@ -7,7 +7,9 @@
 #include "1_Internal.hpp"           // IWYU pragma: associated
 #include "api/storage/Storage.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <functional>
@@ -66,6 +68,7 @@
 #include "storage/tree/Credentials.hpp"
 #include "storage/tree/Issuers.hpp"
 #include "storage/tree/Mailbox.hpp"
+#include "storage/tree/Node.hpp"
 #include "storage/tree/Notary.hpp"
 #include "storage/tree/Nym.hpp"
 #include "storage/tree/Nyms.hpp"
@@ -161,6 +164,7 @@ auto Factory::Storage(
     }
 
     const bool haveGCInterval = (0 != gcIntervalCLI.count());
+    std::int64_t configCacheLimit{0};
     std::int64_t defaultGcInterval{0};
     std::int64_t configGcInterval{0};
 
@@ -196,6 +200,14 @@ auto Factory::Storage(
         defaultGcInterval,
         configGcInterval,
         notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("cache_limit"),
+        static_cast<std::int64_t>(storageConfig.cache_limit_),
+        configCacheLimit,
+        notUsed);
+    storageConfig.cache_limit_ =
+        static_cast<std::size_t>(std::max<std::int64_t>(configCacheLimit, 0));
     config.CheckSet_str(
         String::Factory(STORAGE_CONFIG_KEY),
         String::Factory("path"),
@@ -372,8 +384,10 @@ Storage::Storage(
     , primary_bucket_(Flag::Factory(false))
     , background_threads_()
     , config_(config)
+    , cache_(config_.cache_limit_)
     , multiplex_p_(opentxs::Factory::StorageMultiplex(
           *this,
+          cache_,
           primary_bucket_,
           config_,
           primary,
@@ -563,6 +577,20 @@ auto Storage::CheckTokenSpent(
 #endif
 }
 
+auto Storage::CheckVerified(const Identifier& id, const std::string& digest)
+    const -> bool
+{
+    const auto key = verified_key(id);
+
+    if (key.empty()) { return false; }
+
+    auto record = std::string{};
+
+    if (false == multiplex_.Load(key, true, record)) { return false; }
+
+    return digest == record;
+}
+
 void Storage::Cleanup_Storage()
 {
     for (auto& thread : background_threads_) {
@@ -1203,6 +1231,16 @@ auto Storage::MarkTokenSpent(
 #endif
 }
 
+auto Storage::MarkVerified(const Identifier& id, const std::string& digest)
+    const -> bool
+{
+    const auto key = verified_key(id);
+
+    if (key.empty()) { return false; }
+
+    return multiplex_.Store(false, key, digest, primary_bucket_.get());
+}
+
 auto Storage::MoveThreadItem(
     const std::string& nymId,
     const std::string& fromThreadID,
@@ -2620,6 +2658,25 @@ void Storage::UpgradeNyms()
     }
 }
 
+auto Storage::verified_key(const Identifier& id) const -> std::string
+{
+    const auto item = id.str();
+    const auto& tree = Root().Tree();
+    auto hash = std::string{};
+
+    if (tree.Nyms().Exists(item)) {
+        hash = tree.Nyms().Nym(item).CredentialsHash();
+    } else {
+        hash = tree.Servers().Hash(item);
+
+        if (hash.empty()) { hash = tree.Units().Hash(item); }
+    }
+
+    if (hash.empty()) { return {}; }
+
+    return opentxs::storage::Node::VerifiedKey(hash);
+}
+
 auto Storage::verify_write_lock(const Lock& lock) const -> bool
 {
     if (lock.mutex() != &write_lock_) {
@@ -38,6 +38,7 @@
 #include "opentxs/core/identifier/Server.hpp"
 #include "opentxs/core/identifier/UnitDefinition.hpp"
 #include "opentxs/protobuf/PaymentWorkflowEnums.pb.h"
+#include "storage/ObjectCache.hpp"
 #include "storage/StorageConfig.hpp"
 
 namespace opentxs
@@ -156,6 +157,8 @@ public:
         const identifier::UnitDefinition& unit,
         const std::uint64_t series,
         const std::string& key) const -> bool final;
+    auto CheckVerified(const Identifier& id, const std::string& digest) const
+        -> bool final;
     auto ContactAlias(const std::string& id) const -> std::string final;
     auto ContactList() const -> ObjectList final;
     auto ContextList(const std::string& nymID) const -> ObjectList final;
@@ -298,6 +301,8 @@ public:
         const identifier::UnitDefinition& unit,
         const std::uint64_t series,
         const std::string& key) const -> bool final;
+    auto MarkVerified(const Identifier& id, const std::string& digest) const
+        -> bool final;
     auto MoveThreadItem(
         const std::string& nymId,
         const std::string& fromThreadID,
@@ -472,6 +477,7 @@ private:
     mutable OTFlag primary_bucket_;
     std::vector<std::thread> background_threads_;
     const StorageConfig config_;
+    const opentxs::storage::ObjectCache cache_;
     std::unique_ptr<Multiplex> multiplex_p_;
     Multiplex& multiplex_;
 
@@ -494,6 +500,8 @@ private:
     void RunMapUnits(UnitLambda lambda) const;
     void save(opentxs::storage::Root* in, const Lock& lock) const;
     void start() final;
+    // Storage key of the verification record for a nym or contract
+    auto verified_key(const Identifier& id) const -> std::string;
 
     Storage(
         const api::Crypto& crypto,
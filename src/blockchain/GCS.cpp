@@ -473,26 +473,32 @@ auto GCS::Match(const Targets& targets) const noexcept -> Matches
     auto output = Matches{};
     auto hashed = std::vector<std::uint64_t>{};
     auto matches = std::vector<std::uint64_t>{};
-    auto map = std::map<std::uint64_t, Targets::const_iterator>{};
+    // Equal targets hash to the same value and every one of them must be
+    // returned since callers map the iterators back to distinct owners
+    auto map = std::map<std::uint64_t, std::vector<Targets::const_iterator>>{};
     const auto& set = decompress();
 
     for (auto i = targets.cbegin(); i != targets.cend(); ++i) {
-        const auto& hash = hashed.emplace_back(hash_to_range(*i));
-        map.emplace(hash, i);
+        map[hash_to_range(*i)].emplace_back(i);
     }
 
-    std::sort(std::begin(hashed), std::end(hashed));
+    hashed.reserve(map.size());
+
+    for (const auto& [hash, items] : map) { hashed.emplace_back(hash); }
+
     std::set_intersection(
         std::begin(hashed),
         std::end(hashed),
         std::begin(set),
         std::end(set),
         std::back_inserter(matches));
-    std::transform(
-        std::begin(matches),
-        std::end(matches),
-        std::back_inserter(output),
-        [&](const auto& in) { return map.at(in); });
+    matches.erase(
+        std::unique(std::begin(matches), std::end(matches)), std::end(matches));
+
+    for (const auto& hash : matches) {
+        const auto& items = map.at(hash);
+        output.insert(output.end(), items.begin(), items.end());
+    }
 
     return output;
 }
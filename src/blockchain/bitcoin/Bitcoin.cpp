@@ -78,20 +78,6 @@ auto Bip143Hashes::blank() noexcept -> const Hash&
     return output;
 }
 
-auto Bip143Hashes::get_single(
-    const std::size_t index,
-    const std::size_t total,
-    const SigHash& sigHash) noexcept -> std::unique_ptr<Hash>
-{
-    if (bitcoin::SigOption::Single != sigHash.Type()) { return nullptr; }
-
-    if (index >= total) { return nullptr; }
-
-    // TODO not implemented yet
-
-    return nullptr;
-}
-
 auto Bip143Hashes::Outpoints(const SigHash sig) const noexcept -> const Hash&
 {
     if (sig.AnyoneCanPay()) { return blank(); }
@@ -99,15 +85,15 @@ auto Bip143Hashes::Outpoints(const SigHash sig) const noexcept -> const Hash&
     return outpoints_;
 }
 
-auto Bip143Hashes::Outputs(const SigHash sig, const Hash* single) const noexcept
-    -> const Hash&
+auto Bip143Hashes::Outputs(const SigHash sig, const std::size_t index)
+    const noexcept -> const Hash&
 {
     if (SigOption::All == sig.Type()) {
 
         return outputs_;
-    } else if ((SigOption::Single == sig.Type()) && (nullptr != single)) {
+    } else if ((SigOption::Single == sig.Type()) && (index < single_.size())) {
 
-        return *single;
+        return single_[index];
     } else {
 
         return blank();
@@ -116,7 +102,6 @@ auto Bip143Hashes::Outputs(const SigHash sig, const Hash* single) const noexcept
 
 auto Bip143Hashes::Preimage(
     const std::size_t index,
-    const std::size_t total,
     const be::little_int32_buf_t& version,
     const be::little_uint32_buf_t& locktime,
     const SigHash& sigHash,
@@ -127,7 +112,9 @@ auto Bip143Hashes::Preimage(
     const auto& outpoint = input.PreviousOutput();
     const auto pScript = input.Spends().SigningSubscript();
 
-    OT_ASSERT(pScript);
+    if (false == bool(pScript)) {
+        throw std::runtime_error{"Failed to obtain signing subscript"};
+    }
 
     const auto& script = *pScript;
     const auto scriptBytes = script.CalculateSize();
@@ -135,8 +122,7 @@ auto Bip143Hashes::Preimage(
     const auto& output = input.Spends();
     const auto value = be::little_int64_buf_t{output.Value()};
     const auto sequence = be::little_uint32_buf_t{input.Sequence()};
-    const auto single = get_single(index, total, sigHash);
-    const auto& outputs = Outputs(sigHash, single.get());
+    const auto& outputs = Outputs(sigHash, index);
     // clang-format off
     auto preimage = space(
         sizeof(version) +
@@ -194,6 +180,163 @@ auto Bip143Hashes::Sequences(const SigHash sig) const noexcept -> const Hash&
     return sequences_;
 }
 
+auto LegacySighash::Preimage(
+    const std::size_t index,
+    const be::little_int32_buf_t& version,
+    const be::little_uint32_buf_t& locktime,
+    const SigHash& sigHash,
+    const block::bitcoin::internal::Input& input) const noexcept(false)
+    -> Space
+{
+    const auto inputs = outpoints_.size();
+
+    if ((index >= inputs) || (sequences_.size() != inputs)) {
+        throw std::out_of_range{"Invalid input index"};
+    }
+
+    const auto type = sigHash.Type();
+    const auto anyoneCanPay = sigHash.AnyoneCanPay();
+
+    if ((SigOption::Single == type) && (index >= outputs_.size())) {
+        throw std::runtime_error{"No output corresponds to input"};
+    }
+
+    const auto pScript = input.Spends().SigningSubscript();
+
+    if (false == bool(pScript)) {
+        throw std::runtime_error{"Failed to obtain signing subscript"};
+    }
+
+    const auto& script = *pScript;
+    const auto scriptBytes = script.CalculateSize();
+    const auto cs = CompactSize{scriptBytes};
+    const auto empty = CompactSize{0};
+    // Outputs preceding the signed input are blanked by SIGHASH_SINGLE
+    const auto blankOutput = be::little_int64_buf_t{-1};
+    const auto zero = be::little_uint32_buf_t{0};
+    const auto inputCount = CompactSize{anyoneCanPay ? 1u : inputs};
+    const auto outputCount = CompactSize{[&]() -> std::size_t {
+        switch (type) {
+            case SigOption::Single: {
+
+                return index + 1u;
+            }
+            case SigOption::None: {
+
+                return 0u;
+            }
+            case SigOption::All:
+            default: {
+
+                return outputs_.size();
+            }
+        }
+    }()};
+    const auto outputBytes = [&]() -> std::size_t {
+        switch (type) {
+            case SigOption::Single: {
+
+                return (index * (sizeof(blankOutput) + empty.Size())) +
+                       outputs_[index].size();
+            }
+            case SigOption::None: {
+
+                return 0u;
+            }
+            case SigOption::All:
+            default: {
+
+                return std::accumulate(
+                    outputs_.begin(),
+                    outputs_.end(),
+                    std::size_t{0},
+                    [](const auto& lhs, const auto& rhs) {
+                        return lhs + rhs.size();
+                    });
+            }
+        }
+    }();
+    const auto unsignedInputs = anyoneCanPay ? std::size_t{0} : inputs - 1u;
+    // clang-format off
+    auto preimage = space(
+        sizeof(version) +
+        inputCount.Size() +
+        (unsignedInputs * (sizeof(block::Outpoint) + empty.Size() +
+                           sizeof(zero))) +
+        sizeof(block::Outpoint) +
+        cs.Total() +
+        sizeof(zero) +
+        outputCount.Size() +
+        outputBytes +
+        sizeof(locktime) +
+        sizeof(sigHash)
+    );
+    // clang-format on
+    auto it = preimage.data();
+    const auto copy = [&](const void* data, const std::size_t size) {
+        std::memcpy(it, data, size);
+        std::advance(it, size);
+    };
+    const auto encode = [&](const CompactSize& size) {
+        if (false == size.Encode(preallocated(size.Size(), it))) {
+            throw std::runtime_error{"CompactSize encoding failure"};
+        }
+
+        std::advance(it, size.Size());
+    };
+    copy(&version, sizeof(version));
+    encode(inputCount);
+
+    for (auto i = std::size_t{0}; i < inputs; ++i) {
+        if (i == index) {
+            copy(&outpoints_[i], sizeof(block::Outpoint));
+            encode(cs);
+
+            if (false == script.Serialize(preallocated(scriptBytes, it))) {
+                throw std::runtime_error{"Script encoding failure"};
+            }
+
+            std::advance(it, scriptBytes);
+            copy(&sequences_[i], sizeof(sequences_[i]));
+        } else if (false == anyoneCanPay) {
+            copy(&outpoints_[i], sizeof(block::Outpoint));
+            encode(empty);
+
+            if (SigOption::All == type) {
+                copy(&sequences_[i], sizeof(sequences_[i]));
+            } else {
+                copy(&zero, sizeof(zero));
+            }
+        }
+    }
+
+    encode(outputCount);
+
+    switch (type) {
+        case SigOption::Single: {
+            for (auto i = std::size_t{0}; i < index; ++i) {
+                copy(&blankOutput, sizeof(blankOutput));
+                encode(empty);
+            }
+
+            copy(outputs_[index].data(), outputs_[index].size());
+        } break;
+        case SigOption::None: {
+        } break;
+        case SigOption::All:
+        default: {
+            for (const auto& output : outputs_) {
+                copy(output.data(), output.size());
+            }
+        }
+    }
+
+    copy(&locktime, sizeof(locktime));
+    copy(&sigHash, sizeof(sigHash));
+
+    return preimage;
+}
+
 auto EncodedInput::size() const noexcept -> std::size_t
 {
     return sizeof(outpoint_) + cs_.Total() + sizeof(sequence_);
@@ -643,7 +786,7 @@ constexpr auto All = std::byte{0x01};
 constexpr auto None = std::byte{0x02};
 constexpr auto Single = std::byte{0x03};
 constexpr auto Fork_ID = std::byte{0x40};
-constexpr auto Anyone_Can_Pay = std::byte{0x08};
+constexpr auto Anyone_Can_Pay = std::byte{0x80};
 constexpr auto test_anyone_can_pay(const std::byte& rhs) noexcept -> bool
 {
     return (rhs & Anyone_Can_Pay) == Anyone_Can_Pay;
@@ -674,37 +817,37 @@ SigHash::SigHash(
     static_assert(false == test_anyone_can_pay(std::byte{0x01}));
     static_assert(false == test_anyone_can_pay(std::byte{0x02}));
     static_assert(false == test_anyone_can_pay(std::byte{0x03}));
-    static_assert(test_anyone_can_pay(std::byte{0x08}));
-    static_assert(test_anyone_can_pay(std::byte{0x09}));
-    static_assert(test_anyone_can_pay(std::byte{0x0a}));
-    static_assert(test_anyone_can_pay(std::byte{0x0b}));
+    static_assert(test_anyone_can_pay(std::byte{0x80}));
+    static_assert(test_anyone_can_pay(std::byte{0x81}));
+    static_assert(test_anyone_can_pay(std::byte{0x82}));
+    static_assert(test_anyone_can_pay(std::byte{0x83}));
 
     static_assert(false == test_none(std::byte{0x00}));
     static_assert(false == test_none(std::byte{0x01}));
     static_assert(test_none(std::byte{0x02}));
     static_assert(false == test_none(std::byte{0x03}));
-    static_assert(false == test_none(std::byte{0x08}));
-    static_assert(false == test_none(std::byte{0x09}));
-    static_assert(test_none(std::byte{0x0a}));
-    static_assert(false == test_none(std::byte{0x0b}));
+    static_assert(false == test_none(std::byte{0x80}));
+    static_assert(false == test_none(std::byte{0x81}));
+    static_assert(test_none(std::byte{0x82}));
+    static_assert(false == test_none(std::byte{0x83}));
 
     static_assert(false == test_single(std::byte{0x00}));
     static_assert(false == test_single(std::byte{0x01}));
     static_assert(false == test_single(std::byte{0x02}));
     static_assert(test_single(std::byte{0x03}));
-    static_assert(false == test_single(std::byte{0x08}));
-    static_assert(false == test_single(std::byte{0x09}));
-    static_assert(false == test_single(std::byte{0x0a}));
-    static_assert(test_single(std::byte{0x0b}));
+    static_assert(false == test_single(std::byte{0x80}));
+    static_assert(false == test_single(std::byte{0x81}));
+    static_assert(false == test_single(std::byte{0x82}));
+    static_assert(test_single(std::byte{0x83}));
 
     static_assert(test_all(std::byte{0x00}));
     static_assert(test_all(std::byte{0x01}));
     static_assert(false == test_all(std::byte{0x02}));
     static_assert(false == test_all(std::byte{0x03}));
-    static_assert(test_all(std::byte{0x08}));
-    static_assert(test_all(std::byte{0x09}));
-    static_assert(false == test_all(std::byte{0x0a}));
-    static_assert(false == test_all(std::byte{0x0b}));
+    static_assert(test_all(std::byte{0x80}));
+    static_assert(test_all(std::byte{0x81}));
+    static_assert(false == test_all(std::byte{0x82}));
+    static_assert(false == test_all(std::byte{0x83}));
 
     switch (flag) {
         case SigOption::Single: {
@@ -29,6 +29,7 @@
 
 #include "blockchain/block/Block.hpp"
 #include "blockchain/block/bitcoin/BlockParser.hpp"
+#include "internal/api/Api.hpp"
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "opentxs/api/Core.hpp"
@@ -326,6 +327,48 @@ auto PushData(const ReadView in) noexcept(false) -> ScriptElement
 
 namespace opentxs::blockchain::block::bitcoin::implementation
 {
+namespace
+{
+constexpr auto transactions_per_job_ = std::size_t{64};
+
+/** Call a function for every transaction in a block
+ *
+ *  Large blocks are shared with idle thread pool workers. Every transaction
+ *  has its own result, so the results are returned in block order and the
+ *  caller merges them without any locking.
+ */
+template <typename Result, typename Map, typename Function>
+auto for_each_transaction(
+    const api::Core& api,
+    const Map& transactions,
+    const Function& function) noexcept -> std::vector<Result>
+{
+    auto txs = std::vector<const typename Map::mapped_type*>{};
+    txs.reserve(transactions.size());
+
+    for (const auto& [txid, tx] : transactions) { txs.emplace_back(&tx); }
+
+    auto output = std::vector<Result>(txs.size());
+    api::internal::ThreadPool::Get(api).Parallel(
+        txs.size(), transactions_per_job_, [&](const auto index) {
+            function(*txs[index], output[index]);
+
+            return true;
+        });
+
+    return output;
+}
+
+template <typename T>
+auto move_append(std::vector<T>& to, std::vector<T>& from) noexcept -> void
+{
+    to.insert(
+        to.end(),
+        std::make_move_iterator(from.begin()),
+        std::make_move_iterator(from.end()));
+}
+}  // namespace
+
 const std::size_t Block::header_bytes_{80};
 const Block::value_type Block::null_tx_{};
 
@@ -503,13 +546,13 @@ auto Block::ExtractElements(const FilterType style) const noexcept
         " transactions")
         .Flush();
 
-    for (const auto& [txid, tx] : transactions_) {
-        auto temp = tx->ExtractElements(style);
-        output.insert(
-            output.end(),
-            std::make_move_iterator(temp.begin()),
-            std::make_move_iterator(temp.end()));
-    }
+    auto results = for_each_transaction<std::vector<Space>>(
+        api_, transactions_, [&](const auto& tx, auto& result) {
+            auto temp = tx->ExtractElements(style);
+            move_append(result, temp);
+        });
+
+    for (auto& result : results) { move_append(output, result); }
 
     LogTrace(OT_METHOD)(__FUNCTION__)(": extracted ")(output.size())(
         " elements")
@@ -534,16 +577,16 @@ auto Block::FindMatches(
     auto& [inputs, outputs] = output;
     const auto parsed = ParsedPatterns{patterns};
 
-    for (const auto& [txid, tx] : transactions_) {
-        auto temp = tx->FindMatches(style, outpoints, parsed);
-        inputs.insert(
-            inputs.end(),
-            std::make_move_iterator(temp.first.begin()),
-            std::make_move_iterator(temp.first.end()));
-        outputs.insert(
-            outputs.end(),
-            std::make_move_iterator(temp.second.begin()),
-            std::make_move_iterator(temp.second.end()));
+    auto results = for_each_transaction<Matches>(
+        api_, transactions_, [&](const auto& tx, auto& result) {
+            auto temp = tx->FindMatches(style, outpoints, parsed);
+            move_append(result.first, temp.first);
+            move_append(result.second, temp.second);
+        });
+
+    for (auto& [txInputs, txOutputs] : results) {
+        move_append(inputs, txInputs);
+        move_append(outputs, txOutputs);
     }
 
     dedup(inputs);
@@ -563,42 +563,6 @@ auto Transaction::GetPatterns() const noexcept -> std::vector<PatternID>
     return output;
 }
 
-auto Transaction::GetPreimageBTC(
-    const std::size_t index,
-    const blockchain::bitcoin::SigHash& hashType) const noexcept -> Space
-{
-    if (SigHash::All != hashType.Type()) {
-        // TODO
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Mode not supported").Flush();
-
-        return {};
-    }
-
-    auto copy = Transaction{*this};
-    copy.cache_.reset_size();
-
-    if (false == copy.inputs_->ReplaceScript(index)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(
-            ": Failed to initialize input script")
-            .Flush();
-
-        return {};
-    }
-
-    if (hashType.AnyoneCanPay() && (!copy.inputs_->AnyoneCanPay(index))) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(
-            ": Failed to apply AnyoneCanPay flag")
-            .Flush();
-
-        return {};
-    }
-
-    auto output = Space{};
-    copy.Serialize(writer(output));
-
-    return output;
-}
-
 auto Transaction::Keys() const noexcept -> std::vector<KeyID>
 {
     auto out = inputs_->Keys();
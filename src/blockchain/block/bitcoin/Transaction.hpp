@@ -41,14 +41,6 @@ class Contacts;
 class Core;
 }  // namespace api
 
-namespace blockchain
-{
-namespace bitcoin
-{
-struct SigHash;
-}  // namespace bitcoin
-}  // namespace blockchain
-
 namespace proto
 {
 class BlockchainTransactionOutput;
@@ -92,10 +84,6 @@ public:
         const Patterns& txos,
         const ParsedPatterns& elements) const noexcept -> Matches final;
     auto GetPatterns() const noexcept -> std::vector<PatternID> final;
-    auto GetPreimageBTC(
-        const std::size_t index,
-        const blockchain::bitcoin::SigHash& hashType) const noexcept
-        -> Space final;
     auto ID() const noexcept -> const Txid& final { return txid_; }
     auto IDNormalized() const noexcept -> const Identifier& final;
     auto Inputs() const noexcept -> const bitcoin::Inputs& final
@@ -10,10 +10,12 @@
 #include <boost/container/vector.hpp>
 #include <robin_hood.h>
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "blockchain/crypto/Element.hpp"
 #include "blockchain/crypto/Subaccount.hpp"
@@ -109,6 +111,31 @@ auto Deterministic::BalanceElement(const Subchain type, const Bip32Index index)
 }
 
 #if OT_CRYPTO_WITH_BIP32
+auto Deterministic::add_element(
+    const rLock& lock,
+    const Subchain type,
+    const ECKey& pKey) const noexcept(false) -> Bip32Index
+{
+    if (false == bool(pKey)) {
+        throw std::runtime_error("Failed to generate key");
+    }
+
+    auto& index = generated_.at(type);
+    const auto& key = *pKey;
+    auto& addressMap = (data_.internal_.type_ == type) ? data_.internal_.map_
+                                                       : data_.external_.map_;
+    const auto& blockchain = parent_.ParentInternal().Parent();
+    const auto [it, added] = addressMap.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(index),
+        std::forward_as_tuple(std::make_unique<implementation::Element>(
+            api_, blockchain, *this, chain_, type, index, key, get_contact())));
+
+    if (false == added) { throw std::runtime_error("Failed to add key"); }
+
+    return index++;
+}
+
 auto Deterministic::check(
     const rLock& lock,
     const Subchain type,
@@ -251,11 +278,23 @@ auto Deterministic::check_lookahead(
     const PasswordPrompt& reason) const noexcept(false) -> void
 {
 #if OT_CRYPTO_WITH_BIP32
-    auto needed = need_lookahead(lock, type);
+    const auto needed = std::size_t{need_lookahead(lock, type)};
 
-    while (0u < needed) {
-        generated.emplace_back(generate_next(lock, type, reason));
-        --needed;
+    if (0u == needed) { return; }
+
+    const auto first = generated_.at(type);
+    const auto available = std::size_t{max_index_ - first};
+    const auto keys = derive_keys(
+        lock, type, first, std::min(needed, available), reason);
+
+    for (const auto& key : keys) {
+        generated.emplace_back(add_element(lock, type, key));
+    }
+
+    if (available < needed) { throw std::runtime_error("Account is full"); }
+
+    if (keys.size() < needed) {
+        throw std::runtime_error("Failed to generate key");
     }
 #endif  // OT_CRYPTO_WITH_BIP32
 }
@@ -292,6 +331,27 @@ auto Deterministic::confirm(
     }
 }
 
+auto Deterministic::derive_keys(
+    const rLock&,
+    const Subchain type,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept -> std::vector<ECKey>
+{
+    auto output = std::vector<ECKey>{};
+    output.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        auto key = PrivateKey(type, first + static_cast<Bip32Index>(i), reason);
+
+        if (false == bool(key)) { break; }
+
+        output.emplace_back(std::move(key));
+    }
+
+    return output;
+}
+
 auto Deterministic::element(
     const rLock&,
     const Subchain type,
@@ -384,31 +444,13 @@ auto Deterministic::generate(
     const PasswordPrompt& reason) const noexcept(false) -> Bip32Index
 {
 #if OT_CRYPTO_WITH_BIP32
-    auto& index = generated_.at(type);
+    const auto index = generated_.at(type);
 
     OT_ASSERT(desired == index);
 
     if (max_index_ <= index) { throw std::runtime_error("Account is full"); }
 
-    auto pKey = PrivateKey(type, index, reason);
-
-    if (false == bool(pKey)) {
-        throw std::runtime_error("Failed to generate key");
-    }
-
-    const auto& key = *pKey;
-    auto& addressMap = (data_.internal_.type_ == type) ? data_.internal_.map_
-                                                       : data_.external_.map_;
-    const auto& blockchain = parent_.ParentInternal().Parent();
-    const auto [it, added] = addressMap.emplace(
-        std::piecewise_construct,
-        std::forward_as_tuple(index),
-        std::forward_as_tuple(std::make_unique<implementation::Element>(
-            api_, blockchain, *this, chain_, type, index, key, get_contact())));
-
-    if (false == added) { throw std::runtime_error("Failed to add key"); }
-
-    return index++;
+    return add_element(lock, type, PrivateKey(type, index, reason));
 #else
     return {};
 #endif  // OT_CRYPTO_WITH_BIP32
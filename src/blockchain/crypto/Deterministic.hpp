@@ -115,6 +115,16 @@ protected:
         const Subchain type,
         Batch& generated,
         const PasswordPrompt& reason) const noexcept(false) -> void;
+    /** Derive the keys for count consecutive indices of a subchain
+     *
+     *  The output stops at the first index which could not be derived.
+     */
+    virtual auto derive_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept -> std::vector<ECKey>;
     auto element(const rLock& lock, const Subchain type, const Bip32Index index)
         const noexcept(false) -> const internal::Element&
     {
@@ -204,6 +214,10 @@ private:
         std::size_t& gap,
         Batch& generated) const noexcept(false) -> std::optional<Bip32Index>;
 #endif  // OT_CRYPTO_WITH_BIP32
+    [[nodiscard]] auto add_element(
+        const rLock& lock,
+        const Subchain type,
+        const ECKey& key) const noexcept(false) -> Bip32Index;
     auto check_activity(
         const rLock& lock,
         const std::vector<Activity>& unspent,
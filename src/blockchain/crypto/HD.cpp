@@ -8,11 +8,14 @@
 #include "blockchain/crypto/HD.hpp"  // IWYU pragma: associated
 
 #include <robin_hood.h>
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "blockchain/crypto/Deterministic.hpp"
 #include "blockchain/crypto/Element.hpp"
@@ -166,6 +169,82 @@ auto HD::account_already_exists(const rLock&) const noexcept -> bool
     return 0 < existing.count(id_->str());
 }
 
+auto HD::account_key(
+    const rLock&,
+    const Subchain type,
+    const PasswordPrompt& reason) const noexcept
+    -> const opentxs::crypto::key::HD*
+{
+#if OT_CRYPTO_WITH_BIP32
+    const auto change =
+        (internalType == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
+    auto& pKey = (internalType == type) ? cached_internal_ : cached_external_;
+
+    if (!pKey) {
+        pKey = api_.Seeds().AccountKey(path_, change, reason);
+
+        if (!pKey) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to derive account key")
+                .Flush();
+
+            return nullptr;
+        }
+    }
+
+    return pKey.get();
+#else
+
+    return nullptr;
+#endif  // OT_CRYPTO_WITH_BIP32
+}
+
+auto HD::derive_keys(
+    const rLock& lock,
+    const Subchain type,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept -> std::vector<ECKey>
+{
+    if (1u >= (count / keys_per_job_)) {
+
+        return Deterministic::derive_keys(lock, type, first, count, reason);
+    }
+
+    const auto* pKey = account_key(lock, type, reason);
+
+    if (nullptr == pKey) { return {}; }
+
+    const auto& key = *pKey;
+
+    // The account key decrypts its private key and chain code on first use,
+    // so do that here before the workers share it
+    const auto decrypted = (false == key.HasPrivate()) ||
+                           (false == key.PrivateKey(reason).empty());
+
+    if ((false == decrypted) || key.Chaincode(reason).empty()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to decrypt account key")
+            .Flush();
+
+        return {};
+    }
+
+    auto output = std::vector<ECKey>(count);
+    api::internal::ThreadPool::Get(api_).Parallel(
+        count, keys_per_job_, [&](const auto i) {
+            auto& child = output[i];
+            child = key.ChildKey(first + static_cast<Bip32Index>(i), reason);
+
+            return bool(child);
+        });
+    const auto end = std::find_if(
+        output.begin(), output.end(), [](const auto& child) {
+            return false == bool(child);
+        });
+    output.erase(end, output.end());
+
+    return output;
+}
+
 auto HD::PrivateKey(
     const Subchain type,
     const Bip32Index index,
@@ -191,27 +270,12 @@ auto HD::PrivateKey(
     }
 
 #if OT_CRYPTO_WITH_BIP32
-    const auto change =
-        (internalType == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
-    auto& pKey = (internalType == type) ? cached_internal_ : cached_external_;
     auto lock = rLock{lock_};
+    const auto* pKey = account_key(lock, type, reason);
 
-    if (!pKey) {
-        pKey = api_.Seeds().AccountKey(path_, change, reason);
-
-        if (!pKey) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to derive account key")
-                .Flush();
-
-            return {};
-        }
-    }
-
-    OT_ASSERT(pKey);
-
-    const auto& key = *pKey;
+    if (nullptr == pKey) { return {}; }
 
-    return key.ChildKey(index, reason);
+    return pKey->ChildKey(index, reason);
 #else
 
     return {};
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -87,12 +88,25 @@ public:
 
 private:
     static const VersionNumber DefaultVersion{1};
+    static constexpr auto keys_per_job_ = std::size_t{8};
 
     VersionNumber version_;
     mutable std::unique_ptr<opentxs::crypto::key::HD> cached_internal_;
     mutable std::unique_ptr<opentxs::crypto::key::HD> cached_external_;
 
     auto account_already_exists(const rLock& lock) const noexcept -> bool final;
+    auto account_key(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept
+        -> const opentxs::crypto::key::HD*;
+    auto derive_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept
+        -> std::vector<ECKey> final;
     auto save(const rLock& lock) const noexcept -> bool final;
 
     HD(const HD&) = delete;
@@ -8,6 +8,7 @@
 #include "blockchain/crypto/PaymentCode.hpp"  // IWYU pragma: associated
 
 #include <robin_hood.h>
+#include <algorithm>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -15,6 +16,7 @@
 #include <stdexcept>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "Proto.hpp"
 #include "blockchain/crypto/Deterministic.hpp"
@@ -23,6 +25,7 @@
 #include "internal/api/Api.hpp"
 #include "internal/api/client/Client.hpp"
 #include "internal/blockchain/crypto/Factory.hpp"
+#include "internal/core/Core.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
@@ -281,6 +284,46 @@ auto PaymentCode::has_private(const PasswordPrompt& reason) const noexcept
     return local_.get().AddPrivateKeys(seed, *path_.child().rbegin(), reason);
 }
 
+auto PaymentCode::derive_keys(
+    const rLock&,
+    const Subchain type,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept -> std::vector<ECKey>
+{
+    if (false == has_private(reason)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Missing private key").Flush();
+
+        return {};
+    }
+
+    const auto& local =
+        dynamic_cast<const opentxs::internal::PaymentCode&>(local_.get());
+    auto keys = [&] {
+        switch (type) {
+            case internalType: {
+                return local.OutgoingBatch(
+                    remote_, first, count, chain_, reason);
+            }
+            case externalType: {
+                return local.IncomingBatch(
+                    remote_, first, count, chain_, reason);
+            }
+            default: {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid subchain")
+                    .Flush();
+
+                return std::vector<opentxs::PaymentCode::ECKey>{};
+            }
+        }
+    }();
+    auto output = std::vector<ECKey>{};
+    output.reserve(keys.size());
+    std::move(keys.begin(), keys.end(), std::back_inserter(output));
+
+    return output;
+}
+
 auto PaymentCode::IsNotified() const noexcept -> bool
 {
     auto lock = rLock{lock_};
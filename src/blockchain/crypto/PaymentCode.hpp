@@ -144,6 +144,13 @@ private:
     const OTIdentifier contact_id_;
 
     auto account_already_exists(const rLock& lock) const noexcept -> bool final;
+    auto derive_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept
+        -> std::vector<ECKey> final;
     auto get_contact() const noexcept -> OTIdentifier final
     {
         return contact_id_;
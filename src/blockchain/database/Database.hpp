@@ -286,6 +286,11 @@ public:
     {
         return wallet_.GetOutputs(owner, node, type);
     }
+    auto GetOutputVersion(const NodeID& balanceNode, const Subchain subchain)
+        const noexcept -> std::size_t final
+    {
+        return wallet_.GetOutputVersion(balanceNode, subchain);
+    }
     auto GetPatterns(const SubchainIndex& index) const noexcept
         -> Patterns final
     {
@@ -300,10 +305,18 @@ public:
     {
         return wallet_.GetUnspentOutputs(balanceNode, subchain);
     }
-    auto GetUntestedPatterns(const SubchainIndex& index, const ReadView blockID)
-        const noexcept -> Patterns final
+    auto GetUnspentOutputs(
+        const NodeID& balanceNode,
+        const Subchain subchain,
+        const std::vector<block::Outpoint>& outpoints) const noexcept
+        -> std::vector<UTXO> final
+    {
+        return wallet_.GetUnspentOutputs(balanceNode, subchain, outpoints);
+    }
+    auto GetTestedIndices(const SubchainIndex& index, const ReadView blockID)
+        const noexcept -> MatchingIndices final
     {
-        return wallet_.GetUntestedPatterns(index, blockID);
+        return wallet_.GetTestedIndices(index, blockID);
     }
     auto HasDisconnectedChildren(const block::Hash& hash) const noexcept
         -> bool final
@@ -400,6 +413,15 @@ public:
     {
         return wallet_.ReserveUTXO(spender, proposal, policy);
     }
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Spend policy,
+        const node::internal::CoinSelection& params) const noexcept
+        -> std::vector<UTXO> final
+    {
+        return wallet_.ReserveUTXOs(spender, proposal, policy, params);
+    }
     auto SetBlockTip(const block::Position& position) const noexcept
         -> bool final
     {
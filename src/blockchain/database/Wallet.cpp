@@ -137,6 +137,15 @@ auto Wallet::GetOutputs(
     return outputs_.GetOutputs(owner, node, type);
 }
 
+auto Wallet::GetOutputVersion(
+    const NodeID& balanceNode,
+    const Subchain subchain) const noexcept -> std::size_t
+{
+    const auto id = subchains_.GetSubchainID(balanceNode, subchain);
+
+    return outputs_.GetOutputVersion(id);
+}
+
 auto Wallet::GetPatterns(const SubchainIndex& index) const noexcept -> Patterns
 {
     return subchains_.GetPatterns(index);
@@ -156,11 +165,22 @@ auto Wallet::GetUnspentOutputs(
     return outputs_.GetUnspentOutputs(id);
 }
 
-auto Wallet::GetUntestedPatterns(
+auto Wallet::GetUnspentOutputs(
+    const NodeID& balanceNode,
+    const Subchain subchain,
+    const std::vector<block::Outpoint>& outpoints) const noexcept
+    -> std::vector<UTXO>
+{
+    const auto id = subchains_.GetSubchainID(balanceNode, subchain);
+
+    return outputs_.GetUnspentOutputs(id, outpoints);
+}
+
+auto Wallet::GetTestedIndices(
     const SubchainIndex& index,
-    const ReadView blockID) const noexcept -> Patterns
+    const ReadView blockID) const noexcept -> MatchingIndices
 {
-    return subchains_.GetUntestedPatterns(index, blockID);
+    return subchains_.GetTestedIndices(index, blockID);
 }
 
 auto Wallet::LoadProposal(const Identifier& id) const noexcept
@@ -230,6 +250,22 @@ auto Wallet::ReserveUTXO(
     return outputs_.ReserveUTXO(spender, id, policy);
 }
 
+auto Wallet::ReserveUTXOs(
+    const identifier::Nym& spender,
+    const Identifier& id,
+    const Spend policy,
+    const node::internal::CoinSelection& params) const noexcept
+    -> std::vector<UTXO>
+{
+    if (false == proposals_.Exists(id)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Proposal does not exist").Flush();
+
+        return {};
+    }
+
+    return outputs_.ReserveUTXOs(spender, id, policy, params);
+}
+
 auto Wallet::SetDefaultFilterType(const FilterType type) const noexcept -> bool
 {
     return subchains_.SetDefaultFilterType(type);
@@ -154,12 +154,19 @@ public:
         const identifier::Nym& owner,
         const Identifier& node,
         State type) const noexcept -> std::vector<UTXO>;
+    auto GetOutputVersion(const NodeID& balanceNode, const Subchain subchain)
+        const noexcept -> std::size_t;
     auto GetPatterns(const SubchainIndex& index) const noexcept -> Patterns;
     auto GetUnspentOutputs() const noexcept -> std::vector<UTXO>;
     auto GetUnspentOutputs(const NodeID& balanceNode, const Subchain subchain)
         const noexcept -> std::vector<UTXO>;
-    auto GetUntestedPatterns(const SubchainIndex& index, const ReadView blockID)
-        const noexcept -> Patterns;
+    auto GetUnspentOutputs(
+        const NodeID& balanceNode,
+        const Subchain subchain,
+        const std::vector<block::Outpoint>& outpoints) const noexcept
+        -> std::vector<UTXO>;
+    auto GetTestedIndices(const SubchainIndex& index, const ReadView blockID)
+        const noexcept -> MatchingIndices;
     auto LoadProposal(const Identifier& id) const noexcept
         -> std::optional<proto::BlockchainTransactionProposal>;
     auto LoadProposals() const noexcept
@@ -175,6 +182,12 @@ public:
         const identifier::Nym& spender,
         const Identifier& proposal,
         const Spend policy) const noexcept -> std::optional<UTXO>;
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Spend policy,
+        const node::internal::CoinSelection& params) const noexcept
+        -> std::vector<UTXO>;
     auto SetDefaultFilterType(const FilterType type) const noexcept -> bool;
     auto SubchainAddElements(
         const SubchainIndex& index,
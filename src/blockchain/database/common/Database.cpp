@@ -19,6 +19,8 @@ extern "C" {
 #include <iosfwd>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -68,7 +70,16 @@ struct Database::Imp {
     const OTString common_path_;
     const OTString blocks_path_;
     storage::lmdb::LMDB lmdb_;
+    const bool sharded_;
+    std::unique_ptr<storage::lmdb::LMDB> filter_lmdb_p_;
+    storage::lmdb::LMDB& filter_lmdb_;
+#if OPENTXS_BLOCK_STORAGE_ENABLED
+    std::unique_ptr<storage::lmdb::LMDB> sync_lmdb_p_;
+    storage::lmdb::LMDB& sync_lmdb_;
+#endif  // OPENTXS_BLOCK_STORAGE_ENABLED
     Bulk bulk_;
+    std::unique_ptr<Bulk> filter_bulk_p_;
+    Bulk& filter_bulk_;
     const BlockStorage block_policy_;
     const SiphashKey siphash_key_;
     BlockHeader headers_;
@@ -163,6 +174,31 @@ struct Database::Imp {
             return BlockStorage::None;
         }
     }
+    static auto filter_tables() noexcept -> storage::lmdb::TablesToInit
+    {
+        return {
+            {Table::FilterHeadersBasic, 0},
+            {Table::FilterHeadersBCH, 0},
+            {Table::FilterHeadersOpentxs, 0},
+            {Table::Config, MDB_INTEGERKEY},
+            {Table::FilterIndexBasic, 0},
+            {Table::FilterIndexBCH, 0},
+            {Table::FilterIndexES, 0},
+        };
+    }
+    static auto sync_tables() noexcept -> storage::lmdb::TablesToInit
+    {
+        auto output = storage::lmdb::TablesToInit{
+            {Table::Config, MDB_INTEGERKEY},
+            {Table::SyncTips, MDB_INTEGERKEY},
+        };
+
+        for (const auto& [table, name] : SyncTables()) {
+            output.emplace_back(table, MDB_INTEGERKEY);
+        }
+
+        return output;
+    }
     static auto init_folder(
         const api::Legacy& legacy,
         const String& parent,
@@ -240,6 +276,47 @@ struct Database::Imp {
 
         return output;
     }
+    // Filters and sync data are written continuously by independent
+    // components. When sharding is enabled each of them gets a separate
+    // environment, and therefore a separate writer lock, along with any
+    // tables which must be updated in the same transaction. Sharding is only
+    // applied to new databases since existing data is not relocated.
+    static auto sharding(
+        const ArgList& args,
+        storage::lmdb::LMDB& lmdb) noexcept -> bool
+    {
+        auto output = std::optional<bool>{};
+        lmdb.Load(Table::Config, tsv(Key::ShardedStorage), [&](const auto in) {
+            if (1 == in.size()) {
+                output = (true_byte_ == *reinterpret_cast<const std::byte*>(
+                                            in.data()));
+            }
+        });
+
+        if (output.has_value()) { return output.value(); }
+
+        const auto existing =
+            lmdb.Exists(Table::Config, tsv(Key::BlockStoragePolicy));
+        output = (false == existing) && sharding_arg(args);
+        lmdb.Store(
+            Table::Config,
+            tsv(Key::ShardedStorage),
+            tsv(output.value() ? true_byte_ : false_byte_));
+
+        return output.value();
+    }
+    static auto sharding_arg(const ArgList& args) noexcept -> bool
+    {
+        try {
+            const auto& arg = args.at(OPENTXS_ARG_BLOCKCHAIN_SHARDING);
+
+            if (0 == arg.size()) { return true; }
+
+            return 0 != std::stoi(*arg.cbegin());
+        } catch (...) {
+            return false;
+        }
+    }
     static auto siphash_key(storage::lmdb::LMDB& db) noexcept -> SiphashKey
     {
         auto configured = siphash_key_configured(db);
@@ -338,15 +415,53 @@ struct Database::Imp {
 
                   return deleted.size();
               }())
+        , sharded_(sharding(args, lmdb_))
+        , filter_lmdb_p_([&]() -> std::unique_ptr<storage::lmdb::LMDB> {
+            if (false == sharded_) { return {}; }
+
+            return std::make_unique<storage::lmdb::LMDB>(
+                table_names_,
+                init_folder(legacy, common_path_, String::Factory("filters"))
+                    ->Get(),
+                filter_tables());
+        }())
+        , filter_lmdb_(sharded_ ? *filter_lmdb_p_ : lmdb_)
+#if OPENTXS_BLOCK_STORAGE_ENABLED
+        , sync_lmdb_p_([&]() -> std::unique_ptr<storage::lmdb::LMDB> {
+            if (false == sharded_) { return {}; }
+
+            return std::make_unique<storage::lmdb::LMDB>(
+                table_names_,
+                init_folder(legacy, common_path_, String::Factory("sync"))
+                    ->Get(),
+                sync_tables());
+        }())
+        , sync_lmdb_(sharded_ ? *sync_lmdb_p_ : lmdb_)
+#endif  // OPENTXS_BLOCK_STORAGE_ENABLED
         , bulk_(lmdb_, blocks_path_->Get())
+        , filter_bulk_p_([&]() -> std::unique_ptr<Bulk> {
+            if (false == sharded_) { return {}; }
+
+            return std::make_unique<Bulk>(
+                filter_lmdb_,
+                init_folder(legacy, common_path_, String::Factory("filters"))
+                    ->Get());
+        }())
+        , filter_bulk_(sharded_ ? *filter_bulk_p_ : bulk_)
         , block_policy_(block_storage_level(args, lmdb_))
         , siphash_key_(siphash_key(lmdb_))
         , headers_(lmdb_, bulk_)
         , peers_(api_, lmdb_)
-        , filters_(api_, lmdb_, bulk_)
+        , filters_(api_, filter_lmdb_, filter_bulk_)
 #if OPENTXS_BLOCK_STORAGE_ENABLED
         , blocks_(lmdb_, bulk_)
-        , sync_(api_, lmdb_, blocks_path_->Get())
+        , sync_(
+              api_,
+              sync_lmdb_,
+              sharded_
+                  ? init_folder(legacy, common_path_, String::Factory("sync"))
+                        ->Get()
+                  : blocks_path_->Get())
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
         , wallet_(blockchain, lmdb_, bulk_)
         , config_(api_, lmdb_)
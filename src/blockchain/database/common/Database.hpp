@@ -98,6 +98,7 @@ public:
         SiphashKey = 2,
         NextSyncAddress = 3,
         SyncServerEndpoint = 4,
+        ShardedStorage = 5,
     };
 
     using BlockHash = opentxs::blockchain::block::Hash;
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <functional>
 #include <iosfwd>
 #include <iterator>
 #include <map>
@@ -172,6 +173,18 @@ struct Output::Imp {
 
         return get_outputs(lock, states(type), &owner, &node, nullptr);
     }
+    auto GetOutputVersion(const SubchainID& id) const noexcept -> std::size_t
+    {
+        auto lock = sLock{lock_};
+
+        try {
+
+            return subchain_version_.at(id);
+        } catch (...) {
+
+            return 0;
+        }
+    }
     auto GetUnspentOutputs() const noexcept -> std::vector<UTXO>
     {
         static const auto blank = api_.Factory().Identifier();
@@ -184,6 +197,28 @@ struct Output::Imp {
 
         return get_unspent_outputs(lock, id);
     }
+    auto GetUnspentOutputs(
+        const NodeID& id,
+        const std::vector<block::Outpoint>& outpoints) const noexcept
+        -> std::vector<UTXO>
+    {
+        auto lock = sLock{lock_};
+        auto output = std::vector<UTXO>{};
+
+        for (const auto& outpoint : outpoints) {
+            if (false == has_subchain(lock, id, outpoint)) { continue; }
+
+            try {
+                const auto& [state, position, data] =
+                    find_output(lock, outpoint);
+
+                if (is_unspent(state)) { output.emplace_back(outpoint, data); }
+            } catch (...) {
+            }
+        }
+
+        return output;
+    }
 
     auto AddTransaction(
         const AccountID& account,
@@ -453,6 +488,8 @@ struct Output::Imp {
                     return false;
                 }
             }
+
+            changed(lock, outpoint);
         }
 
         const auto reason = api_.Factory().PasswordPrompt(
@@ -494,6 +531,7 @@ struct Output::Imp {
                 return false;
             }
 
+            changed(lock, id);
             proposal_reverse_index_.erase(id);
         }
 
@@ -509,6 +547,8 @@ struct Output::Imp {
 
                 return false;
             }
+
+            changed(lock, id);
         }
 
         proposal_spent_index_.erase(id);
@@ -521,28 +561,14 @@ struct Output::Imp {
         const Identifier& id,
         const Spend policy) noexcept -> std::optional<UTXO>
     {
-        // TODO implement smarter selection algorithms
         auto lock = eLock{lock_};
         auto output = std::optional<UTXO>{std::nullopt};
         const auto choose = [&](const auto outpoint) -> std::optional<UTXO> {
-            auto& serialized = find_output(lock, outpoint);
-            const auto& [state, position, data] = serialized;
+            const auto& [state, position, data] = find_output(lock, outpoint);
 
             if (false == owns(spender, data)) { return std::nullopt; }
 
-            auto output = std::make_optional<UTXO>(outpoint, data);
-            const auto changed = change_state(
-                lock, outpoint, serialized, TxoState::UnconfirmedSpend, blank_);
-
-            OT_ASSERT(changed);
-
-            proposal_spent_index_[id].emplace(outpoint);
-            proposal_reverse_index_.emplace(outpoint, id);
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": Reserving output ")(
-                outpoint.str())
-                .Flush();
-
-            return output;
+            return reserve(lock, id, outpoint);
         };
         const auto select = [&](const auto& group) -> std::optional<UTXO> {
             for (const auto& outpoint : group) {
@@ -574,6 +600,58 @@ struct Output::Imp {
 
         return output;
     }
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& id,
+        const Spend policy,
+        const CoinSelection& params) noexcept -> std::vector<UTXO>
+    {
+        auto lock = eLock{lock_};
+        const auto candidates = [&] {
+            auto out = std::vector<ValueKey>{};
+            const auto add = [&](const auto state) {
+                const auto& group = find_value(lock, state);
+
+                for (auto i = group.rbegin(); i != group.rend(); ++i) {
+                    const auto& output = find_output(lock, i->second);
+
+                    if (owns(spender, std::get<2>(output))) {
+                        out.emplace_back(*i);
+                    }
+                }
+            };
+            add(TxoState::ConfirmedNew);
+
+            if (Spend::UnconfirmedToo == policy) {
+                const auto confirmed = out.size();
+                add(TxoState::UnconfirmedNew);
+                std::inplace_merge(
+                    out.begin(),
+                    std::next(out.begin(), confirmed),
+                    out.end(),
+                    std::greater<ValueKey>{});
+            }
+
+            return out;
+        }();
+        const auto values = [&] {
+            auto out = std::vector<Amount>{};
+            out.reserve(candidates.size());
+
+            for (const auto& [value, outpoint] : candidates) {
+                out.emplace_back(value);
+            }
+
+            return out;
+        }();
+        auto output = std::vector<UTXO>{};
+
+        for (const auto index : node::internal::SelectCoins(params, values)) {
+            output.emplace_back(reserve(lock, id, candidates[index].second));
+        }
+
+        return output;
+    }
     auto Rollback(
         const eLock& lock,
         const SubchainID& subchain,
@@ -679,6 +757,13 @@ struct Output::Imp {
         , proposal_reverse_index_()
         , state_index_()
         , subchain_index_()
+        , subchain_version_()
+        , value_index_()
+        , owner_index_()
+        , totals_()
+        , account_totals_()
+        , nym_totals_()
+        , nym_account_totals_()
     {
     }
 
@@ -692,14 +777,32 @@ private:
         tuple<TxoState, block::Position, proto::BlockchainTransactionOutput>;
     using OutputMap =
         robin_hood::unordered_flat_map<Outpoint, std::unique_ptr<Output>>;
-    using AccountIndex = std::map<OTIdentifier, Outpoints>;
-    using NymIndex = std::map<OTNymID, Outpoints>;
+    using AccountIndex =
+        robin_hood::unordered_flat_map<OTIdentifier, Outpoints>;
+    using NymIndex = robin_hood::unordered_flat_map<OTNymID, Outpoints>;
     using PositionIndex = std::map<block::Position, Outpoints>;
     using ProposalIndex = std::map<OTIdentifier, Outpoints>;
     using ProposalReverseIndex = std::map<Outpoint, OTIdentifier>;
     using StateIndex = std::map<TxoState, Outpoints>;
     using SubchainIndex =
         robin_hood::unordered_flat_map<pSubchainID, Outpoints>;
+    // Incremented when outputs of a subchain change state outside of block
+    // and mempool processing
+    using SubchainVersions =
+        robin_hood::unordered_flat_map<pSubchainID, std::size_t>;
+    using ValueKey = std::pair<Amount, Outpoint>;
+    using ValueIndex = std::map<TxoState, std::set<ValueKey>>;
+    // Total value of the outputs in each state, indexed by TxoState
+    using Totals = std::array<Amount, 6>;
+    using AccountTotals = robin_hood::unordered_flat_map<OTIdentifier, Totals>;
+    using NymTotals = robin_hood::unordered_flat_map<OTNymID, Totals>;
+    // An account may hold outputs owned by more than one nym
+    using NymAccountTotals =
+        std::map<std::pair<OTNymID, OTIdentifier>, Totals>;
+    // Nyms and accounts whose totals include an outpoint
+    using OwnerIndex = robin_hood::unordered_flat_map<
+        Outpoint,
+        std::pair<std::vector<OTNymID>, std::vector<OTIdentifier>>>;
     using NymBalances = std::map<OTNymID, Balance>;
     using KeyID = blockchain::crypto::Key;
     using States = std::vector<TxoState>;
@@ -722,6 +825,13 @@ private:
     ProposalReverseIndex proposal_reverse_index_;
     StateIndex state_index_;
     SubchainIndex subchain_index_;
+    SubchainVersions subchain_version_;
+    ValueIndex value_index_;
+    OwnerIndex owner_index_;
+    Totals totals_;
+    AccountTotals account_totals_;
+    NymTotals nym_totals_;
+    NymAccountTotals nym_account_totals_;
 
     static auto owns(
         const identifier::Nym& spender,
@@ -754,6 +864,34 @@ private:
 
         return States{in};
     }
+    static auto total(Totals& totals, const TxoState state) noexcept -> Amount&
+    {
+        const auto index = static_cast<std::size_t>(state);
+
+        OT_ASSERT(index < totals.size());
+
+        return totals[index];
+    }
+    static auto total(const Totals& totals, const TxoState state) noexcept
+        -> const Amount&
+    {
+        const auto index = static_cast<std::size_t>(state);
+
+        OT_ASSERT(index < totals.size());
+
+        return totals[index];
+    }
+    static auto value(const proto::BlockchainTransactionOutput& output) noexcept
+        -> Amount
+    {
+        return static_cast<Amount>(output.value());
+    }
+    static auto value_key(
+        const Outpoint& id,
+        const proto::BlockchainTransactionOutput& output) noexcept -> ValueKey
+    {
+        return {value(output), id};
+    }
 
     auto belongs_to(
         const eLock& lock,
@@ -764,13 +902,7 @@ private:
 
         if (subchain_index_.cend() == it1) { return false; }
 
-        const auto& vector = it1->second;
-
-        for (const auto& outpoint : vector) {
-            if (id == outpoint) { return true; }
-        }
-
-        return false;
+        return 0 < it1->second.count(id);
     }
     auto effective_position(
         const TxoState state,
@@ -838,6 +970,20 @@ private:
         }
     }
     template <typename LockType>
+    auto find_value(const LockType& lock, TxoState state) const noexcept
+        -> const ValueIndex::mapped_type&
+    {
+        static const auto empty = ValueIndex::mapped_type{};
+
+        try {
+
+            return value_index_.at(state);
+        } catch (...) {
+
+            return empty;
+        }
+    }
+    template <typename LockType>
     auto find_subchain(const LockType& lock, const NodeID& id) const noexcept
         -> const Outpoints&
     {
@@ -872,42 +1018,36 @@ private:
         const identifier::Nym& owner,
         const AccountID& account) const noexcept -> Balance
     {
-        auto output = Balance{};
-        auto& [confirmed, unconfirmed] = output;
-        const auto* pNym = owner.empty() ? nullptr : &owner;
-        const auto* pAcct = account.empty() ? nullptr : &account;
-        auto cb = [&](const auto previous, const auto& outpoint) -> auto
-        {
-            const auto& [state, position, data] = find_output(lock, outpoint);
+        static const auto empty = Totals{};
+        const auto& totals = [&]() -> const Totals& {
+            if ((false == owner.empty()) && (false == account.empty())) {
+                const auto it = nym_account_totals_.find({owner, account});
 
-            return previous + data.value();
-        };
+                return (nym_account_totals_.cend() == it) ? empty
+                                                          : it->second;
+            }
 
-        const auto unconfirmedSpendTotal = [&] {
-            const auto txos =
-                match(lock, {TxoState::UnconfirmedSpend}, pNym, pAcct, nullptr);
+            if (false == account.empty()) {
+                const auto it = account_totals_.find(account);
 
-            return std::accumulate(
-                txos.begin(), txos.end(), std::uint64_t{0}, cb);
-        }();
+                return (account_totals_.cend() == it) ? empty : it->second;
+            }
 
-        {
-            const auto txos =
-                match(lock, {TxoState::ConfirmedNew}, pNym, pAcct, nullptr);
-            confirmed =
-                unconfirmedSpendTotal +
-                std::accumulate(txos.begin(), txos.end(), std::uint64_t{0}, cb);
-        }
+            if (false == owner.empty()) {
+                const auto it = nym_totals_.find(owner);
 
-        {
-            const auto txos =
-                match(lock, {TxoState::UnconfirmedNew}, pNym, pAcct, nullptr);
-            unconfirmed =
-                std::accumulate(txos.begin(), txos.end(), confirmed, cb) -
-                unconfirmedSpendTotal;
-        }
+                return (nym_totals_.cend() == it) ? empty : it->second;
+            }
 
-        return output;
+            return totals_;
+        }();
+        const auto& confirmedNew = total(totals, TxoState::ConfirmedNew);
+
+        // NOTE outputs reserved by a proposal remain in the confirmed balance
+        // until the spending transaction is confirmed
+        return {
+            confirmedNew + total(totals, TxoState::UnconfirmedSpend),
+            confirmedNew + total(totals, TxoState::UnconfirmedNew)};
     }
     template <typename LockType>
     auto get_balances(const LockType& lock) const noexcept -> NymBalances
@@ -942,14 +1082,23 @@ private:
     {
         const auto* pSub = id.empty() ? nullptr : &id;
 
-        return get_outputs(
-            lock,
-            {TxoState::UnconfirmedNew,
-             TxoState::ConfirmedNew,
-             TxoState::UnconfirmedSpend},
-            nullptr,
-            nullptr,
-            pSub);
+        return get_outputs(lock, unspent_states(), nullptr, nullptr, pSub);
+    }
+    static auto is_unspent(const TxoState state) noexcept -> bool
+    {
+        const auto& states = unspent_states();
+
+        return std::end(states) !=
+               std::find(std::begin(states), std::end(states), state);
+    }
+    static auto unspent_states() noexcept -> const States&
+    {
+        static const auto states = States{
+            TxoState::UnconfirmedNew,
+            TxoState::ConfirmedNew,
+            TxoState::UnconfirmedSpend};
+
+        return states;
     }
     template <typename LockType>
     auto has_account(
@@ -1094,9 +1243,21 @@ private:
         OT_ASSERT(false == accountID.empty());
         OT_ASSERT(false == subchainID.empty());
 
-        account_index_[accountID].emplace(outpoint);
         subchain_index_[subchainID].emplace(outpoint);
 
+        if (account_index_[accountID].emplace(outpoint).second) {
+            const auto& [state, position, data] = find_output(lock, outpoint);
+            const auto amount = value(data);
+            total(account_totals_[accountID], state) += amount;
+            auto& [nyms, accounts] = owner_index_[outpoint];
+
+            for (const auto& nym : nyms) {
+                total(nym_account_totals_[{nym, accountID}], state) += amount;
+            }
+
+            accounts.emplace_back(accountID);
+        }
+
         return true;
     }
     auto associate(
@@ -1106,10 +1267,27 @@ private:
     {
         OT_ASSERT(false == nymID.empty());
 
-        nym_index_[nymID].emplace(outpoint);
+        if (nym_index_[nymID].emplace(outpoint).second) {
+            const auto& [state, position, data] = find_output(lock, outpoint);
+            const auto amount = value(data);
+            total(nym_totals_[nymID], state) += amount;
+            auto& [nyms, accounts] = owner_index_[outpoint];
+
+            for (const auto& account : accounts) {
+                total(nym_account_totals_[{nymID, account}], state) += amount;
+            }
+
+            nyms.emplace_back(nymID);
+        }
 
         return true;
     }
+    auto changed(const eLock& lock, const Outpoint& id) noexcept -> void
+    {
+        for (const auto& [subchain, outpoints] : subchain_index_) {
+            if (0 < outpoints.count(id)) { ++subchain_version_[subchain]; }
+        }
+    }
     // Only used by CancelProposal
     auto change_state(
         const eLock& lock,
@@ -1171,6 +1349,29 @@ private:
             auto& from = state_index_[oldState];
             auto& to = state_index_[newState];
             to.insert(from.extract(id));
+            const auto key = value_key(id, data);
+            value_index_[newState].insert(
+                value_index_[oldState].extract(key));
+            const auto transfer = [&](Totals& totals) {
+                total(totals, oldState) -= key.first;
+                total(totals, newState) += key.first;
+            };
+            transfer(totals_);
+
+            if (auto it = owner_index_.find(id); owner_index_.end() != it) {
+                const auto& [nyms, accounts] = it->second;
+
+                for (const auto& nym : nyms) { transfer(nym_totals_.at(nym)); }
+
+                for (const auto& account : accounts) {
+                    transfer(account_totals_.at(account));
+
+                    for (const auto& nym : nyms) {
+                        transfer(nym_account_totals_.at({nym, account}));
+                    }
+                }
+            }
+
             oldState = newState;
         }
 
@@ -1268,6 +1469,9 @@ private:
 
         state_index_[state].emplace(id);
         position_index_[effective].emplace(id);
+        const auto key = value_key(id, std::get<2>(*outputs_.at(id)));
+        value_index_[state].emplace(key);
+        total(totals_, state) += key.first;
 
         return true;
     }
@@ -1276,6 +1480,25 @@ private:
     {
         return *outputs_.at(id);
     }
+    auto reserve(
+        const eLock& lock,
+        const Identifier& proposal,
+        const Outpoint& id) noexcept -> UTXO
+    {
+        auto& serialized = find_output(lock, id);
+        auto output = UTXO{id, std::get<2>(serialized)};
+        const auto changed = change_state(
+            lock, id, serialized, TxoState::UnconfirmedSpend, blank_);
+
+        OT_ASSERT(changed);
+
+        proposal_spent_index_[proposal].emplace(id);
+        proposal_reverse_index_.emplace(id, proposal);
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Reserving output ")(id.str())
+            .Flush();
+
+        return output;
+    }
 };
 
 Output::Output(
@@ -1366,6 +1589,12 @@ auto Output::GetMutex() const noexcept -> std::shared_mutex&
     return imp_->GetMutex();
 }
 
+auto Output::GetOutputVersion(const SubchainID& id) const noexcept
+    -> std::size_t
+{
+    return imp_->GetOutputVersion(id);
+}
+
 auto Output::GetUnspentOutputs() const noexcept -> std::vector<UTXO>
 {
     return imp_->GetUnspentOutputs();
@@ -1377,6 +1606,14 @@ auto Output::GetUnspentOutputs(const NodeID& balanceNode) const noexcept
     return imp_->GetUnspentOutputs(balanceNode);
 }
 
+auto Output::GetUnspentOutputs(
+    const NodeID& balanceNode,
+    const std::vector<block::Outpoint>& outpoints) const noexcept
+    -> std::vector<UTXO>
+{
+    return imp_->GetUnspentOutputs(balanceNode, outpoints);
+}
+
 auto Output::ReserveUTXO(
     const identifier::Nym& spender,
     const Identifier& proposal,
@@ -1385,6 +1622,15 @@ auto Output::ReserveUTXO(
     return imp_->ReserveUTXO(spender, proposal, policy);
 }
 
+auto Output::ReserveUTXOs(
+    const identifier::Nym& spender,
+    const Identifier& proposal,
+    const Spend policy,
+    const CoinSelection& params) noexcept -> std::vector<UTXO>
+{
+    return imp_->ReserveUTXOs(spender, proposal, policy, params);
+}
+
 auto Output::Rollback(
     const eLock& lock,
     const SubchainID& subchain,
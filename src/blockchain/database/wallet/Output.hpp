@@ -84,6 +84,7 @@ public:
     using FilterType = Parent::FilterType;
     using UTXO = Parent::UTXO;
     using Spend = Parent::Spend;
+    using CoinSelection = node::internal::CoinSelection;
     using State = node::Wallet::TxoState;
 
     auto CancelProposal(const Identifier& id) noexcept -> bool;
@@ -99,9 +100,14 @@ public:
         const Identifier& node,
         State type) const noexcept -> std::vector<UTXO>;
     auto GetMutex() const noexcept -> std::shared_mutex&;
+    auto GetOutputVersion(const SubchainID& id) const noexcept -> std::size_t;
     auto GetUnspentOutputs() const noexcept -> std::vector<UTXO>;
     auto GetUnspentOutputs(const NodeID& balanceNode) const noexcept
         -> std::vector<UTXO>;
+    auto GetUnspentOutputs(
+        const NodeID& balanceNode,
+        const std::vector<block::Outpoint>& outpoints) const noexcept
+        -> std::vector<UTXO>;
 
     auto AddConfirmedTransaction(
         const AccountID& account,
@@ -123,6 +129,11 @@ public:
         const identifier::Nym& spender,
         const Identifier& proposal,
         const Spend policy) noexcept -> std::optional<UTXO>;
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Spend policy,
+        const CoinSelection& params) noexcept -> std::vector<UTXO>;
     auto Rollback(
         const eLock& lock,
         const SubchainID& subchain,
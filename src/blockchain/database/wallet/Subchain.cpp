@@ -57,35 +57,38 @@ struct SubchainData::Imp {
             return {};
         }
     }
-    auto GetUntestedPatterns(
+    auto GetTestedIndices(
         const SubchainIndex& subchain,
-        const ReadView blockID) const noexcept -> Patterns
+        const ReadView blockID) const noexcept -> MatchingIndices
     {
         auto lock = Lock{lock_};
+        auto output = MatchingIndices{};
 
         try {
             const auto& allPatterns = get_patterns(lock, subchain);
-            auto effectiveIDs = std::vector<pPatternID>{};
-
-            try {
-                const auto& matchedPatterns =
-                    match_index_.at(api_.Factory().Data(blockID));
-                std::set_difference(
-                    std::begin(allPatterns),
-                    std::end(allPatterns),
-                    std::begin(matchedPatterns),
-                    std::end(matchedPatterns),
-                    std::back_inserter(effectiveIDs));
-            } catch (...) {
-
-                return load_patterns(lock, subchain, allPatterns);
+            const auto& matchedPatterns =
+                match_index_.at(api_.Factory().Data(blockID));
+            auto testedIDs = std::vector<pPatternID>{};
+            std::set_intersection(
+                std::begin(allPatterns),
+                std::end(allPatterns),
+                std::begin(matchedPatterns),
+                std::end(matchedPatterns),
+                std::back_inserter(testedIDs));
+
+            for (const auto& patternID : testedIDs) {
+                const auto& patterns = patterns_.at(patternID);
+
+                if (false == patterns.empty()) {
+                    output.emplace_back(patterns.front().first);
+                }
             }
-
-            return load_patterns(lock, subchain, effectiveIDs);
         } catch (...) {
-
-            return {};
         }
+
+        std::sort(output.begin(), output.end());
+
+        return output;
     }
     auto Reorg(
         const Lock& lock,
@@ -392,11 +395,11 @@ auto SubchainData::GetPatterns(const SubchainIndex& subchain) const noexcept
     return imp_->GetPatterns(subchain);
 }
 
-auto SubchainData::GetUntestedPatterns(
+auto SubchainData::GetTestedIndices(
     const SubchainIndex& subchain,
-    const ReadView blockID) const noexcept -> Patterns
+    const ReadView blockID) const noexcept -> MatchingIndices
 {
-    return imp_->GetUntestedPatterns(subchain, blockID);
+    return imp_->GetTestedIndices(subchain, blockID);
 }
 
 auto SubchainData::Reorg(
@@ -52,9 +52,9 @@ public:
         const noexcept -> pSubchainID;
     auto GetMutex() const noexcept -> std::mutex&;
     auto GetPatterns(const SubchainIndex& subchain) const noexcept -> Patterns;
-    auto GetUntestedPatterns(
+    auto GetTestedIndices(
         const SubchainIndex& subchain,
-        const ReadView blockID) const noexcept -> Patterns;
+        const ReadView blockID) const noexcept -> MatchingIndices;
     auto Reorg(
         const Lock& lock,
         const SubchainIndex& subchain,
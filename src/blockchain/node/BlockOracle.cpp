@@ -8,6 +8,7 @@
 #include "blockchain/node/BlockOracle.hpp"  // IWYU pragma: associated
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "blockchain/node/blockoracle/BlockDownloader.hpp"
@@ -198,10 +199,18 @@ auto BlockOracle::state_machine() noexcept -> bool
     return cache_.StateMachine();
 }
 
-auto BlockOracle::SubmitBlock(const ReadView in) const noexcept -> void
+auto BlockOracle::SubmitBlock(const network::zeromq::Frame& in) const noexcept
+    -> void
 {
     auto work = MakeWork(Task::ProcessBlock);
-    work->AddFrame(in.data(), in.size());
+    work->AddFrame(in);
+    pipeline_->Push(work);
+}
+
+auto BlockOracle::SubmitBlock(Space&& in) const noexcept -> void
+{
+    auto work = MakeWork(Task::ProcessBlock);
+    work->AddFrame(std::move(in));
     pipeline_->Push(work);
 }
 
@@ -29,6 +29,7 @@
 #include "opentxs/blockchain/node/BlockOracle.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/Metrics.hpp"
 #include "util/Work.hpp"
 
 namespace opentxs
@@ -97,7 +98,9 @@ public:
         -> BitcoinBlockFuture final;
     auto LoadBitcoin(const BlockHashes& hashes) const noexcept
         -> BitcoinBlockFutures final;
-    auto SubmitBlock(const ReadView in) const noexcept -> void final;
+    auto SubmitBlock(const network::zeromq::Frame& in) const noexcept
+        -> void final;
+    auto SubmitBlock(Space&& in) const noexcept -> void final;
     auto Tip() const noexcept -> block::Position final
     {
         return db_.BlockTip();
@@ -180,6 +183,7 @@ private:
         const internal::BlockDatabase& db_;
         const network::zeromq::socket::Publish& cache_size_publisher_;
         const blockchain::Type chain_;
+        metrics::Gauge& download_queue_;
         mutable std::mutex lock_;
         mutable Pending pending_;
         mutable Mem mem_;
@@ -52,6 +52,7 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "util/ScopeGuard.hpp"
+#include "util/Trace.hpp"
 
 #define OT_METHOD "opentxs::blockchain::node::implementation::FilterOracle::"
 
@@ -150,15 +151,6 @@ FilterOracle::FilterOracle(
         auto lock = rLock{lock_};
         new_tip(lock, type, pos);
     })
-    , thread_pool_([&] {
-        auto socket = api_.Network().ZeroMQ().PushSocket(
-            zmq::socket::Socket::Direction::Connect);
-        const auto started = socket->Start(api_.ThreadPool().Endpoint());
-
-        OT_ASSERT(started);
-
-        return socket;
-    }())
     , filter_downloader_([&]() -> std::unique_ptr<FilterDownloader> {
         if (config.download_cfilters_) {
             return std::make_unique<FilterDownloader>(
@@ -204,8 +196,7 @@ FilterOracle::FilterOracle(
                 chain,
                 default_type_,
                 shutdown,
-                cb_,
-                thread_pool_);
+                cb_);
         } else {
             return {};
         }
@@ -469,6 +460,8 @@ auto FilterOracle::ProcessBlock(BlockIndexerData& data) const noexcept -> void
     auto post = ScopeGuard{[&] { --data.job_counter_; }};
     auto& task = data.incoming_data_;
     const auto& [height, block] = task.position_;
+    OT_TRACE_SPAN(span, "index_block", "filter_oracle");
+    OT_TRACE_FLOW(span, block->Bytes());
 
     try {
         LogTrace(OT_METHOD)(__FUNCTION__)(": Calculating filter for ")(
@@ -610,12 +603,11 @@ auto FilterOracle::ProcessSyncData(
             if (false == running_) { return; }
 
             using Pool = api::internal::ThreadPool;
-            auto work = Pool::MakeWork(
-                api_.Network().ZeroMQ(),
-                value(Pool::Work::SyncDataFiltersIncoming));
+            const auto type = value(Pool::Work::SyncDataFiltersIncoming);
+            auto work = Pool::MakeWork(api_.Network().ZeroMQ(), type);
             work->AddFrame(reinterpret_cast<std::uintptr_t>(this));
             work->AddFrame(reinterpret_cast<std::uintptr_t>(&job));
-            thread_pool_->Send(work);
+            Pool::Get(api_).Submit(type, std::move(work));
             ++jobCounter;
         }
     } catch (const std::exception& e) {
@@ -289,16 +289,13 @@ auto Base::AddBlock(const std::shared_ptr<const block::bitcoin::Block> pBlock)
     const auto& block = *pBlock;
 
     try {
-        const auto bytes = [&] {
-            auto output = Space{};
+        auto bytes = Space{};
 
-            if (false == block.Serialize(writer(output))) {
-                throw std::runtime_error("Serialization error");
-            }
+        if (false == block.Serialize(writer(bytes))) {
+            throw std::runtime_error("Serialization error");
+        }
 
-            return output;
-        }();
-        block_.SubmitBlock(reader(bytes));
+        block_.SubmitBlock(std::move(bytes));
     } catch (...) {
         LogOutput(OT_METHOD)(__FUNCTION__)(
             ": failed to serialize ")(DisplayString(chain_))(" block")
@@ -552,7 +549,7 @@ auto Base::process_block(network::zeromq::Message& in) noexcept -> void
         return;
     }
 
-    block_.SubmitBlock(body.at(1).Bytes());
+    block_.SubmitBlock(body.at(1));
 }
 
 auto Base::process_filter_update(network::zeromq::Message& in) noexcept -> void
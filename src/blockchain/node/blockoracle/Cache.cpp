@@ -8,6 +8,7 @@
 #include "blockchain/node/BlockOracle.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -20,6 +21,7 @@
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/network/Network.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
 #include "opentxs/blockchain/node/BlockOracle.hpp"
 #include "opentxs/core/Log.hpp"
@@ -29,6 +31,7 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/Trace.hpp"
 
 #define OT_METHOD                                                              \
     "opentxs::blockchain::node::implementation::BlockOracle::Cache::"
@@ -49,6 +52,8 @@ BlockOracle::Cache::Cache(
     , db_(db)
     , cache_size_publisher_(socket)
     , chain_(chain)
+    , download_queue_(metrics::Registry::Get().GetGauge(
+          "blockchain." + TickerSymbol(chain) + ".block_download_queue"))
     , lock_()
     , pending_()
     , mem_(cache_limit_)
@@ -70,6 +75,7 @@ auto BlockOracle::Cache::publish(std::size_t size) const noexcept -> void
     work->AddFrame(chain_);
     work->AddFrame(size);
     cache_size_publisher_.Send(work);
+    download_queue_.Set(static_cast<std::int64_t>(size));
 }
 
 auto BlockOracle::Cache::ReceiveBlock(const zmq::Frame& in) const noexcept
@@ -80,12 +86,16 @@ auto BlockOracle::Cache::ReceiveBlock(const zmq::Frame& in) const noexcept
 
 auto BlockOracle::Cache::ReceiveBlock(BitcoinBlock_p in) const noexcept -> void
 {
+    OT_TRACE_SPAN(span, "receive_block", "block_oracle");
+
     if (false == bool(in)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid block").Flush();
 
         return;
     }
 
+    OT_TRACE_FLOW(span, in->ID().Bytes());
+
     auto lock = Lock{lock_};
     auto& block = *in;
 
@@ -12,6 +12,7 @@
 #include <optional>
 #include <stdexcept>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "blockchain/DownloadManager.hpp"
@@ -23,6 +24,7 @@
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/ThreadPool.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
 #include "opentxs/core/Flag.hpp"
@@ -31,9 +33,9 @@
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "util/JobCounter.hpp"
 #include "util/ScopeGuard.hpp"
+#include "util/Trace.hpp"
 
 #define OT_METHOD                                                              \
     "opentxs::blockchain::node::implementation::FilterOracle::BlockIndexer:"   \
@@ -51,8 +53,7 @@ FilterOracle::BlockIndexer::BlockIndexer(
     const blockchain::Type chain,
     const filter::Type type,
     const std::string& shutdown,
-    const NotifyCallback& notify,
-    zmq::socket::Push& threadPool) noexcept
+    const NotifyCallback& notify) noexcept
     : BlockDM(
           [&] { return db.FilterTip(type); }(),
           [&] {
@@ -74,7 +75,6 @@ FilterOracle::BlockIndexer::BlockIndexer(
     , chain_(chain)
     , type_(type)
     , notify_(notify)
-    , thread_pool_(threadPool)
     , job_counter_()
 {
     init_executor(
@@ -252,6 +252,7 @@ auto FilterOracle::BlockIndexer::queue_processing(
 {
     if (0u == data.size()) { return; }
 
+    OT_TRACE_SPAN(span, "queue_processing", "block_indexer");
     auto filters = std::vector<internal::FilterDatabase::Filter>{};
     auto headers = std::vector<internal::FilterDatabase::Header>{};
     auto cache = std::vector<BlockIndexerData>{};
@@ -334,11 +335,11 @@ auto FilterOracle::BlockIndexer::send_to_thread_pool(
     if (false == running_.get()) { return; }
 
     using Pool = api::internal::ThreadPool;
-    auto work = Pool::MakeWork(
-        api_.Network().ZeroMQ(), value(Pool::Work::CalculateBlockFilters));
+    const auto type = value(Pool::Work::CalculateBlockFilters);
+    auto work = Pool::MakeWork(api_.Network().ZeroMQ(), type);
     work->AddFrame(reinterpret_cast<std::uintptr_t>(&parent_));
     work->AddFrame(reinterpret_cast<std::uintptr_t>(&job));
-    thread_pool_.Send(work);
+    Pool::Get(api_).Submit(type, std::move(work));
     ++jobCounter;
 }
 
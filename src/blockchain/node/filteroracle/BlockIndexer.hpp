@@ -58,11 +58,6 @@ namespace network
 {
 namespace zeromq
 {
-namespace socket
-{
-class Push;
-}  // namespace socket
-
 class Message;
 }  // namespace zeromq
 }  // namespace network
@@ -92,8 +87,7 @@ public:
         const blockchain::Type chain,
         const filter::Type type,
         const std::string& shutdown,
-        const NotifyCallback& notify,
-        zmq::socket::Push& threadPool) noexcept;
+        const NotifyCallback& notify) noexcept;
 
     ~BlockIndexer();
 
@@ -109,7 +103,6 @@ private:
     const blockchain::Type chain_;
     const filter::Type type_;
     const NotifyCallback& notify_;
-    zmq::socket::Push& thread_pool_;
     JobCounter job_counter_;
 
     auto batch_ready() const noexcept -> void { trigger(); }
@@ -9,6 +9,7 @@
 
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "blockchain/node/wallet/DeterministicStateData.hpp"
 #include "blockchain/node/wallet/SubchainStateData.hpp"
@@ -116,13 +117,24 @@ struct Account::Imp {
 
         return output;
     }
+    auto subchains(std::vector<SubchainStateData*>& output) noexcept -> void
+    {
+        auto ticket = gatekeeper_.get();
+
+        if (ticket) { return; }
+
+        for (auto* map : {&internal_, &external_, &outgoing_, &incoming_}) {
+            for (auto& [id, subchain] : *map) {
+                output.emplace_back(&subchain);
+            }
+        }
+    }
 
     Imp(const api::Core& api,
         const api::client::internal::Blockchain& crypto,
         const BalanceTree& ref,
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
-        const zmq::socket::Push& threadPool,
         const filter::Type filter,
         Outstanding&& jobs,
         const SimpleCallback& taskFinished) noexcept
@@ -132,7 +144,6 @@ struct Account::Imp {
         , node_(node)
         , db_(db)
         , filter_type_(node_.FilterOracleInternal().DefaultType())
-        , thread_pool_(threadPool)
         , task_finished_(taskFinished)
         , internal_()
         , external_()
@@ -162,7 +173,6 @@ private:
     const node::internal::Network& node_;
     const node::internal::WalletDatabase& db_;
     const filter::Type filter_type_;
-    const network::zeromq::socket::Push& thread_pool_;
     const SimpleCallback& task_finished_;
     Map internal_;
     Map external_;
@@ -196,7 +206,6 @@ private:
             account,
             task_finished_,
             jobs_,
-            thread_pool_,
             filter_type_,
             subchain);
 
@@ -212,7 +221,6 @@ Account::Account(
     const BalanceTree& ref,
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
-    const zmq::socket::Push& threadPool,
     const filter::Type filter,
     Outstanding&& jobs,
     const SimpleCallback& taskFinished) noexcept
@@ -222,7 +230,6 @@ Account::Account(
           ref,
           node,
           db,
-          threadPool,
           filter,
           std::move(jobs),
           taskFinished))
@@ -254,5 +261,11 @@ auto Account::state_machine(bool enabled) noexcept -> bool
     return imp_->state_machine(enabled);
 }
 
+auto Account::subchains(std::vector<SubchainStateData*>& output) noexcept
+    -> void
+{
+    imp_->subchains(output);
+}
+
 Account::~Account() { imp_->shutdown(); }
 }  // namespace opentxs::blockchain::node::wallet
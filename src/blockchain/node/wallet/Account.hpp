@@ -6,6 +6,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "internal/blockchain/crypto/Crypto.hpp"
 #include "internal/blockchain/node/Node.hpp"
@@ -61,17 +62,6 @@ class SubchainStateData;
 }  // namespace node
 }  // namespace blockchain
 
-namespace network
-{
-namespace zeromq
-{
-namespace socket
-{
-class Push;
-}  // namespace socket
-}  // namespace zeromq
-}  // namespace network
-
 class Outstanding;
 }  // namespace opentxs
 
@@ -87,6 +77,8 @@ public:
     auto reorg(const block::Position& parent) noexcept -> bool;
     auto shutdown() noexcept -> void;
     auto state_machine(bool enabled) noexcept -> bool;
+    /// Append every subchain of the account to the output
+    auto subchains(std::vector<SubchainStateData*>& output) noexcept -> void;
 
     Account(
         const api::Core& api,
@@ -94,7 +86,6 @@ public:
         const BalanceTree& ref,
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
-        const network::zeromq::socket::Push& threadPool,
         const filter::Type filter,
         Outstanding&& jobs,
         const SimpleCallback& taskFinished) noexcept;
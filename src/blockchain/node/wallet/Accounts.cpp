@@ -10,6 +10,7 @@
 #include <map>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "blockchain/node/wallet/Account.hpp"
 #include "blockchain/node/wallet/NotificationStateData.hpp"
@@ -50,7 +51,6 @@ struct Accounts::Imp {
             crypto_.AccountInternal(nym, chain_),
             node_,
             db_,
-            thread_pool_,
             filter_type_,
             job_counter_.Allocate(),
             task_finished_);
@@ -123,6 +123,8 @@ struct Accounts::Imp {
             output |= account.state_machine(enabled);
         }
 
+        if (enabled) { scan(); }
+
         return output;
     }
 
@@ -130,14 +132,12 @@ struct Accounts::Imp {
         const api::client::internal::Blockchain& crypto,
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
-        const network::zeromq::socket::Push& socket,
         const Type chain,
         const SimpleCallback& taskFinished) noexcept
         : api_(api)
         , crypto_(crypto)
         , node_(node)
         , db_(db)
-        , thread_pool_(socket)
         , task_finished_(taskFinished)
         , chain_(chain)
         , filter_type_(node_.FilterOracleInternal().DefaultType())
@@ -160,7 +160,6 @@ private:
     const api::client::internal::Blockchain& crypto_;
     const node::internal::Network& node_;
     const node::internal::WalletDatabase& db_;
-    const network::zeromq::socket::Push& thread_pool_;
     const SimpleCallback& task_finished_;
     const Type chain_;
     const filter::Type filter_type_;
@@ -194,7 +193,6 @@ private:
             db_,
             task_finished_,
             pc_counter_,
-            thread_pool_,
             filter_type_,
             chain_,
             id,
@@ -206,6 +204,18 @@ private:
                 return out;
             }());
     }
+    auto scan() noexcept -> void
+    {
+        auto subchains = SubchainStateData::ScanGroup{};
+
+        for (auto& [nym, account] : map_) { account.subchains(subchains); }
+
+        for (auto& [code, account] : payment_codes_) {
+            subchains.emplace_back(&account);
+        }
+
+        SubchainStateData::queue_scan(subchains);
+    }
 };
 
 Accounts::Accounts(
@@ -213,11 +223,9 @@ Accounts::Accounts(
     const api::client::internal::Blockchain& crypto,
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
-    const network::zeromq::socket::Push& socket,
     const Type chain,
     const SimpleCallback& taskFinished) noexcept
-    : imp_(std::make_unique<
-           Imp>(api, crypto, node, db, socket, chain, taskFinished))
+    : imp_(std::make_unique<Imp>(api, crypto, node, db, chain, taskFinished))
 {
 }
 
@@ -16,6 +16,7 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <optional>
 #include <set>
 #include <sstream>
@@ -26,6 +27,7 @@
 #include <vector>
 
 #include "Proto.hpp"
+#include "internal/api/Api.hpp"
 #include "internal/api/client/Client.hpp"
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/Block.hpp"
@@ -75,7 +77,19 @@ namespace opentxs::blockchain::node::wallet
 struct BitcoinTransactionBuilder::Imp {
     auto IsFunded() const noexcept -> bool
     {
-        return input_value_ > (output_value_ + required_fee());
+        // NOTE FinalizeOutputs only creates change if the excess pays for it
+        return input_value_ >= (output_value_ + changeless_fee());
+    }
+    auto SelectionParameters() const noexcept -> node::internal::CoinSelection
+    {
+        // NOTE dust() is the fee for spending one typical input. A changeless
+        // transaction does not pay for a change output, and FinalizeOutputs
+        // gives miners any excess which does not cover the change output plus
+        // dust()
+        return {
+            output_value_ + changeless_fee(),
+            static_cast<Amount>(dust()),
+            required_fee() - changeless_fee() + static_cast<Amount>(dust())};
     }
     auto Spender() const noexcept -> const identifier::Nym&
     {
@@ -422,21 +436,43 @@ struct BitcoinTransactionBuilder::Imp {
     }
     auto SignInputs() noexcept -> bool
     {
-        auto index = int{-1};
-        auto txcopy = Transaction{};
-        auto bip143 = std::optional<bitcoin::Bip143Hashes>{};
+        auto bip143 = Bip143{};
+        auto legacy = Legacy{};
 
+        // Every preimage is built from these shared components, so they are
+        // calculated once before any input is signed
         for (const auto& [input, value] : inputs_) {
-            if (false == sign_input(++index, *input, txcopy, bip143)) {
+            if (uses_bip143(*input)) {
+                if (false == init_bip143(bip143)) {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Error instantiating bip143")
+                        .Flush();
+
+                    return false;
+                }
+
+                segwit_ |= is_segwit(*input);
+            } else if (false == init_legacy(legacy)) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": Failed to sign input ")(index)
+                    ": Error instantiating legacy sighash")
                     .Flush();
 
                 return false;
             }
         }
 
-        return true;
+        return api::internal::ThreadPool::Get(api_).Parallel(
+            inputs_.size(), inputs_per_job_, [&](const auto index) {
+                auto& input = *inputs_[index].first;
+
+                if (sign_input(index, input, bip143, legacy)) { return true; }
+
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to sign input ")(index)
+                    .Flush();
+
+                return false;
+            });
     }
 
     Imp(const api::Core& api,
@@ -502,8 +538,10 @@ private:
     using Output = std::unique_ptr<block::bitcoin::internal::Output>;
     using Bip143 = std::optional<bitcoin::Bip143Hashes>;
     using Hash = std::array<std::byte, 32>;
+    using Legacy = std::optional<bitcoin::LegacySighash>;
 
     static constexpr auto p2pkh_output_bytes_ = std::size_t{34};
+    static constexpr auto inputs_per_job_ = std::size_t{8};
 
     const api::Core& api_;
     const api::client::Blockchain& crypto_;
@@ -841,6 +879,25 @@ private:
         return fixed_overhead_ + input_count_.Size() + input_total_ +
                outputs.Size() + output_total_ + p2pkh_output_bytes_;
     }
+    auto changeless_bytes() const noexcept -> std::size_t
+    {
+        // NOTE excludes the pending change output counted by AddChange
+        const auto change = std::accumulate(
+            change_.begin(),
+            change_.end(),
+            std::size_t{0},
+            [](const auto total, const auto& output) {
+                return total + output->CalculateSize();
+            });
+        const auto outputs = bitcoin::CompactSize{outputs_.size()};
+
+        return fixed_overhead_ + input_count_.Size() + input_total_ +
+               outputs.Size() + output_total_ - change;
+    }
+    auto changeless_fee() const noexcept -> Amount
+    {
+        return (changeless_bytes() * fee_rate_) / 1000;
+    }
     auto dust() const noexcept -> std::size_t
     {
         // TODO this should account for script type
@@ -902,10 +959,10 @@ private:
         OT_ASSERT(bip143.has_value());
 
         auto& output = bip143.value();
-        auto cb = [&](const auto& preimage, auto& output) -> bool {
+        auto cb = [&](const ReadView preimage, auto& output) -> bool {
             return api_.Crypto().Hash().Digest(
                 opentxs::crypto::HashType::Sha256D,
-                reader(preimage),
+                preimage,
                 preallocated(output.size(), output.data()));
         };
 
@@ -919,7 +976,7 @@ private:
                 std::advance(it, sizeof(outpoint));
             }
 
-            if (false == cb(preimage, output.outpoints_)) {
+            if (false == cb(reader(preimage), output.outpoints_)) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to hash outpoints")
                     .Flush();
 
@@ -937,7 +994,7 @@ private:
                 std::advance(it, sizeof(sequence));
             }
 
-            if (false == cb(preimage, output.sequences_)) {
+            if (false == cb(reader(preimage), output.sequences_)) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to hash sequences")
                     .Flush();
 
@@ -948,12 +1005,13 @@ private:
         {
             auto preimage = space(output_total_);
             auto it = preimage.data();
+            output.single_.reserve(outputs_.size());
 
-            for (const auto& output : outputs_) {
-                const auto size = output->CalculateSize();
+            for (const auto& out : outputs_) {
+                const auto size = out->CalculateSize();
 
                 if (false ==
-                    output->Serialize(preallocated(size, it)).has_value()) {
+                    out->Serialize(preallocated(size, it)).has_value()) {
                     LogOutput(OT_METHOD)(__FUNCTION__)(
                         ": Failed to serialize output")
                         .Flush();
@@ -961,10 +1019,21 @@ private:
                     return false;
                 }
 
+                const auto serialized =
+                    ReadView{reinterpret_cast<const char*>(it), size};
+
+                if (false == cb(serialized, output.single_.emplace_back())) {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Failed to hash output")
+                        .Flush();
+
+                    return false;
+                }
+
                 std::advance(it, size);
             }
 
-            if (false == cb(preimage, output.outputs_)) {
+            if (false == cb(reader(preimage), output.outputs_)) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to hash outputs")
                     .Flush();
 
@@ -976,55 +1045,43 @@ private:
 
         return true;
     }
-    auto init_txcopy(Transaction& txcopy) const noexcept -> bool
+    auto init_legacy(Legacy& legacy) const noexcept -> bool
     {
-        if (txcopy) { return true; }
-
-        auto inputCopy = std::vector<Input>{};
-        std::transform(
-            std::begin(inputs_),
-            std::end(inputs_),
-            std::back_inserter(inputCopy),
-            [](const auto& input) -> auto {
-                return input.first->SignatureVersion();
-            });
-        auto inputs = factory::BitcoinTransactionInputs(std::move(inputCopy));
+        if (legacy.has_value()) { return true; }
 
-        if (false == bool(inputs)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct inputs")
-                .Flush();
+        auto success{false};
+        const auto postcondition = ScopeGuard{[&]() {
+            if (false == success) { legacy = std::nullopt; }
+        }};
+        auto& output = legacy.emplace();
+        output.outpoints_.reserve(inputs_.size());
+        output.sequences_.reserve(inputs_.size());
+        output.outputs_.reserve(outputs_.size());
 
-            return {};
+        for (const auto& [input, value] : inputs_) {
+            output.outpoints_.emplace_back(input->PreviousOutput());
+            output.sequences_.emplace_back(input->Sequence());
         }
 
-        auto outputCopy = std::vector<Output>{};
-        std::transform(
-            std::begin(outputs_),
-            std::end(outputs_),
-            std::back_inserter(outputCopy),
-            [](const auto& output) -> auto { return output->clone(); });
-        auto outputs =
-            factory::BitcoinTransactionOutputs(std::move(outputCopy));
+        for (const auto& out : outputs_) {
+            auto& bytes = output.outputs_.emplace_back(
+                space(out->CalculateSize()));
 
-        if (false == bool(outputs)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct outputs")
-                .Flush();
+            const auto serialized =
+                out->Serialize(preallocated(bytes.size(), bytes.data()));
 
-            return {};
+            if (false == serialized.has_value()) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to serialize output")
+                    .Flush();
+
+                return false;
+            }
         }
 
-        txcopy = factory::BitcoinTransaction(
-            api_,
-            crypto_,
-            chain_,
-            Clock::now(),
-            version_,
-            lock_time_,
-            false,
-            std::move(inputs),
-            std::move(outputs));
+        success = true;
 
-        return bool(txcopy);
+        return true;
     }
     auto print() const noexcept -> std::string
     {
@@ -1059,16 +1116,16 @@ private:
         return (bytes() * fee_rate_) / 1000;
     }
     auto sign_input(
-        const int index,
+        const std::size_t index,
         block::bitcoin::internal::Input& input,
-        Transaction& txcopy,
-        Bip143& bip143) const noexcept -> bool
+        const Bip143& bip143,
+        const Legacy& legacy) const noexcept -> bool
     {
         switch (chain_) {
             case Type::BitcoinCash:
             case Type::BitcoinCash_testnet3: {
 
-                return sign_input_bch(index, input, bip143);
+                return sign_input_bip143(index, input, bip143);
             }
             case Type::Bitcoin:
             case Type::Bitcoin_testnet3:
@@ -1079,10 +1136,10 @@ private:
             case Type::UnitTest: {
                 if (is_segwit(input)) {
 
-                    return sign_input_segwit(index, input, bip143);
+                    return sign_input_bip143(index, input, bip143);
                 }
 
-                return sign_input_btc(index, input, txcopy);
+                return sign_input_legacy(index, input, legacy);
             }
             case Type::Unknown:
             case Type::Ethereum_frontier:
@@ -1095,69 +1152,58 @@ private:
             }
         }
     }
-    auto sign_input_bch(
-        const int index,
+    auto sign_input_bip143(
+        const std::size_t index,
         block::bitcoin::internal::Input& input,
-        Bip143& bip143) const noexcept -> bool
+        const Bip143& bip143) const noexcept -> bool
     {
-        if (false == init_bip143(bip143)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Error instantiating bip143")
-                .Flush();
+        OT_ASSERT(bip143.has_value());
 
-            return false;
-        }
+        try {
+            const auto sigHash = blockchain::bitcoin::SigHash{chain_};
+            const auto preimage = bip143->Preimage(
+                index, version_, lock_time_, sigHash, input);
 
-        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        const auto preimage = bip143->Preimage(
-            index, outputs_.size(), version_, lock_time_, sigHash, input);
+            return add_signatures(reader(preimage), sigHash, input);
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
-        return add_signatures(reader(preimage), sigHash, input);
+            return false;
+        }
     }
-    auto sign_input_btc(
-        const int index,
+    auto sign_input_legacy(
+        const std::size_t index,
         block::bitcoin::internal::Input& input,
-        Transaction& txcopy) const noexcept -> bool
+        const Legacy& legacy) const noexcept -> bool
     {
-        if (false == init_txcopy(txcopy)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Error instantiating txcopy")
-                .Flush();
-
-            return false;
-        }
+        OT_ASSERT(legacy.has_value());
 
-        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        auto preimage = txcopy->GetPreimageBTC(index, sigHash);
+        try {
+            const auto sigHash = blockchain::bitcoin::SigHash{chain_};
+            const auto preimage = legacy->Preimage(
+                index, version_, lock_time_, sigHash, input);
 
-        if (0 == preimage.size()) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Error obtaining signing preimage")
-                .Flush();
+            return add_signatures(reader(preimage), sigHash, input);
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
             return false;
         }
-
-        std::copy(sigHash.begin(), sigHash.end(), std::back_inserter(preimage));
-
-        return add_signatures(reader(preimage), sigHash, input);
     }
-    auto sign_input_segwit(
-        const int index,
-        block::bitcoin::internal::Input& input,
-        Bip143& bip143) const noexcept -> bool
+    auto uses_bip143(const block::bitcoin::internal::Input& input)
+        const noexcept -> bool
     {
-        if (false == init_bip143(bip143)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Error instantiating bip143")
-                .Flush();
-
-            return false;
-        }
+        switch (chain_) {
+            case Type::BitcoinCash:
+            case Type::BitcoinCash_testnet3: {
 
-        segwit_ = true;
-        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        const auto preimage = bip143->Preimage(
-            index, outputs_.size(), version_, lock_time_, sigHash, input);
+                return true;
+            }
+            default: {
 
-        return add_signatures(reader(preimage), sigHash, input);
+                return is_segwit(input);
+            }
+        }
     }
     enum class Match : bool { ByValue, ByHash };
     auto validate(
@@ -1307,6 +1353,12 @@ auto BitcoinTransactionBuilder::ReleaseKeys() noexcept -> void
     return imp_->ReleaseKeys();
 }
 
+auto BitcoinTransactionBuilder::SelectionParameters() const noexcept
+    -> node::internal::CoinSelection
+{
+    return imp_->SelectionParameters();
+}
+
 auto BitcoinTransactionBuilder::SignInputs() noexcept -> bool
 {
     return imp_->SignInputs();
@@ -112,6 +112,7 @@ public:
     using Proposal = proto::BlockchainTransactionProposal;
 
     auto IsFunded() const noexcept -> bool;
+    auto SelectionParameters() const noexcept -> node::internal::CoinSelection;
     auto Spender() const noexcept -> const identifier::Nym&;
 
     auto AddChange(const Proposal& proposal) noexcept -> bool;
@@ -0,0 +1,160 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                       // IWYU pragma: associated
+#include "1_Internal.hpp"                     // IWYU pragma: associated
+#include "internal/blockchain/node/Node.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+#define OT_METHOD "opentxs::blockchain::node::internal::"
+
+namespace opentxs::blockchain::node::internal
+{
+namespace
+{
+constexpr auto max_tries_ = std::size_t{100000};
+
+using Indices = std::vector<std::size_t>;
+
+/// Exact match search over effective values sorted in descending order
+auto branch_and_bound(
+    const std::vector<Amount>& effective,
+    const Amount target,
+    const Amount limit) noexcept -> Indices
+{
+    auto available =
+        std::accumulate(effective.begin(), effective.end(), Amount{0});
+
+    if (available < target) { return {}; }
+
+    auto selected = std::vector<bool>{};
+    auto best = std::vector<bool>{};
+    auto bestWaste = std::numeric_limits<Amount>::max();
+    auto value = Amount{0};
+    selected.reserve(effective.size());
+
+    for (auto tries = std::size_t{0}; tries < max_tries_; ++tries) {
+        auto backtrack{false};
+
+        if (((value + available) < target) || (value > limit)) {
+            backtrack = true;
+        } else if (value >= target) {
+            const auto waste = value - target;
+
+            if (waste <= bestWaste) {
+                best = selected;
+                bestWaste = waste;
+
+                if (0 == waste) { break; }
+            }
+
+            backtrack = true;
+        }
+
+        if (backtrack) {
+            while ((false == selected.empty()) && (false == selected.back())) {
+                selected.pop_back();
+                available += effective[selected.size()];
+            }
+
+            if (selected.empty()) { break; }
+
+            selected.back() = false;
+            value -= effective[selected.size() - 1u];
+        } else {
+            const auto next = selected.size();
+            available -= effective[next];
+            value += effective[next];
+            selected.emplace_back(true);
+        }
+    }
+
+    auto output = Indices{};
+
+    for (auto i = std::size_t{0}; i < best.size(); ++i) {
+        if (best[i]) { output.emplace_back(i); }
+    }
+
+    return output;
+}
+
+/// Single random draw
+auto random_draw(
+    const std::vector<Amount>& effective,
+    const Amount target,
+    const Amount limit) noexcept -> Indices
+{
+    auto order = Indices(effective.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    auto random = std::random_device{};
+    std::shuffle(order.begin(), order.end(), std::mt19937_64{random()});
+    auto output = Indices{};
+    auto value = Amount{0};
+
+    for (const auto index : order) {
+        output.emplace_back(index);
+        value += effective[index];
+
+        if (value > limit) { break; }
+    }
+
+    if (value < target) { return {}; }
+
+    std::sort(output.begin(), output.end());
+
+    return output;
+}
+}  // namespace
+
+auto SelectCoins(
+    const CoinSelection& params,
+    const std::vector<Amount>& values) noexcept -> std::vector<std::size_t>
+{
+    OT_ASSERT(std::is_sorted(values.rbegin(), values.rend()));
+
+    // Candidates which do not pay for their own input are never selected
+    const auto usable = static_cast<std::size_t>(std::distance(
+        values.begin(),
+        std::find_if(values.begin(), values.end(), [&](const auto& value) {
+            return value <= params.input_fee_;
+        })));
+    auto effective = std::vector<Amount>{};
+    effective.reserve(usable);
+    std::transform(
+        values.begin(),
+        std::next(values.begin(), usable),
+        std::back_inserter(effective),
+        [&](const auto& value) { return value - params.input_fee_; });
+    const auto& target = params.target_;
+    const auto limit = target + params.cost_of_change_;
+    auto output = branch_and_bound(effective, target, limit);
+
+    if (false == output.empty()) {
+        LogTrace(OT_METHOD)(__FUNCTION__)(": Found ")(output.size())(
+            " inputs which do not require change")
+            .Flush();
+
+        return output;
+    }
+
+    output = random_draw(effective, target, limit);
+
+    if (output.empty()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Insufficient funds").Flush();
+    }
+
+    return output;
+}
+}  // namespace opentxs::blockchain::node::internal
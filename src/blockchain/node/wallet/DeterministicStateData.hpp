@@ -70,17 +70,6 @@ struct Network;
 }  // namespace node
 }  // namespace blockchain
 
-namespace network
-{
-namespace zeromq
-{
-namespace socket
-{
-class Push;
-}  // namespace socket
-}  // namespace zeromq
-}  // namespace network
-
 class Outstanding;
 }  // namespace opentxs
 
@@ -101,7 +90,6 @@ public:
         const crypto::Deterministic& subaccount,
         const SimpleCallback& taskFinished,
         Outstanding& jobCounter,
-        const zmq::socket::Push& threadPool,
         const filter::Type filter,
         const Subchain subchain) noexcept;
 
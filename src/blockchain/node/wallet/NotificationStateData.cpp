@@ -58,7 +58,6 @@ NotificationStateData::NotificationStateData(
     const WalletDatabase& db,
     const SimpleCallback& taskFinished,
     Outstanding& jobCounter,
-    const zmq::socket::Push& threadPool,
     const filter::Type filter,
     const Type chain,
     const identifier::Nym& nym,
@@ -73,7 +72,6 @@ NotificationStateData::NotificationStateData(
           calculate_id(api, chain, code),
           taskFinished,
           jobCounter,
-          threadPool,
           filter,
           Subchain::Notification)
     , path_(std::move(path))
@@ -221,7 +219,7 @@ auto NotificationStateData::index() noexcept -> void
         }
     }
 
-    db_.SubchainAddElements(index_, elements);
+    add_elements(elements);
     LogTrace(OT_METHOD)(__FUNCTION__)(
         ": Payment code ")(code_->asBase58())(" indexed")
         .Flush();
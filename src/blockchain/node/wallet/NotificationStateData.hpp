@@ -80,17 +80,6 @@ namespace identifier
 class Nym;
 }  // namespace identifier
 
-namespace network
-{
-namespace zeromq
-{
-namespace socket
-{
-class Push;
-}  // namespace socket
-}  // namespace zeromq
-}  // namespace network
-
 class Outstanding;
 class PaymentCode;
 }  // namespace opentxs
@@ -114,7 +103,6 @@ public:
         const WalletDatabase& db,
         const SimpleCallback& taskFinished,
         Outstanding& jobCounter,
-        const zmq::socket::Push& threadPool,
         const filter::Type filter,
         const Type chain,
         const identifier::Nym& nym,
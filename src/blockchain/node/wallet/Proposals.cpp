@@ -252,8 +252,26 @@ private:
             return output;
         }
 
+        using Spend = node::internal::WalletDatabase::Spend;
+
+        for (const auto& utxo : db_.ReserveUTXOs(
+                 builder.Spender(),
+                 id,
+                 Spend::ConfirmedOnly,
+                 builder.SelectionParameters())) {
+            if (false == builder.AddInput(utxo)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to add input")
+                    .Flush();
+                output = BuildResult::PermanentFailure;
+                rc = SendResult::InputCreationError;
+
+                return output;
+            }
+        }
+
+        // NOTE the selection estimates input sizes so the result may need
+        // to be topped up
         while (false == builder.IsFunded()) {
-            using Spend = node::internal::WalletDatabase::Spend;
             auto utxo =
                 db_.ReserveUTXO(builder.Spender(), id, Spend::ConfirmedOnly);
 
@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <future>
 #include <iterator>
 #include <memory>
@@ -25,10 +27,14 @@
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/ThreadPool.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/blockchain/FilterType.hpp"
 #include "opentxs/blockchain/block/Header.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Input.hpp"
+#include "opentxs/blockchain/block/bitcoin/Inputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
 #include "opentxs/blockchain/block/bitcoin/Script.hpp"
 #include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
 #include "opentxs/blockchain/crypto/Subchain.hpp"  // IWYU pragma: keep
@@ -37,11 +43,11 @@
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"  // IWYU pragma: keep
 #include "opentxs/protobuf/BlockchainWalletKey.pb.h"
 #include "util/JobCounter.hpp"
 #include "util/ScopeGuard.hpp"
+#include "util/Trace.hpp"
 
 #define OT_METHOD "opentxs::blockchain::node::wallet::SubchainStateData::"
 
@@ -103,6 +109,12 @@ auto Wallet::ProcessThreadPool(const zmq::Message& in) noexcept -> void
 
 namespace opentxs::blockchain::node::wallet
 {
+namespace
+{
+// Highest number of blocks past its first block a scan will cover
+constexpr auto scan_range_ = block::Height{9999};
+}  // namespace
+
 SubchainStateData::SubchainStateData(
     const api::Core& api,
     const api::client::internal::Blockchain& crypto,
@@ -112,7 +124,6 @@ SubchainStateData::SubchainStateData(
     OTIdentifier&& id,
     const SimpleCallback& taskFinished,
     Outstanding& jobCounter,
-    const zmq::socket::Push& threadPool,
     const filter::Type filter,
     const Subchain subchain) noexcept
     : owner_(std::move(owner))
@@ -136,8 +147,15 @@ SubchainStateData::SubchainStateData(
     , db_(db)
     , name_()
     , null_position_(make_blank<block::Position>::value(api_))
-    , thread_pool_(threadPool)
     , last_reported_(null_position_)
+    , filters_scanned_(metrics::Registry::Get().GetCounter(
+          "blockchain." + TickerSymbol(node_.Chain()) +
+          ".wallet.filters_scanned"))
+    , scan_time_(metrics::Registry::Get().GetHistogram(
+          "blockchain." + TickerSymbol(node_.Chain()) + ".wallet.scan"))
+    , account_targets_()
+    , output_version_()
+    , scan_group_()
 {
     OT_ASSERT(task_finished_);
     OT_ASSERT(false == owner_->empty());
@@ -206,6 +224,46 @@ auto SubchainStateData::ReorgQueue::Next() noexcept -> block::Position
     return output;
 }
 
+auto SubchainStateData::add_elements(
+    const WalletDatabase::ElementMap& elements) noexcept -> bool
+{
+    if (false == db_.SubchainAddElements(index_, elements)) { return false; }
+
+    if (false == account_targets_.has_value()) { return true; }
+
+    auto& [patterns, utxos, targets] = account_targets_.value();
+
+    for (const auto& [index, list] : elements) {
+        for (const auto& pattern : list) {
+            patterns.emplace_back(
+                WalletDatabase::ElementID{index, {subchain_, id_}}, pattern);
+        }
+    }
+
+    // Targets are views of the patterns so they must be rebuilt after the
+    // pattern vector changes
+    targets.clear();
+    get_targets(patterns, utxos, targets);
+
+    return true;
+}
+
+auto SubchainStateData::changed_outpoints(
+    const block::bitcoin::Transaction& tx,
+    Outpoints& output) noexcept -> void
+{
+    for (const auto& input : tx.Inputs()) {
+        output.emplace_back(input.PreviousOutput());
+    }
+
+    const auto txid = tx.ID().Bytes();
+    const auto count = tx.Outputs().size();
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        output.emplace_back(txid, static_cast<std::uint32_t>(i));
+    }
+}
+
 auto SubchainStateData::check_blocks() noexcept -> bool
 {
     auto h{blocks_to_request_.begin()};
@@ -234,16 +292,19 @@ auto SubchainStateData::check_blocks() noexcept -> bool
 
 auto SubchainStateData::check_mempool() noexcept -> void
 {
-    const auto targets = get_account_targets();
-    const auto [elements, utxos, patterns] = targets;
-    const auto parsed = block::Block::ParsedPatterns{elements};
+    if (mempool_.Empty()) { return; }
+
+    const auto& targets = get_account_targets();
+    const auto parsed = block::Block::ParsedPatterns{targets.elements_};
     const auto outpoints = [&] {
         auto out = Patterns{};
-        translate(std::get<1>(targets), out);
+        translate(targets.utxos_, out);
 
         return out;
     }();
 
+    auto changed = Outpoints{};
+
     while (false == mempool_.Empty()) {
         const auto tx = mempool_.Next();
 
@@ -254,8 +315,16 @@ auto SubchainStateData::check_mempool() noexcept -> void
         OT_ASSERT(copy);
 
         const auto matches = copy->FindMatches(filter_type_, outpoints, parsed);
+        const auto& [utxo, general] = matches;
+
+        if ((0u < utxo.size()) || (0u < general.size())) {
+            changed_outpoints(*copy, changed);
+        }
+
         handle_mempool_matches(matches, std::move(copy));
     }
+
+    update_utxos(std::move(changed));
 }
 
 auto SubchainStateData::check_process() noexcept -> bool
@@ -274,7 +343,7 @@ auto SubchainStateData::check_process() noexcept -> bool
         return queue_work(Task::process, job);
     } else {
         LogVerbose(OT_METHOD)(__FUNCTION__)(
-            ": ")(name_)(" waiting for block ")(id->asHex())(" to download")
+            ": ")(name_)(" waiting for block ")(id)(" to download")
             .Flush();
     }
 
@@ -290,60 +359,6 @@ auto SubchainStateData::check_reorg() noexcept -> bool
     return queue_work(Task::reorg, job);
 }
 
-auto SubchainStateData::check_scan() noexcept -> bool
-{
-    auto needScan{false};
-
-    if (last_scanned_.has_value()) {
-        const auto bestFilter =
-            node_.FilterOracleInternal().FilterTip(filter_type_);
-
-        if (last_scanned_ == bestFilter) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(
-                ": ")(name_)(" has been scanned to the newest downloaded "
-                             "filter ")(bestFilter.second
-                                            ->asHex())(" at "
-                                                       "height"
-                                                       " ")(bestFilter.first)
-                .Flush();
-        } else {
-            const auto [ancestor, best] =
-                node_.HeaderOracleInternal().CommonParent(
-                    last_scanned_.value());
-            last_scanned_ = ancestor;
-
-            if (last_scanned_ == best) {
-                LogVerbose(OT_METHOD)(__FUNCTION__)(
-                    ": ")(name_)(" has been scanned to current best "
-                                 "block ")(best.second
-                                               ->asHex())(" at height ")(best.first)
-                    .Flush();
-            } else {
-                needScan = true;
-                LogVerbose(OT_METHOD)(__FUNCTION__)(
-                    ": ")(name_)(" scanning progress: ")(last_scanned_.value()
-                                                             .first)
-                    .Flush();
-            }
-        }
-    } else {
-        needScan = true;
-        LogVerbose(OT_METHOD)(__FUNCTION__)(
-            ": ")(name_)(" scanning progress: ")(0)
-            .Flush();
-    }
-
-    if (needScan) {
-        static constexpr auto job{"scan"};
-
-        return queue_work(Task::scan, job);
-    } else {
-        report_scan();
-    }
-
-    return false;
-}
-
 auto SubchainStateData::describe() const noexcept -> std::string
 {
     auto out = type();
@@ -378,43 +393,61 @@ auto SubchainStateData::describe() const noexcept -> std::string
     return out.str();
 }
 
-auto SubchainStateData::get_account_targets() const noexcept
-    -> std::tuple<Patterns, UTXOs, Targets>
+auto SubchainStateData::get_account_targets() noexcept
+    -> const AccountTargets&
 {
-    auto out = std::tuple<Patterns, UTXOs, Targets>{};
-    auto& [elements, utxos, targets] = out;
-    elements = db_.GetPatterns(index_);
-    utxos = db_.GetUnspentOutputs(id_, subchain_);
-    get_targets(elements, utxos, targets);
+    if (false == account_targets_.has_value()) {
+        account_targets_.emplace().elements_ = db_.GetPatterns(index_);
+        load_utxos();
+    } else if (db_.GetOutputVersion(id_, subchain_) != output_version_) {
+        // A proposal was cancelled or otherwise changed outputs which this
+        // subchain did not process itself
+        load_utxos();
+    }
 
-    return out;
+    return account_targets_.value();
 }
 
+// NOTE: this version is for matching before a block is downloaded
 auto SubchainStateData::get_block_targets(
     const block::Hash& id,
-    const UTXOs& utxos) const noexcept -> std::pair<Patterns, Targets>
+    const AccountTargets& cache) const noexcept -> Targets
 {
-    auto out = std::pair<Patterns, Targets>{};
-    auto& [elements, targets] = out;
-    elements = db_.GetUntestedPatterns(index_, id.Bytes());
-    get_targets(elements, utxos, targets);
+    const auto& all = cache.targets_;
+    const auto positions = untested_elements(id, cache);
+    auto output = Targets{};
+    output.reserve(positions.size() + all.size() - cache.elements_.size());
 
-    return out;
+    for (const auto pos : positions) { output.emplace_back(all.at(pos)); }
+
+    for (auto i = cache.elements_.size(); i < all.size(); ++i) {
+        output.emplace_back(all.at(i));
+    }
+
+    return output;
 }
 
-auto SubchainStateData::get_block_targets(const block::Hash& id, Tested& tested)
-    const noexcept -> std::tuple<Patterns, UTXOs, Targets, Patterns>
+// NOTE: this version is for matching after a block is downloaded
+auto SubchainStateData::get_block_targets(
+    const block::Hash& id,
+    const AccountTargets& cache,
+    Positions& positions,
+    Tested& tested) const noexcept -> Targets
 {
-    auto out = std::tuple<Patterns, UTXOs, Targets, Patterns>{};
-    auto& [elements, utxos, targets, outpoints] = out;
-    elements = db_.GetUntestedPatterns(index_, id.Bytes());
-    utxos = db_.GetUnspentOutputs(id_, subchain_);
-    get_targets(elements, utxos, targets, outpoints, tested);
+    positions = untested_elements(id, cache);
+    auto output = Targets{};
+    output.reserve(positions.size());
+    tested.reserve(positions.size());
+
+    for (const auto pos : positions) {
+        const auto& [elementID, data] = cache.elements_.at(pos);
+        output.emplace_back(cache.targets_.at(pos));
+        tested.emplace_back(elementID.first);
+    }
 
-    return out;
+    return output;
 }
 
-// NOTE: this version is for matching before a block is downloaded
 auto SubchainStateData::get_targets(
     const Patterns& elements,
     const std::vector<WalletDatabase::UTXO>& utxos,
@@ -440,27 +473,6 @@ auto SubchainStateData::get_targets(
     }
 }
 
-// NOTE: this version is for matching after a block is downloaded
-auto SubchainStateData::get_targets(
-    const Patterns& elements,
-    const std::vector<WalletDatabase::UTXO>& utxos,
-    Targets& targets,
-    Patterns& outpoints,
-    Tested& tested) const noexcept -> void
-{
-    targets.reserve(elements.size());
-    outpoints.reserve(utxos.size());
-
-    for (const auto& element : elements) {
-        const auto& [id, data] = element;
-        const auto& [index, subchain] = id;
-        targets.emplace_back(reader(data));
-        tested.emplace_back(index);
-    }
-
-    translate(utxos, outpoints);
-}
-
 auto SubchainStateData::index_element(
     const filter::Type type,
     const blockchain::crypto::Element& input,
@@ -508,6 +520,61 @@ auto SubchainStateData::init() noexcept -> void
     mempool_.Queue(std::move(transactions));
 }
 
+auto SubchainStateData::load_utxos() noexcept -> void
+{
+    if (false == account_targets_.has_value()) { return; }
+
+    auto& [elements, utxos, targets] = account_targets_.value();
+    output_version_ = db_.GetOutputVersion(id_, subchain_);
+    utxos = db_.GetUnspentOutputs(id_, subchain_);
+    targets.clear();
+    get_targets(elements, utxos, targets);
+}
+
+auto SubchainStateData::need_scan() noexcept -> bool
+{
+    auto needScan{false};
+
+    if (last_scanned_.has_value()) {
+        const auto bestFilter =
+            node_.FilterOracleInternal().FilterTip(filter_type_);
+
+        if (last_scanned_ == bestFilter) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(
+                " has been scanned to the newest downloaded filter ")(
+                bestFilter.second)(" at height ")(bestFilter.first)
+                .Flush();
+        } else {
+            const auto [ancestor, best] =
+                node_.HeaderOracleInternal().CommonParent(
+                    last_scanned_.value());
+            last_scanned_ = ancestor;
+
+            if (last_scanned_ == best) {
+                LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(
+                    " has been scanned to current best block ")(best.second)(
+                    " at height ")(best.first)
+                    .Flush();
+            } else {
+                needScan = true;
+                LogVerbose(OT_METHOD)(__FUNCTION__)(
+                    ": ")(name_)(" scanning progress: ")(last_scanned_.value()
+                                                             .first)
+                    .Flush();
+            }
+        }
+    } else {
+        needScan = true;
+        LogVerbose(OT_METHOD)(__FUNCTION__)(
+            ": ")(name_)(" scanning progress: ")(0)
+            .Flush();
+    }
+
+    if (false == needScan) { report_scan(); }
+
+    return needScan;
+}
+
 auto SubchainStateData::process() noexcept -> void
 {
     const auto start = Clock::now();
@@ -518,11 +585,13 @@ auto SubchainStateData::process() noexcept -> void
         process_block_queue_.pop();
     }};
     const auto& blockHash = it->first.get();
+    OT_TRACE_SPAN(span, "process_block", "wallet");
+    OT_TRACE_FLOW(span, blockHash.Bytes());
     const auto pBlock = it->second.get();
 
     if (false == bool(pBlock)) {
         LogVerbose(OT_METHOD)(__FUNCTION__)(
-            ": ")(name_)(" invalid block ")(blockHash.asHex())
+            ": ")(name_)(" invalid block ")(blockHash)
             .Flush();
         auto& vector = blocks_to_request_;
         vector.emplace(vector.begin(), blockHash);
@@ -531,9 +600,17 @@ auto SubchainStateData::process() noexcept -> void
     }
 
     const auto& block = *pBlock;
+    const auto& cache = get_account_targets();
+    auto positions = Positions{};
     auto tested = WalletDatabase::MatchingIndices{};
-    auto [elements, utxos, targets, outpoints] =
-        get_block_targets(blockHash, tested);
+    const auto targets =
+        get_block_targets(blockHash, cache, positions, tested);
+    const auto outpoints = [&] {
+        auto out = Patterns{};
+        translate(cache.utxos_, out);
+
+        return out;
+    }();
     const auto pFilter = filters.LoadFilter(filter_type_, blockHash);
 
     OT_ASSERT(pFilter);
@@ -543,9 +620,9 @@ auto SubchainStateData::process() noexcept -> void
 
     for (const auto& it : filter.Match(targets)) {
         // NOTE GCS::Match returns const_iterators to items in the input vector
-        const auto pos = std::distance(targets.cbegin(), it);
-        auto& [id, element] = elements.at(pos);
-        potential.emplace_back(std::move(id), std::move(element));
+        const auto pos = static_cast<std::size_t>(
+            std::distance(targets.cbegin(), it));
+        potential.emplace_back(cache.elements_.at(positions.at(pos)));
     }
 
     const auto confirmed =
@@ -559,10 +636,25 @@ auto SubchainStateData::process() noexcept -> void
     const auto& header = *pHeader;
     const auto position = header.Position();
     handle_confirmed_matches(block, position, confirmed);
+    auto txids = std::set<block::pTxid>{};
+    auto changed = Outpoints{};
+
+    for (const auto& [txid, outpoint, element] : utxo) { txids.emplace(txid); }
+
+    for (const auto& [txid, element] : general) { txids.emplace(txid); }
+
+    for (const auto& txid : txids) {
+        const auto pTx = block.at(txid->Bytes());
+
+        OT_ASSERT(pTx);
+
+        changed_outpoints(*pTx, changed);
+    }
+
+    update_utxos(std::move(changed));
     const auto [balance, unconfirmed] = db_.GetBalance();
     LogVerbose(OT_METHOD)(__FUNCTION__)(
-        ": ")(name_)(" block ")(block.ID()
-                                    .asHex())(" processed in ")(std::chrono::duration_cast<
+        ": ")(name_)(" block ")(block.ID())(" processed in ")(std::chrono::duration_cast<
                                                                     std::chrono::
                                                                         milliseconds>(
                                                                     Clock::
@@ -587,6 +679,71 @@ auto SubchainStateData::process() noexcept -> void
     }
 }
 
+auto SubchainStateData::queue_scan(const ScanGroup& subchains) noexcept -> bool
+{
+    auto candidates = ScanGroup{};
+
+    for (auto* subchain : subchains) {
+        OT_ASSERT(nullptr != subchain);
+
+        if (subchain->running_.load()) { continue; }
+
+        if (subchain->need_scan()) { candidates.emplace_back(subchain); }
+    }
+
+    if (candidates.empty()) { return false; }
+
+    const auto best =
+        candidates.front()->node_.HeaderOracleInternal().BestChain().first;
+    auto starts = std::map<const SubchainStateData*, block::Height>{};
+
+    for (const auto* subchain : candidates) {
+        starts.emplace(subchain, subchain->scan_start(best));
+    }
+
+    std::stable_sort(
+        candidates.begin(), candidates.end(), [&](auto* lhs, auto* rhs) {
+            if (lhs->filter_type_ != rhs->filter_type_) {
+                return lhs->filter_type_ < rhs->filter_type_;
+            }
+
+            return starts.at(lhs) < starts.at(rhs);
+        });
+    auto output{false};
+    auto it = candidates.begin();
+
+    while (candidates.end() != it) {
+        auto& leader = **it;
+        const auto limit = starts.at(&leader) + scan_range_;
+        auto& group = leader.scan_group_;
+
+        OT_ASSERT(group.empty());
+
+        for (++it; candidates.end() != it; ++it) {
+            auto* subchain = *it;
+
+            if (subchain->filter_type_ != leader.filter_type_) { break; }
+
+            if (starts.at(subchain) > limit) { break; }
+
+            subchain->running_.store(true);
+            group.emplace_back(subchain);
+        }
+
+        static constexpr auto job{"scan"};
+
+        if (leader.queue_work(Task::scan, job)) {
+            output = true;
+        } else {
+            for (auto* subchain : group) { subchain->running_.store(false); }
+
+            group.clear();
+        }
+    }
+
+    return output;
+}
+
 auto SubchainStateData::queue_work(const Task task, const char* log) noexcept
     -> bool
 {
@@ -600,13 +757,13 @@ auto SubchainStateData::queue_work(const Task task, const char* log) noexcept
     }
 
     using Pool = api::internal::ThreadPool;
-    auto work = Pool::MakeWork(
-        api_.Network().ZeroMQ(), value(Pool::Work::BlockchainWallet));
+    const auto type = value(Pool::Work::BlockchainWallet);
+    auto work = Pool::MakeWork(api_.Network().ZeroMQ(), type);
     work->AddFrame(task);
     work->AddFrame(reinterpret_cast<std::uintptr_t>(this));
     running_.store(true);
 
-    if (thread_pool_.Send(work)) {
+    if (Pool::Get(api_).Submit(type, std::move(work))) {
         LogDebug(OT_METHOD)(__FUNCTION__)(": ")(name_)(" ")(log)(" job queued")
             .Flush();
         ++job_counter_;
@@ -630,6 +787,8 @@ auto SubchainStateData::reorg() noexcept -> void
         db_.ReorgTo(id_, subchain_, index_, reorg);
     }
 
+    load_utxos();
+
     const auto scannedTarget =
         node_.HeaderOracleInternal()
             .CommonParent(db_.SubchainLastScanned(index_))
@@ -660,31 +819,64 @@ auto SubchainStateData::report_scan() noexcept -> void
 
 auto SubchainStateData::scan() noexcept -> void
 {
+    struct Scan {
+        SubchainStateData* subchain_;
+        block::Height start_;
+        const AccountTargets* targets_;
+        std::vector<block::pHash> cache_;
+    };
+
+    const auto timer = metrics::Timer{scan_time_};
+    OT_TRACE_SPAN(span, "scan", "wallet");
     const auto start = Clock::now();
     const auto& headers = node_.HeaderOracleInternal();
     const auto& filters = node_.FilterOracleInternal();
     const auto best = headers.BestChain();
-    const auto startHeight = std::min(
-        best.first,
-        last_scanned_.has_value() ? last_scanned_.value().first + 1 : 0);
-    const auto first =
-        last_scanned_.has_value()
-            ? block::Position{startHeight, headers.BestHash(startHeight)}
-            : block::Position{0, headers.BestHash(0)};
+    auto group = ScanGroup{};
+    group.swap(scan_group_);
+    auto postcondition = ScopeGuard{[&] {
+        for (auto* subchain : group) { subchain->running_.store(false); }
+    }};
+    auto scans = std::vector<Scan>{};
+    scans.reserve(group.size() + 1u);
+    scans.push_back(
+        Scan{this, scan_start(best.first), &get_account_targets(), {}});
+
+    for (auto* subchain : group) {
+        scans.push_back(Scan{
+            subchain,
+            subchain->scan_start(best.first),
+            &subchain->get_account_targets(),
+            {}});
+    }
+
+    std::stable_sort(
+        scans.begin(), scans.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.start_ < rhs.start_;
+        });
+    const auto startHeight = scans.front().start_;
     const auto stopHeight = std::min(
-        std::min(startHeight + 9999, best.first),
+        std::min(startHeight + scan_range_, best.first),
         filters.FilterTip(filter_type_).first);
-    LogVerbose(OT_METHOD)(__FUNCTION__)(
-        ": ")(name_)(" scanning filters from ")(startHeight)(" to ")(stopHeight)
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(" scanning filters for ")(
+        scans.size())(" subchains from ")(startHeight)(" to ")(stopHeight)
         .Flush();
-    const auto [elements, utxos, patterns] = get_account_targets();
-    auto highestTested = last_scanned_.value_or(null_position_);
+    // Targets of every subchain whose scan has started, and the end of the
+    // range of targets which belongs to each of those subchains
+    auto targets = Targets{};
+    auto ends = std::vector<std::size_t>{};
+    auto highestTested = null_position_;
     auto atLeastOnce{false};
-    auto blockHash = api_.Factory().Data();
-    auto cache = decltype(blocks_to_request_){};
 
     for (auto i{startHeight}; i <= stopHeight; ++i) {
-        blockHash = headers.BestHash(i);
+        while ((ends.size() < scans.size()) &&
+               (scans.at(ends.size()).start_ <= i)) {
+            const auto& next = scans.at(ends.size()).targets_->targets_;
+            targets.insert(targets.end(), next.begin(), next.end());
+            ends.emplace_back(targets.size());
+        }
+
+        const auto blockHash = headers.BestHash(i);
         const auto pFilter = filters.LoadFilterOrResetTip(
             filter_type_, block::Position{i, blockHash});
 
@@ -700,69 +892,73 @@ auto SubchainStateData::scan() noexcept -> void
         highestTested.first = i;
         highestTested.second = blockHash;
         const auto& filter = *pFilter;
-        auto matches = filter.Match(patterns);
-        const auto size{matches.size()};
+        auto matched = std::vector<bool>(ends.size(), false);
+        filters_scanned_.Add();
+
+        for (const auto& it : filter.Match(targets)) {
+            // NOTE GCS::Match returns const_iterators to items in the input
+            // vector
+            const auto pos =
+                static_cast<std::size_t>(std::distance(targets.cbegin(), it));
+            const auto owner =
+                std::upper_bound(ends.cbegin(), ends.cend(), pos);
+            matched.at(static_cast<std::size_t>(
+                std::distance(ends.cbegin(), owner))) = true;
+        }
 
-        if (0 < matches.size()) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(
-                ": ")(name_)(" GCS for block ")(blockHash
-                                                    ->asHex())(" at "
-                                                               "height"
-                                                               " ")(i)(" m"
-                                                                       "at"
-                                                                       "ch"
-                                                                       "es"
-                                                                       " a"
-                                                                       "t "
-                                                                       "le"
-                                                                       "as"
-                                                                       "t "
-                                                                       "on"
-                                                                       "e "
-                                                                       "of"
-                                                                       " t"
-                                                                       "he"
-                                                                       " ")(patterns
-                                                                                .size())(" target elements for ")(id_)
-                .Flush();
-            const auto [untested, retest] = get_block_targets(blockHash, utxos);
-            matches = filter.Match(retest);
-            LogVerbose(OT_METHOD)(__FUNCTION__)(
-                ": ")(name_)(" ")(matches
-                                      .size())(" of ")(size)(" matches are new")
+        for (auto n = std::size_t{0}; n < matched.size(); ++n) {
+            if (false == matched.at(n)) { continue; }
+
+            auto& scan = scans.at(n);
+            const auto& subchain = *scan.subchain_;
+            const auto retest =
+                subchain.get_block_targets(blockHash, *scan.targets_);
+            const auto matches = filter.Match(retest).size();
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(subchain.name_)(
+                " GCS for block ")(blockHash)(" at height ")(i)(" matches ")(
+                matches)(" new target elements")
                 .Flush();
 
-            if (0 < matches.size()) {
-                cache.emplace_back(std::move(blockHash));
-            }
+            if (0 < matches) { scan.cache_.emplace_back(blockHash); }
         }
     }
 
-    if (atLeastOnce) {
-        const auto count = cache.size();
+    if (false == atLeastOnce) {
         LogVerbose(OT_METHOD)(__FUNCTION__)(
-            ": ")(name_)(" found ")(count)(" potential matches between "
-                                           "blocks ")(startHeight)(" and"
-                                                                   " ")(highestTested
-                                                                            .first)(" in ")(std::chrono::duration_cast<
-                                                                                                std::chrono::
-                                                                                                    milliseconds>(
-                                                                                                Clock::
-                                                                                                    now() -
-                                                                                                start)
-                                                                                                .count())(
+            ": ")(name_)(" scan interrupted due to missing filter")
+            .Flush();
+
+        return;
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - start);
+
+    for (auto& scan : scans) {
+        if (scan.start_ > highestTested.first) { continue; }
+
+        auto& subchain = *scan.subchain_;
+        auto& cache = scan.cache_;
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(subchain.name_)(" found ")(
+            cache.size())(" potential matches between blocks ")(scan.start_)(
+            " and ")(highestTested.first)(" in ")(elapsed.count())(
             " milliseconds")
             .Flush();
         std::move(
-            cache.begin(), cache.end(), std::back_inserter(blocks_to_request_));
-        last_scanned_ = std::move(highestTested);
-    } else {
-        LogVerbose(OT_METHOD)(__FUNCTION__)(
-            ": ")(name_)(" scan interrupted due to missing filter")
-            .Flush();
+            cache.begin(),
+            cache.end(),
+            std::back_inserter(subchain.blocks_to_request_));
+        subchain.last_scanned_ = highestTested;
     }
 }
 
+auto SubchainStateData::scan_start(const block::Height best) const noexcept
+    -> block::Height
+{
+    return std::min(
+        best, last_scanned_.has_value() ? last_scanned_.value().first + 1 : 0);
+}
+
 auto SubchainStateData::set_key_data(
     block::bitcoin::Transaction& tx) const noexcept -> void
 {
@@ -796,7 +992,6 @@ auto SubchainStateData::state_machine(bool enabled) noexcept -> bool
     check_mempool();
 
     if (enabled) {
-        if (check_scan()) { return false; }
         if (check_process()) { return false; }
     }
 
@@ -844,8 +1039,61 @@ auto SubchainStateData::translate(
     }
 }
 
+auto SubchainStateData::untested_elements(
+    const block::Hash& id,
+    const AccountTargets& cache) const noexcept -> Positions
+{
+    const auto tested = db_.GetTestedIndices(index_, id.Bytes());
+    const auto& elements = cache.elements_;
+    auto output = Positions{};
+    output.reserve(elements.size());
+
+    for (auto i = std::size_t{0}; i < elements.size(); ++i) {
+        const auto& [elementID, data] = elements.at(i);
+
+        if (std::binary_search(tested.begin(), tested.end(), elementID.first)) {
+            continue;
+        }
+
+        output.emplace_back(i);
+    }
+
+    return output;
+}
+
+auto SubchainStateData::update_utxos(Outpoints&& outpoints) noexcept -> void
+{
+    if (outpoints.empty() || (false == account_targets_.has_value())) {
+        return;
+    }
+
+    std::sort(outpoints.begin(), outpoints.end());
+    outpoints.erase(
+        std::unique(outpoints.begin(), outpoints.end()), outpoints.end());
+    auto& [elements, utxos, targets] = account_targets_.value();
+    utxos.erase(
+        std::remove_if(
+            utxos.begin(),
+            utxos.end(),
+            [&](const auto& utxo) {
+                return std::binary_search(
+                    outpoints.begin(), outpoints.end(), utxo.first);
+            }),
+        utxos.end());
+    auto updated = db_.GetUnspentOutputs(id_, subchain_, outpoints);
+    std::move(updated.begin(), updated.end(), std::back_inserter(utxos));
+    // Targets are views of the unspent outputs so they must be rebuilt after
+    // the vector changes
+    targets.clear();
+    get_targets(elements, utxos, targets);
+}
+
 SubchainStateData::~SubchainStateData()
 {
-    while (0 < job_counter_) { Sleep(std::chrono::microseconds(100)); }
+    // A subchain in a scan group is marked as running without incrementing
+    // its own job counter
+    while (running_ || (0 < job_counter_)) {
+        Sleep(std::chrono::microseconds(100));
+    }
 }
 }  // namespace opentxs::blockchain::node::wallet
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -25,6 +26,7 @@
 #include "opentxs/blockchain/FilterType.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/blockchain/block/Block.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
 #include "opentxs/blockchain/block/bitcoin/Script.hpp"
 #include "opentxs/blockchain/crypto/Subaccount.hpp"
 #include "opentxs/blockchain/node/BlockOracle.hpp"
@@ -33,6 +35,7 @@
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/crypto/Types.hpp"
+#include "util/Metrics.hpp"
 
 namespace opentxs
 {
@@ -79,17 +82,6 @@ class ScriptForm;
 }  // namespace node
 }  // namespace blockchain
 
-namespace network
-{
-namespace zeromq
-{
-namespace socket
-{
-class Push;
-}  // namespace socket
-}  // namespace zeromq
-}  // namespace network
-
 class Outstanding;
 }  // namespace opentxs
 
@@ -103,6 +95,7 @@ public:
     using OutstandingMap =
         std::map<block::pHash, BlockOracle::BitcoinBlockFuture>;
     using ProcessQueue = std::queue<OutstandingMap::iterator>;
+    using ScanGroup = std::vector<SubchainStateData*>;
     using SubchainIndex = WalletDatabase::pSubchainIndex;
     using Transactions =
         std::vector<std::shared_ptr<const block::bitcoin::Transaction>>;
@@ -156,6 +149,14 @@ public:
 
     auto state_machine(bool enabled) noexcept -> bool;
 
+    /** Queue filter scans for every idle subchain which needs one
+     *
+     *  Subchains whose scans start within the same range of blocks are
+     *  grouped and a single job scans for the whole group, so each filter is
+     *  loaded and decoded once per group instead of once per subchain.
+     */
+    static auto queue_scan(const ScanGroup& subchains) noexcept -> bool;
+
     virtual ~SubchainStateData();
 
 protected:
@@ -164,6 +165,18 @@ protected:
     using UTXOs = std::vector<WalletDatabase::UTXO>;
     using Targets = node::GCS::Targets;
     using Tested = WalletDatabase::MatchingIndices;
+    using Positions = std::vector<std::size_t>;
+    using Outpoints = std::vector<block::Outpoint>;
+
+    /// Filter matching targets for every indexed element and unspent output
+    ///
+    /// The first elements_.size() targets are views of elements_ in the same
+    /// order, followed by the outpoints of utxos_ if the filter type uses them
+    struct AccountTargets {
+        Patterns elements_{};
+        UTXOs utxos_{};
+        Targets targets_{};
+    };
 
     const api::Core& api_;
     const api::client::internal::Blockchain& crypto_;
@@ -173,12 +186,18 @@ protected:
     const block::Position null_position_;
 
     auto describe() const noexcept -> std::string;
-    auto get_account_targets() const noexcept
-        -> std::tuple<Patterns, UTXOs, Targets>;
-    auto get_block_targets(const block::Hash& id, const UTXOs& utxos)
-        const noexcept -> std::pair<Patterns, Targets>;
-    auto get_block_targets(const block::Hash& id, Tested& tested) const noexcept
-        -> std::tuple<Patterns, UTXOs, Targets, Patterns>;
+    /// Cached targets which have not been tested against the block
+    auto get_block_targets(const block::Hash& id, const AccountTargets& cache)
+        const noexcept -> Targets;
+    /// Cached element targets which have not been tested against the block
+    ///
+    /// positions receives the location in cache.elements_ of each target and
+    /// tested receives the index of each element
+    auto get_block_targets(
+        const block::Hash& id,
+        const AccountTargets& cache,
+        Positions& positions,
+        Tested& tested) const noexcept -> Targets;
     virtual auto type() const noexcept -> std::stringstream = 0;
     auto set_key_data(block::bitcoin::Transaction& tx) const noexcept -> void;
     auto supported_scripts(const crypto::Element& element) const noexcept
@@ -192,6 +211,10 @@ protected:
         const blockchain::crypto::Element& input,
         const Bip32Index index,
         WalletDatabase::ElementMap& output) noexcept -> void;
+    /// Stores newly indexed elements and adds them to the cached targets
+    auto add_elements(const WalletDatabase::ElementMap& elements) noexcept
+        -> bool;
+    auto get_account_targets() noexcept -> const AccountTargets&;
     // NOTE call from all and only final constructor bodies
     auto init() noexcept -> void;
     auto queue_work(const Task task, const char* log) noexcept -> bool;
@@ -205,31 +228,39 @@ protected:
         OTIdentifier&& id,
         const SimpleCallback& taskFinished,
         Outstanding& jobCounter,
-        const zmq::socket::Push& threadPool,
         const filter::Type filter,
         const Subchain subchain) noexcept;
 
 private:
-    const zmq::socket::Push& thread_pool_;
     block::Position last_reported_;
+    metrics::Counter& filters_scanned_;
+    metrics::Histogram& scan_time_;
+    // Only one task runs at a time for each subchain, so the cached targets
+    // need no lock
+    std::optional<AccountTargets> account_targets_;
+    // Output database version reflected in the cached unspent outputs
+    std::size_t output_version_;
+    // Other subchains scanned by the next scan task. They are marked as
+    // running until the scan finishes.
+    ScanGroup scan_group_;
 
     auto get_targets(
         const Patterns& elements,
         const std::vector<WalletDatabase::UTXO>& utxos,
         Targets& targets) const noexcept -> void;
-    auto get_targets(
-        const Patterns& elements,
-        const std::vector<WalletDatabase::UTXO>& utxos,
-        Targets& targets,
-        Patterns& outpoints,
-        Tested& tested) const noexcept -> void;
+    auto scan_start(const block::Height best) const noexcept -> block::Height;
+
+    static auto changed_outpoints(
+        const block::bitcoin::Transaction& tx,
+        Outpoints& output) noexcept -> void;
+    auto untested_elements(const block::Hash& id, const AccountTargets& cache)
+        const noexcept -> Positions;
 
     auto check_blocks() noexcept -> bool;
     virtual auto check_index() noexcept -> bool = 0;
     auto check_mempool() noexcept -> void;
     auto check_process() noexcept -> bool;
     auto check_reorg() noexcept -> bool;
-    auto check_scan() noexcept -> bool;
     virtual auto handle_confirmed_matches(
         const block::bitcoin::Block& block,
         const block::Position& position,
@@ -238,7 +269,12 @@ private:
         const block::Block::Matches& matches,
         std::unique_ptr<const block::bitcoin::Transaction> tx) noexcept
         -> void = 0;
+    auto need_scan() noexcept -> bool;
+    auto load_utxos() noexcept -> void;
     auto report_scan() noexcept -> void;
+    /// Replaces the cached unspent outputs among the specified outpoints with
+    /// their current database state
+    auto update_utxos(Outpoints&& outpoints) noexcept -> void;
 
     SubchainStateData() = delete;
     SubchainStateData(const SubchainStateData&) = delete;
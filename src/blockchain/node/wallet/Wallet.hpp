@@ -49,7 +49,6 @@
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"
 #include "opentxs/protobuf/BlockchainTransactionProposal.pb.h"
 #include "opentxs/protobuf/Enums.pb.h"
@@ -163,7 +162,6 @@ private:
     const Type chain_;
     const SimpleCallback task_finished_;
     std::atomic_bool enabled_;
-    OTZMQPushSocket thread_pool;
     wallet::Accounts accounts_;
     wallet::Proposals proposals_;
 
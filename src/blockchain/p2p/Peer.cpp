@@ -23,6 +23,7 @@
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/Pipeline.hpp"
+#include "util/Metrics.hpp"
 #include "util/ScopeGuard.hpp"
 
 #define OT_BLOCKCHAIN_PEER_PING_SECONDS 30
@@ -73,6 +74,10 @@ Peer::Peer(
     , activity_()
     , init_promise_()
     , init_(init_promise_.get_future())
+    , bytes_in_(metrics::Registry::Get().GetCounter(
+          "blockchain." + TickerSymbol(chain_) + ".peer.bytes_in"))
+    , bytes_out_(metrics::Registry::Get().GetCounter(
+          "blockchain." + TickerSymbol(chain_) + ".peer.bytes_out"))
 {
     OT_ASSERT(connection_);
 
@@ -336,6 +341,12 @@ auto Peer::pipeline(zmq::Message& message) noexcept -> void
         } break;
         case Task::ReceiveMessage: {
             activity_.Bump();
+
+            if (2 < message.Body().size()) {
+                bytes_in_.Add(
+                    message.Body_at(1).size() + message.Body_at(2).size());
+            }
+
             process_message(message);
         } break;
         case Task::SendMessage: {
@@ -607,7 +618,7 @@ auto Peer::transmit(zmq::Message& message) noexcept -> void
     LogTrace(OT_METHOD)(__FUNCTION__)(": Sending ")(payload.size())(
         " byte message:")
         .Flush();
-    LogTrace(Data::Factory(payload)->asHex()).Flush();
+    LogTrace(payload).Flush();
     auto promise = std::make_unique<SendPromise>();
 
     OT_ASSERT(promise);
@@ -648,6 +659,7 @@ auto Peer::transmit(zmq::Message& message) noexcept -> void
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Sent ")(payload.size())(" bytes")
             .Flush();
         success = true;
+        bytes_out_.Add(payload.size());
     } else {
         LogNormal("Disconnecting ")(DisplayString(chain_))(" peer ")(
             address_.Display())(" due to unspecified transmit error.")
@@ -70,6 +70,11 @@ struct Mempool;
 }  // namespace node
 }  // namespace blockchain
 
+namespace metrics
+{
+class Counter;
+}  // namespace metrics
+
 namespace network
 {
 namespace zeromq
@@ -395,6 +400,8 @@ private:
     Activity activity_;
     std::promise<void> init_promise_;
     std::shared_future<void> init_;
+    metrics::Counter& bytes_in_;
+    metrics::Counter& bytes_out_;
 
     static auto init_connection_manager(
         const api::Core& api,
@@ -60,6 +60,7 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/protobuf/BlockchainBlockHeader.pb.h"  // IWYU pragma: keep
 #include "util/ScopeGuard.hpp"
+#include "util/Trace.hpp"
 
 #define OT_METHOD "opentxs::blockchain::p2p::bitcoin::implementation::Peer::"
 
@@ -437,6 +438,8 @@ auto Peer::process_block(
     std::unique_ptr<HeaderType> header,
     const zmq::Frame& payload) -> void
 {
+    OT_TRACE_SPAN(span, "process_block", "p2p");
+
     try {
         if (0 == payload.size()) {
             throw std::runtime_error("Invalid payload");
@@ -447,6 +450,8 @@ auto Peer::process_block(
 
         if (!block) { throw std::runtime_error("Failed to instantiate block"); }
 
+        OT_TRACE_FLOW(span, block->ID().Bytes());
+
         if (false == block_.Validate(*block)) {
             throw std::runtime_error("Invalid block");
         }
@@ -569,8 +574,7 @@ auto Peer::process_cfheaders(
 
         if (filterHash != receivedFilterHeader) {
             LogVerbose(OT_METHOD)(__FUNCTION__)(": Unexpected filter header: ")(
-                receivedFilterHeader->asHex())(". Expected: ")(
-                filterHash->asHex())
+                receivedFilterHeader)(". Expected: ")(filterHash)
                 .Flush();
 
             return;
@@ -1248,8 +1252,8 @@ auto Peer::process_headers(
 
         if (checkpointHash != receivedBlockHash) {
             LogVerbose(OT_METHOD)(__FUNCTION__)(
-                ": Unexpected block header hash: ")(receivedBlockHash.asHex())(
-                ". Expected: ")(checkpointHash->asHex())
+                ": Unexpected block header hash: ")(receivedBlockHash)(
+                ". Expected: ")(checkpointHash)
                 .Flush();
 
             return;
@@ -1311,7 +1315,7 @@ auto Peer::process_inv(
     for (const auto& inv : message) {
         const auto& hash = inv.hash_.get();
         LogVerbose("Received ")(DisplayString(chain_))(" ")(inv.DisplayType())(
-            " hash ")(hash.asHex())
+            " hash ")(hash)
             .Flush();
 
         switch (inv.type_) {
@@ -16,6 +16,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "core/OTStorage.hpp"
 #include "internal/api/Api.hpp"
@@ -587,6 +588,106 @@ auto Contract::VerifySignature(const identity::Nym& theNym) const -> bool
     return false;
 }
 
+auto Contract::VerifySignatures(
+    const std::vector<const Contract*>& contracts,
+    const identity::Nym& theNym) -> bool
+{
+    using Provider = crypto::AsymmetricProvider;
+    struct Pending {
+        const Contract* contract_;
+        const crypto::key::Asymmetric* key_;
+        OTData plaintext_;
+        OTData signature_;
+    };
+
+    auto strNymID = String::Factory(theNym.ID());
+    char cNymID = '0';
+    std::uint32_t uIndex = 3;
+    const bool bNymID = strNymID->At(uIndex, cNymID);
+    auto batches = std::map<const Provider*, std::vector<Pending>>{};
+    auto individual = std::vector<const Contract*>{};
+
+    for (const auto* contract : contracts) {
+        OT_ASSERT(nullptr != contract);
+
+        // Mirrors the key selection in VerifySignature
+        const auto* candidate = [&]() -> const Signature* {
+            const Signature* output{nullptr};
+
+            for (const auto& sig : contract->m_listSignatures) {
+                if (bNymID && sig->getMetaData().HasMetadata() &&
+                    (sig->getMetaData().FirstCharNymID() != cNymID)) {
+                    continue;
+                }
+
+                if (nullptr != output) { return nullptr; }
+
+                output = &sig.get();
+            }
+
+            return output;
+        }();
+        const auto* key = [&]() -> const crypto::key::Asymmetric* {
+            if (nullptr == candidate) { return nullptr; }
+
+            crypto::key::Keypair::Keys listOutput;
+            const auto count =
+                theNym.GetPublicKeysBySignature(listOutput, *candidate, 'S');
+
+            if (1 < count) { return nullptr; }
+
+            const auto* output =
+                (1 == count) ? listOutput.front() : &theNym.GetPublicSignKey();
+            const auto* metadata = output->GetMetadata();
+
+            if ((nullptr != metadata) && metadata->HasMetadata() &&
+                candidate->getMetaData().HasMetadata() &&
+                (candidate->getMetaData() != *metadata)) {
+                return nullptr;
+            }
+
+            return output;
+        }();
+
+        if (nullptr == key) {
+            individual.emplace_back(contract);
+
+            continue;
+        }
+
+        const auto plaintext = trim(contract->m_xmlUnsigned);
+        auto signature = Data::Factory();
+        candidate->GetData(signature);
+        batches[&key->engine()].emplace_back(Pending{
+            contract,
+            key,
+            Data::Factory(plaintext->Get(), plaintext->GetLength() + 1),
+            signature});
+    }
+
+    for (const auto& [provider, pending] : batches) {
+        auto items = std::vector<Provider::BatchItem>{};
+        items.reserve(pending.size());
+
+        for (const auto& [contract, key, plaintext, signature] : pending) {
+            items.emplace_back(Provider::BatchItem{
+                plaintext, *key, signature, contract->m_strSigHashType});
+        }
+
+        if (false == provider->VerifyBatch(items)) {
+            for (const auto& item : pending) {
+                individual.emplace_back(item.contract_);
+            }
+        }
+    }
+
+    for (const auto* contract : individual) {
+        if (false == contract->VerifySignature(theNym)) { return false; }
+    }
+
+    return true;
+}
+
 auto Contract::VerifyWithKey(const crypto::key::Asymmetric& theKey) const
     -> bool
 {
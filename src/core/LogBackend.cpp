@@ -0,0 +1,273 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"         // IWYU pragma: associated
+#include "1_Internal.hpp"       // IWYU pragma: associated
+#include "core/LogBackend.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <sstream>
+
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/network/zeromq/socket/Push.hpp"
+#include "opentxs/network/zeromq/socket/Socket.hpp"
+
+#define LOG_SINK "inproc://opentxs/logsink/1"
+
+namespace zmq = opentxs::network::zeromq;
+
+namespace opentxs::implementation
+{
+namespace
+{
+constexpr auto ring_size_ = std::size_t{1024};
+// Queue depth at which a producer wakes the drainer before its next interval
+constexpr auto wake_threshold_ = ring_size_ / 2;
+constexpr auto drain_interval_ = std::chrono::milliseconds{20};
+
+auto thread_name() noexcept -> std::string
+{
+    auto convert = std::stringstream{};
+    convert << std::hex << std::this_thread::get_id();
+
+    return convert.str();
+}
+}  // namespace
+
+class LogBackend::Ring
+{
+public:
+    const std::string thread_;
+    std::atomic<bool> closed_;
+
+    /// Called only by the drainer thread
+    auto Drain(zmq::Message& out) noexcept -> void
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto head = head_.load(std::memory_order_acquire);
+
+        for (auto i = tail; i != head; ++i) {
+            auto& record = records_[i % ring_size_];
+            out.AddFrame(record.level_);
+            out.AddFrame(record.text_);
+            out.AddFrame(thread_);
+            out.AddFrame(&record.promise_, sizeof(record.promise_));
+            record.promise_ = nullptr;
+        }
+
+        tail_.store(head, std::memory_order_release);
+    }
+    auto Empty() const noexcept -> bool
+    {
+        return tail_.load(std::memory_order_acquire) ==
+               head_.load(std::memory_order_acquire);
+    }
+    /** Called only by the owning thread
+     *
+     *  On success the text is swapped into a preallocated slot and the
+     *  number of queued messages is returned. The caller receives the
+     *  previous contents of the slot, cleared, so buffer capacity is reused
+     *  instead of reallocated.
+     */
+    auto Push(
+        const int level,
+        std::string& text,
+        std::promise<void>* promise) noexcept -> std::optional<std::size_t>
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        const auto tail = tail_.load(std::memory_order_acquire);
+
+        if (ring_size_ == (head - tail)) { return std::nullopt; }
+
+        auto& record = records_[head % ring_size_];
+        record.level_ = level;
+        record.text_.swap(text);
+        record.promise_ = promise;
+        text.clear();
+        head_.store(head + 1, std::memory_order_release);
+
+        return head + 1 - tail;
+    }
+
+    Ring() noexcept
+        : thread_(thread_name())
+        , closed_(false)
+        , records_(ring_size_)
+        , head_(0)
+        , tail_(0)
+    {
+    }
+
+private:
+    struct Record {
+        int level_{-1};
+        std::string text_{};
+        std::promise<void>* promise_{nullptr};
+    };
+
+    std::vector<Record> records_;
+    std::atomic<std::size_t> head_;
+    std::atomic<std::size_t> tail_;
+
+    Ring(const Ring&) = delete;
+    Ring(Ring&&) = delete;
+    auto operator=(const Ring&) -> Ring& = delete;
+    auto operator=(Ring&&) -> Ring& = delete;
+};
+
+struct LogBackend::Local {
+    std::string text_{};
+    RingPointer ring_{};
+    bool drainer_{false};
+
+    ~Local()
+    {
+        // The drainer discards the ring once its contents have been delivered
+        if (ring_) { ring_->closed_.store(true); }
+    }
+};
+
+thread_local LogBackend::Local LogBackend::local_{};
+
+LogBackend::LogBackend() noexcept
+    : running_(true)
+    , lock_()
+    , cv_()
+    , wake_(false)
+    , rings_()
+    , drainer_()
+{
+}
+
+auto LogBackend::Get() noexcept -> LogBackend&
+{
+    static auto backend = LogBackend{};
+
+    return backend;
+}
+
+auto LogBackend::add_ring() noexcept -> RingPointer
+{
+    auto output = std::make_shared<Ring>();
+    Lock lock(lock_);
+    rings_.emplace_back(output);
+
+    if (running_ && (false == drainer_.joinable())) {
+        drainer_ = std::thread{&LogBackend::drain, this};
+    }
+
+    return output;
+}
+
+auto LogBackend::Buffer() noexcept -> std::string& { return local_.text_; }
+
+auto LogBackend::drain() noexcept -> void
+{
+    local_.drainer_ = true;
+    auto socket =
+        Context().ZMQ().PushSocket(zmq::socket::Socket::Direction::Connect);
+    socket->Start(LOG_SINK);
+    auto stop{false};
+
+    while (false == stop) {
+        auto rings = std::vector<RingPointer>{};
+
+        {
+            Lock lock(lock_);
+            cv_.wait_for(lock, drain_interval_, [&] { return wake_; });
+            wake_ = false;
+            stop = (false == running_);
+            rings_.erase(
+                std::remove_if(
+                    rings_.begin(),
+                    rings_.end(),
+                    [](const auto& ring) {
+                        return ring->closed_ && ring->Empty();
+                    }),
+                rings_.end());
+            rings = rings_;
+        }
+
+        auto message = zmq::Message::Factory();
+        message->PrependEmptyFrame();
+
+        for (const auto& ring : rings) { ring->Drain(message); }
+
+        if (1u < message->size()) { socket->Send(message); }
+    }
+}
+
+auto LogBackend::Push(const int level, std::promise<void>* promise) noexcept
+    -> bool
+{
+    auto& text = local_.text_;
+
+    if (false == running_) {
+        text.clear();
+
+        return false;
+    }
+
+    auto& ring = local_.ring_;
+
+    if (false == bool(ring)) { ring = add_ring(); }
+
+    while (true) {
+        const auto queued = ring->Push(level, text, promise);
+
+        if (queued.has_value()) {
+            if ((nullptr != promise) || (wake_threshold_ <= queued.value())) {
+                wake();
+            }
+
+            return true;
+        }
+
+        wake();
+
+        // The drainer can not wait for itself to make room
+        if (local_.drainer_ || (false == running_)) {
+            text.clear();
+
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+auto LogBackend::Shutdown() noexcept -> void
+{
+    {
+        Lock lock(lock_);
+        running_ = false;
+        wake_ = true;
+    }
+
+    cv_.notify_all();
+
+    if (drainer_.joinable()) { drainer_.join(); }
+}
+
+auto LogBackend::wake() noexcept -> void
+{
+    {
+        Lock lock(lock_);
+        wake_ = true;
+    }
+
+    cv_.notify_one();
+}
+
+LogBackend::~LogBackend() { Shutdown(); }
+}  // namespace opentxs::implementation
@@ -0,0 +1,75 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace opentxs::implementation
+{
+/** Asynchronous delivery of log messages to the log sink
+ *
+ *  Every thread formats messages into its own buffer and queues completed
+ *  messages into a preallocated single producer, single consumer ring. One
+ *  drainer thread collects the contents of all rings and delivers them to the
+ *  sink as a single batched message, so logging threads never create sockets,
+ *  construct zmq messages, or contend on a shared lock.
+ *
+ *  Each message in a batch occupies four body frames: level, text, thread id,
+ *  and a std::promise<void>* which is either null or must be satisfied by the
+ *  sink once the message has been written.
+ */
+class LogBackend
+{
+public:
+    static auto Get() noexcept -> LogBackend&;
+
+    /// Formatting buffer for the calling thread
+    auto Buffer() noexcept -> std::string&;
+    /** Queue the contents of the calling thread's buffer and clear it
+     *
+     *  Returns false if the message could not be queued, in which case the
+     *  promise will never be satisfied.
+     */
+    auto Push(const int level, std::promise<void>* promise = nullptr) noexcept
+        -> bool;
+    /// Deliver all queued messages and stop the drainer
+    auto Shutdown() noexcept -> void;
+
+    ~LogBackend();
+
+private:
+    class Ring;
+    struct Local;
+
+    using RingPointer = std::shared_ptr<Ring>;
+
+    static thread_local Local local_;
+
+    std::atomic<bool> running_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    bool wake_;
+    std::vector<RingPointer> rings_;
+    std::thread drainer_;
+
+    auto add_ring() noexcept -> RingPointer;
+    auto drain() noexcept -> void;
+    auto wake() noexcept -> void;
+
+    LogBackend() noexcept;
+    LogBackend(const LogBackend&) = delete;
+    LogBackend(LogBackend&&) = delete;
+    auto operator=(const LogBackend&) -> LogBackend& = delete;
+    auto operator=(LogBackend&&) -> LogBackend& = delete;
+};
+}  // namespace opentxs::implementation
@@ -11,12 +11,10 @@
 #include <chrono>
 #include <cstdlib>
 #include <future>
-#include <memory>
 #include <sstream>
 
-#include "opentxs/OT.hpp"
+#include "core/LogBackend.hpp"
 #include "opentxs/Pimpl.hpp"
-#include "opentxs/api/Context.hpp"
 #include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
@@ -26,14 +24,7 @@
 #include "opentxs/core/identifier/Server.hpp"
 #include "opentxs/core/identifier/UnitDefinition.hpp"
 #include "opentxs/core/util/Common.hpp"
-#include "opentxs/network/zeromq/Context.hpp"
-#include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
-#include "opentxs/network/zeromq/socket/Socket.hpp"
-
-#define LOG_SINK "inproc://opentxs/logsink/1"
-
-namespace zmq = opentxs::network::zeromq;
+#include "opentxs/network/zeromq/Frame.hpp"
 
 namespace opentxs
 {
@@ -47,8 +38,6 @@ auto stack_trace() noexcept -> std::string
 
 std::atomic<int> LogSource::verbosity_{0};
 std::atomic<bool> LogSource::running_{true};
-std::mutex LogSource::buffer_lock_{};
-std::map<std::thread::id, LogSource::Source> LogSource::buffer_{};
 
 LogSource::LogSource(const int logLevel) noexcept
     : level_(logLevel)
@@ -69,9 +58,9 @@ auto LogSource::operator()(const char* in) const noexcept -> const LogSource&
 {
     if (verbosity_.load() < level_) { return *this; }
 
-    std::string id{};
-
-    if (running_.load()) { std::get<1>(get_buffer(id)) << in; }
+    if (running_.load()) {
+        implementation::LogBackend::Get().Buffer().append(in);
+    }
 
     return *this;
 }
@@ -116,6 +105,26 @@ auto LogSource::operator()(const Armored& in) const noexcept -> const LogSource&
     return operator()(in.Get());
 }
 
+auto LogSource::operator()(const OTData& in) const noexcept -> const LogSource&
+{
+    return operator()(in.get());
+}
+
+auto LogSource::operator()(const Data& in) const noexcept -> const LogSource&
+{
+    if (verbosity_.load() < level_) { return *this; }
+
+    return operator()(in.asHex());
+}
+
+auto LogSource::operator()(const network::zeromq::Frame& in) const noexcept
+    -> const LogSource&
+{
+    if (verbosity_.load() < level_) { return *this; }
+
+    return operator()(Data::Factory(in).get());
+}
+
 auto LogSource::operator()(const OTIdentifier& in) const noexcept
     -> const LogSource&
 {
@@ -174,73 +183,56 @@ void LogSource::Assert(
     const char* message) const noexcept
 {
     {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
-        buffer << "OT ASSERT";
-
-        if (nullptr != file) { buffer << " in " << file << " line " << line; }
-
-        if (nullptr != message) { buffer << ": " << message; }
-
-        buffer << "\n" << boost::stacktrace::stacktrace();
+        auto& buffer = implementation::LogBackend::Get().Buffer();
+        buffer = "OT ASSERT";
+        append(buffer, file, line, message);
+        buffer.append("\n").append(stack_trace());
     }
 
     send(true);
     abort();
 }
 
-void LogSource::Flush() const noexcept { send(false); }
-
-auto LogSource::get_buffer(std::string& out) noexcept -> LogSource::Source&
+void LogSource::append(
+    std::string& buffer,
+    const char* file,
+    const std::size_t line,
+    const char* message) noexcept
 {
-    const auto id = std::this_thread::get_id();
-    std::stringstream convert{};
-    convert << std::hex << id;
-    out = convert.str();
-    auto it = buffer_.find(id);
+    if (nullptr != file) {
+        buffer.append(" in ")
+            .append(file)
+            .append(" line ")
+            .append(std::to_string(line));
+    }
 
-    if (buffer_.end() == it) {
-        Lock lock(buffer_lock_);
-        auto inner = buffer_.emplace(
-            id,
-            Source{
-                Context().ZMQ().PushSocket(
-                    zmq::socket::Socket::Direction::Connect),
-                std::stringstream{}});
-        auto& source = std::get<0>(inner)->second;
-        auto& socket = std::get<0>(source).get();
-        socket.Start(LOG_SINK);
+    if (nullptr != message) { buffer.append(": ").append(message); }
+}
 
-        return source;
-    }
+void LogSource::Flush() const noexcept
+{
+    // Fragments below the verbosity threshold were never buffered, so there is
+    // nothing to deliver
+    if (verbosity_.load() < level_) { return; }
 
-    return it->second;
+    send(false);
 }
 
 void LogSource::send(const bool terminate) const noexcept
 {
     if (running_.load()) {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        auto message = zmq::Message::Factory();
-        message->PrependEmptyFrame();
-        message->AddFrame(level_);
-        message->AddFrame(buffer.str());
-        message->AddFrame(id);
-        auto promise = std::promise<void>{};
-        auto future = promise.get_future();
-        const auto* pPromise = &promise;
+        auto& backend = implementation::LogBackend::Get();
 
         if (terminate) {
-            message->AddFrame(&pPromise, sizeof(pPromise));
+            auto promise = std::promise<void>{};
+            auto future = promise.get_future();
+
+            if (backend.Push(level_, &promise)) {
+                future.wait_for(std::chrono::seconds(10));
+            }
         } else {
-            promise.set_value();
+            backend.Push(level_);
         }
-
-        socket->Send(message);
-        buffer = std::stringstream{};
-        future.wait_for(std::chrono::seconds(10));
     }
 
     if (terminate) { abort(); }
@@ -254,7 +246,7 @@ void LogSource::SetVerbosity(const int level) noexcept
 void LogSource::Shutdown() noexcept
 {
     running_.store(false);
-    buffer_.clear();
+    implementation::LogBackend::Get().Shutdown();
 }
 
 auto LogSource::StartLog(
@@ -270,16 +262,10 @@ void LogSource::Trace(
     const char* message) const noexcept
 {
     {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
-        buffer << "Stack trace requested";
-
-        if (nullptr != file) { buffer << " in " << file << " line " << line; }
-
-        if (nullptr != message) { buffer << ": " << message; }
-
-        buffer << "\n" << stack_trace();
+        auto& buffer = implementation::LogBackend::Get().Buffer();
+        buffer = "Stack trace requested";
+        append(buffer, file, line, message);
+        buffer.append("\n").append(stack_trace());
     }
 
     send(false);
@@ -3257,6 +3257,8 @@ auto OTTransaction::VerifyItems(
     // if pointer not null, and it's a withdrawal, and it's an acknowledgement
     // (not a rejection or error)
     //
+    auto items = std::vector<const Contract*>{};
+
     for (auto& it : GetItemList()) {
         // loop through the ALL items that make up this transaction and check
         // to see if a response to deposit.
@@ -3267,16 +3269,13 @@ auto OTTransaction::VerifyItems(
 
         if (NYM_ID != pItem->GetNymID()) return false;
 
-        if (!pItem->VerifySignature(theNym))  // NO need to call
-                                              // VerifyAccount since
-                                              // VerifyContractID is
-                                              // ALREADY called and now
-                                              // here's
-                                              // VerifySignature().
-            return false;
+        items.emplace_back(pItem.get());
     }
 
-    return true;
+    // NO need to call VerifyAccount since VerifyContractID is ALREADY called
+    // and now here's VerifySignature(). The item signatures are independent so
+    // they are checked as a batch.
+    return Contract::VerifySignatures(items, theNym);
 }
 
 // all common OTTransaction stuff goes here.
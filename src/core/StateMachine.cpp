@@ -15,6 +15,9 @@ StateMachine::StateMachine(const Callback callback) noexcept
     , clean_(false)
     , shutdown_(false)
     , running_(false)
+    , executing_(false)
+    , suspended_(false)
+    , resumed_(false)
     , handle_()
     , stopping_()
     , stopping_future_(stopping_.get_future())
@@ -29,21 +32,11 @@ void StateMachine::clean(const Lock& lock) const noexcept
     clean_.store(true);
 }
 
-void StateMachine::execute() const noexcept
+auto StateMachine::launch(const Lock&) const noexcept -> void
 {
-    bool again{true};
-
-    while (again) {
-        again = cb_();
-
-        if (shutdown_.load()) { break; }
-    }
-
-    Lock lock(decision_lock_);
-    running_.store(false);
-    waiting_.set_value();
+    if (handle_.joinable()) { handle_.join(); }
 
-    if (shutdown_.load()) { clean(lock); }
+    handle_ = std::thread(&StateMachine::run, this);
 }
 
 auto StateMachine::make_wait_promise(const Lock& lock, const bool set)
@@ -57,6 +50,55 @@ auto StateMachine::make_wait_promise(const Lock& lock, const bool set)
     return waiting_future_;
 }
 
+auto StateMachine::resume() const noexcept -> void
+{
+    Lock lock(decision_lock_);
+
+    if (false == suspended_) { return; }
+
+    if (executing_) {
+        resumed_ = true;
+
+        return;
+    }
+
+    suspended_ = false;
+    executing_ = true;
+    launch(lock);
+}
+
+auto StateMachine::run() const noexcept -> void
+{
+    bool again{true};
+
+    while (again && (false == shutdown_.load())) {
+        again = cb_();
+
+        if (false == again) { break; }
+
+        Lock lock(decision_lock_);
+
+        if (suspended_ && (false == resumed_) && (false == shutdown_.load())) {
+            executing_ = false;
+
+            return;
+        }
+
+        suspended_ = false;
+        resumed_ = false;
+    }
+
+    Lock lock(decision_lock_);
+    executing_ = false;
+    suspended_ = false;
+    resumed_ = false;
+    running_.store(false);
+    waiting_.set_value();
+    idle(lock);
+
+    if (shutdown_.load()) { clean(lock); }
+}
+
 auto StateMachine::Stop() const noexcept -> StateMachine::StopFuture
 {
     Lock lock(decision_lock_);
@@ -64,7 +106,14 @@ auto StateMachine::Stop() const noexcept -> StateMachine::StopFuture
     if (false == clean_.load()) {
         shutdown_.store(true);
 
-        if (false == running_.load()) { clean(lock); }
+        if (false == running_.load()) {
+            clean(lock);
+        } else if (suspended_ && (false == executing_)) {
+            // Nothing else will resume the callback loop so that it can stop
+            suspended_ = false;
+            executing_ = true;
+            launch(lock);
+        }
     }
 
     return stopping_future_;
@@ -78,14 +127,20 @@ auto StateMachine::trigger(const Lock& lock) const noexcept -> bool
 
     if (running) { return true; }
 
-    if (handle_.joinable()) { handle_.join(); }
-
     make_wait_promise(lock, false);
-    handle_ = std::thread(&StateMachine::execute, this);
+    executing_ = true;
+    launch(lock);
 
     return true;
 }
 
+auto StateMachine::suspend() const noexcept -> void
+{
+    Lock lock(decision_lock_);
+    suspended_ = true;
+    resumed_ = false;
+}
+
 auto StateMachine::Trigger() const noexcept -> bool
 {
     Lock lock(decision_lock_);
@@ -79,6 +79,35 @@ protected:
 
     OPENTXS_EXPORT auto trigger(const Lock& decisionLock) const noexcept
         -> bool;
+    /** Start one pass of the callback loop
+     *
+     *  The default implementation executes each pass on a new thread. A
+     *  subclass may instead queue run() on a thread pool.
+     */
+    OPENTXS_EXPORT virtual auto launch(const Lock& decisionLock) const noexcept
+        -> void;
+    /** Execute the callback until it stops, suspends, or shuts down
+     *
+     *  Must be called exactly once for every launch()
+     */
+    OPENTXS_EXPORT auto run() const noexcept -> void;
+    /** End the current pass as soon as the callback returns true
+     *
+     *  The state machine remains running but executes nothing until resume()
+     *  or Stop() is called. If resume() is called before the callback returns
+     *  the pass continues without interruption.
+     */
+    OPENTXS_EXPORT auto suspend() const noexcept -> void;
+    /// Continue a state machine which called suspend()
+    OPENTXS_EXPORT auto resume() const noexcept -> void;
+
+    /** Called each time the callback function stops executing
+     *
+     *  Executes on the state machine thread while the decision lock is held,
+     *  after running() has become false and before the state machine is marked
+     *  as stopped.
+     */
+    OPENTXS_EXPORT virtual auto idle(const Lock&) const noexcept -> void {}
 
     OPENTXS_EXPORT StateMachine(const Callback callback) noexcept;
 
@@ -87,6 +116,9 @@ private:
     mutable std::atomic<bool> clean_;
     mutable std::atomic<bool> shutdown_;
     mutable std::atomic<bool> running_;
+    mutable bool executing_;
+    mutable bool suspended_;
+    mutable bool resumed_;
     mutable std::thread handle_;
     mutable StopPromise stopping_;
     mutable StopFuture stopping_future_;
@@ -94,7 +126,6 @@ private:
     mutable WaitFuture waiting_future_;
 
     void clean(const Lock& decisionLock) const noexcept;
-    void execute() const noexcept;
     auto make_wait_promise(const Lock& decisionLock, const bool set = false)
         const noexcept -> WaitFuture;
 
@@ -10,6 +10,7 @@
 #include <boost/endian/buffers.hpp>
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstring>
 #include <functional>
 #include <iterator>
@@ -105,6 +106,52 @@ auto Factory::PaymentCode(
 
 namespace opentxs::implementation
 {
+namespace
+{
+constexpr auto keys_per_job_ = std::size_t{8};
+
+/// Calls derive for count consecutive indices, sharing the batch with idle
+/// thread pool workers. The output stops at the first index which failed.
+template <typename Key, typename Derive>
+auto derive_batch(
+    const api::Core& api,
+    const Bip32Index first,
+    const std::size_t count,
+    const Derive& derive) noexcept -> std::vector<Key>
+{
+    auto output = std::vector<Key>(count);
+    api::internal::ThreadPool::Get(api).Parallel(
+        count, keys_per_job_, [&](const auto i) {
+            auto& key = output[i];
+            key = derive(first + static_cast<Bip32Index>(i));
+
+            return bool(key);
+        });
+    const auto end =
+        std::find_if(output.begin(), output.end(), [](const auto& key) {
+            return false == bool(key);
+        });
+    output.erase(end, output.end());
+
+    return output;
+}
+
+/// Keys decrypt their secrets on first use, which must happen before the
+/// key is shared between threads
+auto decrypt(
+    const crypto::key::HD& key,
+    const PasswordPrompt& reason) noexcept(false) -> void
+{
+    if (key.HasPrivate() && key.PrivateKey(reason).empty()) {
+        throw std::runtime_error("Failed to decrypt private key");
+    }
+
+    if (key.Chaincode(reason).empty()) {
+        throw std::runtime_error("Failed to decrypt chain code");
+    }
+}
+}  // namespace
+
 const std::size_t PaymentCode::pubkey_size_{sizeof(XpubPreimage::key_)};
 const std::size_t PaymentCode::chain_code_size_{sizeof(XpubPreimage::code_)};
 
@@ -571,38 +618,7 @@ auto PaymentCode::derive_keys(
     const PasswordPrompt& reason) const noexcept(false)
     -> std::pair<ECKey, ECKey>
 {
-#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
-    auto output = std::pair<ECKey, ECKey>{};
-    auto& [localPrivate, remotePublic] = output;
-
-    if (key_) {
-        localPrivate = key_->ChildKey(local, reason);
-
-        if (!localPrivate) {
-            throw std::runtime_error("Failed to derive local private key");
-        }
-    } else {
-        throw std::runtime_error("Failed to obtain local hd key");
-    }
-
-    if (const auto pKey = other.Key(); pKey) {
-        const auto& key = *pKey;
-
-        OT_ASSERT(0 < key.Chaincode(reason).size());
-
-        remotePublic = key.ChildKey(remote, reason);
-
-        if (!remotePublic) {
-            throw std::runtime_error("Failed to derive remote public key");
-        }
-    } else {
-        throw std::runtime_error("Failed to obtain remote hd key");
-    }
-
-    return output;
-#else
-    throw std::runtime_error("Missing secp256k1 support");
-#endif  // OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+    return {local_key(local, reason), remote_key(other, remote, reason)};
 }
 
 auto PaymentCode::effective_version(
@@ -743,28 +759,43 @@ auto PaymentCode::Incoming(
         const auto [pPrivate, pPublic] = derive_keys(sender, index, 0, reason);
         const auto& localPrivate = *pPrivate;
         const auto& remotePublic = *pPublic;
+        const auto secret = shared_secret_payment(
+            effective, localPrivate, remotePublic, chain, reason);
 
-        switch (effective) {
-            case 1:
-            case 2: {
-                const auto secret = shared_secret_payment_v1(
-                    localPrivate, remotePublic, reason);
+        return localPrivate.IncrementPrivate(secret, reason);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
-                return localPrivate.IncrementPrivate(secret, reason);
-            }
-            case 3: {
-                const auto secret = shared_secret_payment_v3(
-                    localPrivate, remotePublic, chain, reason);
+        return {};
+    }
+}
 
-                return localPrivate.IncrementPrivate(secret, reason);
-            }
-            default: {
-                const auto error = std::string{"Unsupported version "} +
-                                   std::to_string(effective);
+auto PaymentCode::IncomingBatch(
+    const opentxs::PaymentCode& sender,
+    const Bip32Index first,
+    const std::size_t count,
+    const blockchain::Type chain,
+    const PasswordPrompt& reason,
+    const std::uint8_t version) const noexcept -> std::vector<ECKey>
+{
+    try {
+        const auto effective = effective_version(version);
+        // Every incoming payment from the sender uses the same remote key
+        const auto pPublic = remote_key(sender, 0, reason);
+        const auto& remotePublic = *pPublic;
 
-                throw std::runtime_error{error};
-            }
-        }
+#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+        if (key_) { decrypt(*key_, reason); }
+#endif  // OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+
+        return derive_batch<ECKey>(api_, first, count, [&](const auto index) {
+            const auto pPrivate = local_key(index, reason);
+            const auto& localPrivate = *pPrivate;
+            const auto secret = shared_secret_payment(
+                effective, localPrivate, remotePublic, chain, reason);
+
+            return localPrivate.IncrementPrivate(secret, reason);
+        });
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -855,6 +886,27 @@ auto PaymentCode::Locator(const AllocateOutput dest, const std::uint8_t version)
     return true;
 }
 
+auto PaymentCode::local_key(
+    const Bip32Index index,
+    const PasswordPrompt& reason) const noexcept(false) -> ECKey
+{
+#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+    if (false == bool(key_)) {
+        throw std::runtime_error("Failed to obtain local hd key");
+    }
+
+    auto output = ECKey{key_->ChildKey(index, reason)};
+
+    if (!output) {
+        throw std::runtime_error("Failed to derive local private key");
+    }
+
+    return output;
+#else
+    throw std::runtime_error("Missing secp256k1 support");
+#endif  // OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+}
+
 auto PaymentCode::match_locator(
     const std::uint8_t version,
     const Space& element) const noexcept(false) -> bool
@@ -895,28 +947,53 @@ auto PaymentCode::Outgoing(
             derive_keys(recipient, 0, index, reason);
         const auto& localPrivate = *pPrivate;
         const auto& remotePublic = *pPublic;
+        const auto secret = shared_secret_payment(
+            effective, localPrivate, remotePublic, chain, reason);
 
-        switch (effective) {
-            case 1:
-            case 2: {
-                const auto secret = shared_secret_payment_v1(
-                    localPrivate, remotePublic, reason);
+        return remotePublic.IncrementPublic(secret);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
-                return remotePublic.IncrementPublic(secret);
-            }
-            case 3: {
-                const auto secret = shared_secret_payment_v3(
-                    localPrivate, remotePublic, chain, reason);
+        return {};
+    }
+}
 
-                return remotePublic.IncrementPublic(secret);
-            }
-            default: {
-                const auto error = std::string{"Unsupported version "} +
-                                   std::to_string(effective);
+auto PaymentCode::OutgoingBatch(
+    const opentxs::PaymentCode& recipient,
+    const Bip32Index first,
+    const std::size_t count,
+    const blockchain::Type chain,
+    const PasswordPrompt& reason,
+    const std::uint8_t version) const noexcept -> std::vector<ECKey>
+{
+    try {
+        if (false == key_->HasPrivate()) {
+            throw std::runtime_error{"Private key missing"};
+        }
 
-                throw std::runtime_error{error};
-            }
+        const auto effective = effective_version(version, recipient.Version());
+        // Every outgoing payment to the recipient uses the same local key
+        const auto pPrivate = local_key(0, reason);
+        const auto& localPrivate = *pPrivate;
+
+        if (localPrivate.PrivateKey(reason).empty()) {
+            throw std::runtime_error("Failed to decrypt private key");
+        }
+
+        if (const auto pKey = recipient.Key(); pKey) {
+            decrypt(*pKey, reason);
+        } else {
+            throw std::runtime_error("Failed to obtain remote hd key");
         }
+
+        return derive_batch<ECKey>(api_, first, count, [&](const auto index) {
+            const auto pPublic = remote_key(recipient, index, reason);
+            const auto& remotePublic = *pPublic;
+            const auto secret = shared_secret_payment(
+                effective, localPrivate, remotePublic, chain, reason);
+
+            return remotePublic.IncrementPublic(secret);
+        });
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -938,6 +1015,34 @@ auto PaymentCode::postprocess(const Secret& in) const noexcept(false)
     return output;
 }
 
+auto PaymentCode::remote_key(
+    const opentxs::PaymentCode& other,
+    const Bip32Index index,
+    const PasswordPrompt& reason) const noexcept(false) -> ECKey
+{
+#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+    const auto pKey = other.Key();
+
+    if (false == bool(pKey)) {
+        throw std::runtime_error("Failed to obtain remote hd key");
+    }
+
+    const auto& key = *pKey;
+
+    OT_ASSERT(0 < key.Chaincode(reason).size());
+
+    auto output = ECKey{key.ChildKey(index, reason)};
+
+    if (!output) {
+        throw std::runtime_error("Failed to derive remote public key");
+    }
+
+    return output;
+#else
+    throw std::runtime_error("Missing secp256k1 support");
+#endif  // OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+}
+
 auto PaymentCode::Serialize(AllocateOutput destination) const noexcept -> bool
 {
     auto serialized = proto::PaymentCode{};
@@ -975,6 +1080,30 @@ auto PaymentCode::shared_secret_mask_v1(
     return output;
 }
 
+auto PaymentCode::shared_secret_payment(
+    const VersionType version,
+    const crypto::key::EllipticCurve& local,
+    const crypto::key::EllipticCurve& remote,
+    const blockchain::Type chain,
+    const PasswordPrompt& reason) const noexcept(false) -> OTSecret
+{
+    switch (version) {
+        case 1:
+        case 2: {
+            return shared_secret_payment_v1(local, remote, reason);
+        }
+        case 3: {
+            return shared_secret_payment_v3(local, remote, chain, reason);
+        }
+        default: {
+            const auto error =
+                std::string{"Unsupported version "} + std::to_string(version);
+
+            throw std::runtime_error{error};
+        }
+    }
+}
+
 auto PaymentCode::shared_secret_payment_v1(
     const crypto::key::EllipticCurve& local,
     const crypto::key::EllipticCurve& remote,
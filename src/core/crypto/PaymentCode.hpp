@@ -14,7 +14,9 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
+#include "internal/core/Core.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
@@ -68,7 +70,7 @@ class PasswordPrompt;
 
 namespace opentxs::implementation
 {
-class PaymentCode final : virtual public opentxs::PaymentCode
+class PaymentCode final : virtual public opentxs::internal::PaymentCode
 {
 public:
     struct XpubPreimage {
@@ -289,6 +291,14 @@ public:
         const blockchain::Type chain,
         const PasswordPrompt& reason,
         const std::uint8_t version) const noexcept -> ECKey final;
+    auto IncomingBatch(
+        const opentxs::PaymentCode& sender,
+        const Bip32Index first,
+        const std::size_t count,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason,
+        const std::uint8_t version) const noexcept
+        -> std::vector<ECKey> final;
     auto Key() const noexcept -> HDKey final;
     auto Locator(const AllocateOutput destination, const std::uint8_t version)
         const noexcept -> bool final;
@@ -298,6 +308,14 @@ public:
         const blockchain::Type chain,
         const PasswordPrompt& reason,
         const std::uint8_t version) const noexcept -> ECKey final;
+    auto OutgoingBatch(
+        const opentxs::PaymentCode& recipient,
+        const Bip32Index first,
+        const std::size_t count,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason,
+        const std::uint8_t version) const noexcept
+        -> std::vector<ECKey> final;
     auto Serialize(AllocateOutput destination) const noexcept -> bool final;
     auto Serialize(Serialized& serialized) const noexcept -> bool final;
     auto Sign(
@@ -412,13 +430,25 @@ private:
         const opentxs::PaymentCode& recipient,
         const Space& blind,
         Elements& output) const noexcept(false) -> void;
+    auto local_key(const Bip32Index index, const PasswordPrompt& reason) const
+        noexcept(false) -> ECKey;
     auto match_locator(const std::uint8_t version, const Space& element) const
         noexcept(false) -> bool;
     auto postprocess(const Secret& in) const noexcept(false) -> OTSecret;
+    auto remote_key(
+        const opentxs::PaymentCode& other,
+        const Bip32Index index,
+        const PasswordPrompt& reason) const noexcept(false) -> ECKey;
     auto shared_secret_mask_v1(
         const crypto::key::EllipticCurve& local,
         const crypto::key::EllipticCurve& remote,
         const PasswordPrompt& reason) const noexcept(false) -> OTSecret;
+    auto shared_secret_payment(
+        const VersionType version,
+        const crypto::key::EllipticCurve& local,
+        const crypto::key::EllipticCurve& remote,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason) const noexcept(false) -> OTSecret;
     auto shared_secret_payment_v1(
         const crypto::key::EllipticCurve& local,
         const crypto::key::EllipticCurve& remote,
@@ -11,6 +11,10 @@ extern "C" {
 #include <sodium.h>
 }
 
+#include <cstddef>
+#include <vector>
+
+#include "internal/api/Api.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
@@ -29,6 +33,11 @@ extern "C" {
 
 namespace opentxs::crypto
 {
+namespace
+{
+constexpr auto signatures_per_job_ = std::size_t{4};
+}  // namespace
+
 auto AsymmetricProvider::CurveToKeyType(const EcdsaCurve& curve)
     -> crypto::key::asymmetric::Algorithm
 {
@@ -75,6 +84,23 @@ auto AsymmetricProvider::KeyTypeToCurve(
 
     return output;
 }
+
+auto AsymmetricProvider::VerifyBatch(
+    const std::vector<BatchItem>& items) const -> bool
+{
+    return api::internal::ThreadPool::Get(Context()).Parallel(
+        items.size(), signatures_per_job_, [&](const auto index) {
+            const auto& [plaintext, key, signature, hash] = items[index];
+
+            if (Verify(plaintext, key, signature, hash)) { return true; }
+
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Signature ")(index)(
+                " is not valid")
+                .Flush();
+
+            return false;
+        });
+}
 }  // namespace opentxs::crypto
 
 namespace opentxs::crypto::implementation
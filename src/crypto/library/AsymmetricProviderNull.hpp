@@ -65,6 +65,10 @@ public:
     {
         return false;
     }
+    auto VerifyBatch(const std::vector<BatchItem>&) const -> bool final
+    {
+        return false;
+    }
     auto VerifyContractSignature(
         const String&,
         const key::Asymmetric&,
@@ -5,9 +5,14 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
 #include "opentxs/api/Context.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Metrics.hpp"
 #include "opentxs/api/ThreadPool.hpp"
 #include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/protobuf/Ciphertext.pb.h"
@@ -98,13 +103,60 @@ struct Log {
     virtual ~Log() = default;
 };
 
+struct Metrics : virtual public api::Metrics {
+    virtual auto Shutdown() noexcept -> void = 0;
+
+    ~Metrics() override = default;
+};
+
 struct ThreadPool : virtual public api::ThreadPool {
     enum class Work : OTZMQWorkType {
         BlockchainWallet = OT_ZMQ_INTERNAL_SIGNAL + 0,
         SyncDataFiltersIncoming = OT_ZMQ_INTERNAL_SIGNAL + 1,
         CalculateBlockFilters = OT_ZMQ_INTERNAL_SIGNAL + 2,
+        OTXOperation = OT_ZMQ_INTERNAL_SIGNAL + 3,
+    };
+
+    /// Jobs of a higher priority class always run before lower ones
+    enum class Priority : std::uint8_t {
+        UI = 0,
+        Wallet = 1,
+        Indexing = 2,
+        Background = 3,
     };
 
+    static auto Get(const api::Context& api) noexcept -> const ThreadPool&;
+    static auto Get(const api::Core& api) noexcept -> const ThreadPool&;
+
+    /** Call job once for every index from zero to count - 1
+     *
+     *  The calling thread takes part and queues one helper job for every
+     *  minimum indices beyond the first, up to the number of workers. The
+     *  caller only waits for helpers which have already started, so Parallel
+     *  may be called from inside a pool job without exhausting the workers.
+     *
+     *  Helpers run at the priority of the pool job which called Parallel, or
+     *  at UI priority when called from outside the pool.
+     *
+     *  No more indices are handed out after a call returns false or throws,
+     *  and Parallel then returns false.
+     */
+    virtual auto Parallel(
+        const std::size_t count,
+        const std::size_t minimum,
+        const std::function<bool(std::size_t)>& job) const noexcept
+        -> bool = 0;
+    using api::ThreadPool::Register;
+    virtual auto Register(WorkType type, Callback handler, Priority priority)
+        const noexcept -> bool = 0;
+    /** Queue a job without passing through a socket
+     *
+     *  The work message should be constructed by MakeWork. Returns false if
+     *  no handler is registered for the work type or the pool is shut down.
+     */
+    virtual auto Submit(WorkType type, OTZMQMessage&& work) const noexcept
+        -> bool = 0;
+
     virtual auto Shutdown() noexcept -> void = 0;
 
     ~ThreadPool() override = default;
@@ -27,6 +27,7 @@ namespace internal
 {
 struct Context;
 struct Log;
+struct Metrics;
 struct ThreadPool;
 }  // namespace internal
 
@@ -84,6 +85,11 @@ auto Log(
     const network::zeromq::Context& zmq,
     const std::string& endpoint) noexcept
     -> std::unique_ptr<api::internal::Log>;
+auto Metrics(
+    const network::zeromq::Context& zmq,
+    const std::string& endpoint,
+    const std::string& traceFile) noexcept
+    -> std::unique_ptr<api::internal::Metrics>;
 auto Primitives(const api::Crypto& crypto) noexcept
     -> std::unique_ptr<api::Primitives>;
 auto Settings(const api::Legacy& legacy, const String& path) noexcept
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "opentxs/api/storage/Storage.hpp"
 
 namespace opentxs
@@ -16,6 +18,8 @@ namespace key
 class Symmetric;
 }  // namespace key
 }  // namespace crypto
+
+class Identifier;
 }  // namespace opentxs
 
 namespace opentxs::api::storage
@@ -23,6 +27,24 @@ namespace opentxs::api::storage
 class StorageInternal : virtual public Storage
 {
 public:
+    /** Check the verification record kept next to a stored object
+     *
+     *  \param[in] id     the id of a nym, server contract or unit definition
+     *  \param[in] digest the digest of the serialized object
+     *
+     *  \returns true if the stored record matches the digest
+     */
+    virtual bool CheckVerified(const Identifier& id, const std::string& digest)
+        const = 0;
+    /** Record that the serialized object with the specified digest has been
+     *  verified
+     *
+     *  The record is kept next to the stored nym, server contract or unit
+     *  definition and is discarded along with it by garbage collection.
+     */
+    virtual bool MarkVerified(const Identifier& id, const std::string& digest)
+        const = 0;
+
     virtual void InitBackup() = 0;
     virtual void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) = 0;
     virtual void start() = 0;
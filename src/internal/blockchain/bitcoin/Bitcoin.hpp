@@ -19,6 +19,7 @@
 #include "opentxs/Types.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 
 namespace opentxs
@@ -135,7 +136,7 @@ enum class SigOption : std::uint8_t {
     Single,
 };
 
-struct SigHash {
+struct OPENTXS_EXPORT SigHash {
     std::byte flags_{0x01};
     std::array<std::byte, 3> forkid_{};
 
@@ -151,19 +152,20 @@ struct SigHash {
         const bool anyoneCanPay = false) noexcept;
 };
 
-struct Bip143Hashes {
+struct OPENTXS_EXPORT Bip143Hashes {
     using Hash = std::array<std::byte, 32>;
 
     Hash outpoints_{};
     Hash sequences_{};
     Hash outputs_{};
+    /// Hash of each serialized output, used by SIGHASH_SINGLE
+    std::vector<Hash> single_{};
 
     auto Outpoints(const SigHash type) const noexcept -> const Hash&;
-    auto Outputs(const SigHash type, const Hash* single) const noexcept
+    auto Outputs(const SigHash type, const std::size_t index) const noexcept
         -> const Hash&;
     auto Preimage(
         const std::size_t index,
-        const std::size_t total,
         const be::little_int32_buf_t& version,
         const be::little_uint32_buf_t& locktime,
         const SigHash& sigHash,
@@ -173,9 +175,25 @@ struct Bip143Hashes {
 
 private:
     static auto blank() noexcept -> const Hash&;
-    static auto get_single(
+};
+
+/** Serialized transaction components for legacy signature hashes
+ *
+ *  A legacy preimage is a modified copy of the whole transaction, so the
+ *  parts which do not depend on the input being signed are serialized once
+ *  and copied into the preimage for each input.
+ */
+struct OPENTXS_EXPORT LegacySighash {
+    std::vector<block::Outpoint> outpoints_{};
+    std::vector<be::little_uint32_buf_t> sequences_{};
+    std::vector<Space> outputs_{};
+
+    auto Preimage(
         const std::size_t index,
-        const std::size_t total,
-        const SigHash& sigHash) noexcept -> std::unique_ptr<Hash>;
+        const be::little_int32_buf_t& version,
+        const be::little_uint32_buf_t& locktime,
+        const SigHash& sigHash,
+        const block::bitcoin::internal::Input& input) const noexcept(false)
+        -> Space;
 };
 }  // namespace opentxs::blockchain::bitcoin
@@ -113,7 +113,7 @@ namespace opentxs::blockchain::block::bitcoin::internal
 auto DecodeBip34(const ReadView coinbase) noexcept -> block::Height;
 auto EncodeBip34(block::Height height) noexcept -> Space;
 
-struct Input : virtual public bitcoin::Input {
+struct OPENTXS_EXPORT Input : virtual public bitcoin::Input {
     using Signature = std::pair<ReadView, ReadView>;
     using Signatures = std::vector<Signature>;
 
@@ -232,11 +232,6 @@ struct Script : virtual public bitcoin::Script {
 struct OPENTXS_EXPORT Transaction : virtual public bitcoin::Transaction {
     using SigHash = blockchain::bitcoin::SigOption;
 
-    virtual auto GetPreimageBTC(
-        const std::size_t index,
-        const blockchain::bitcoin::SigHash& hashType) const noexcept
-        -> Space = 0;
-
     virtual auto AssociatePreviousOutput(
         const api::client::Blockchain& api,
         const std::size_t inputIndex,
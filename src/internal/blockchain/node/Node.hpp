@@ -235,7 +235,11 @@ struct BlockOracle : virtual public node::BlockOracle {
 
     virtual auto GetBlockJob() const noexcept -> BlockJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
-    virtual auto SubmitBlock(const ReadView in) const noexcept -> void = 0;
+    /// Queues a serialized block, sharing the frame buffer without a copy
+    virtual auto SubmitBlock(const network::zeromq::Frame& in) const noexcept
+        -> void = 0;
+    /// Queues a serialized block, taking ownership of the buffer
+    virtual auto SubmitBlock(Space&& in) const noexcept -> void = 0;
     virtual auto Tip() const noexcept -> block::Position = 0;
 
     virtual auto Init() noexcept -> void = 0;
@@ -255,6 +259,17 @@ struct BlockValidator {
     virtual ~BlockValidator() = default;
 };
 
+/// Fee-aware inputs to coin selection
+struct CoinSelection {
+    /// Value which the selected inputs must reach after paying for the
+    /// outputs and for every byte of the transaction except the inputs
+    Amount target_;
+    /// Fee for the bytes added by spending one more input
+    Amount input_fee_;
+    /// Largest excess which is paid to miners instead of creating change
+    Amount cost_of_change_;
+};
+
 struct OPENTXS_EXPORT Config {
     bool download_cfilters_{false};
     bool generate_cfilters_{false};
@@ -638,15 +653,28 @@ struct WalletDatabase {
         const identifier::Nym& owner,
         const Identifier& node,
         State type) const noexcept -> std::vector<UTXO> = 0;
+    /// Changes whenever outputs of the subchain change state outside of
+    /// block and mempool processing, for example when a proposal is
+    /// cancelled
+    virtual auto GetOutputVersion(
+        const NodeID& balanceNode,
+        const Subchain subchain) const noexcept -> std::size_t = 0;
     virtual auto GetPatterns(const SubchainIndex& index) const noexcept
         -> Patterns = 0;
     virtual auto GetUnspentOutputs() const noexcept -> std::vector<UTXO> = 0;
     virtual auto GetUnspentOutputs(
         const NodeID& balanceNode,
         const Subchain subchain) const noexcept -> std::vector<UTXO> = 0;
-    virtual auto GetUntestedPatterns(
+    /// Unspent outputs of the subchain among the specified outpoints
+    virtual auto GetUnspentOutputs(
+        const NodeID& balanceNode,
+        const Subchain subchain,
+        const std::vector<block::Outpoint>& outpoints) const noexcept
+        -> std::vector<UTXO> = 0;
+    /// Indices of the elements already tested against the block
+    virtual auto GetTestedIndices(
         const SubchainIndex& index,
-        const ReadView blockID) const noexcept -> Patterns = 0;
+        const ReadView blockID) const noexcept -> MatchingIndices = 0;
     virtual auto LoadProposal(const Identifier& id) const noexcept
         -> std::optional<proto::BlockchainTransactionProposal> = 0;
     virtual auto LoadProposals() const noexcept
@@ -662,6 +690,11 @@ struct WalletDatabase {
         const identifier::Nym& spender,
         const Identifier& proposal,
         const Spend policy) const noexcept -> std::optional<UTXO> = 0;
+    virtual auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Spend policy,
+        const CoinSelection& params) const noexcept -> std::vector<UTXO> = 0;
     virtual auto SetDefaultFilterType(const FilterType type) const noexcept
         -> bool = 0;
     virtual auto SubchainAddElements(
@@ -683,5 +716,20 @@ struct WalletDatabase {
 
     virtual ~WalletDatabase() = default;
 };
+
+/** Choose which candidates fund a transaction
+ *
+ *  The candidate values must be sorted in descending order. A branch and
+ *  bound search looks for a set whose effective value (value minus the input
+ *  fee) lands between the target and the target plus the cost of change, so
+ *  that no change output is needed. If no such set is found, a single random
+ *  draw takes candidates until the target plus the cost of change is covered.
+ *
+ *  Returns the indices of the selected candidates, or an empty vector if the
+ *  candidates can not reach the target.
+ */
+OPENTXS_EXPORT auto SelectCoins(
+    const CoinSelection& params,
+    const std::vector<Amount>& values) noexcept -> std::vector<std::size_t>;
 #endif  // OT_BLOCKCHAIN
 }  // namespace opentxs::blockchain::node::internal
@@ -9,10 +9,12 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/blockchain/Types.hpp"
@@ -20,6 +22,7 @@
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/NymFile.hpp"
 #include "opentxs/core/Types.hpp"
+#include "opentxs/core/crypto/PaymentCode.hpp"
 #include "opentxs/protobuf/ContractEnums.pb.h"
 #include "opentxs/protobuf/PeerEnums.pb.h"
 #include "util/Blank.hpp"
@@ -67,6 +70,28 @@ struct NymFile : virtual public opentxs::NymFile {
     virtual auto LoadSignedNymFile(const PasswordPrompt& reason) -> bool = 0;
     virtual auto SaveSignedNymFile(const PasswordPrompt& reason) -> bool = 0;
 };
+struct PaymentCode : virtual public opentxs::PaymentCode {
+    /// Incoming keys for count consecutive indices, stopping at the first
+    /// index which could not be derived
+    virtual auto IncomingBatch(
+        const opentxs::PaymentCode& sender,
+        const Bip32Index first,
+        const std::size_t count,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason,
+        const std::uint8_t version = 0) const noexcept
+        -> std::vector<ECKey> = 0;
+    /// Outgoing keys for count consecutive indices, stopping at the first
+    /// index which could not be derived
+    virtual auto OutgoingBatch(
+        const opentxs::PaymentCode& recipient,
+        const Bip32Index first,
+        const std::size_t count,
+        const blockchain::Type chain,
+        const PasswordPrompt& reason,
+        const std::uint8_t version = 0) const noexcept
+        -> std::vector<ECKey> = 0;
+};
 }  // namespace opentxs::internal
 
 namespace opentxs::blockchain
@@ -5,9 +5,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 #include "Proto.hpp"
+#include "opentxs/Bytes.hpp"
 
 namespace opentxs
 {
@@ -28,12 +30,16 @@ namespace opentxs::factory
 {
 auto OpenDHT(const network::DhtConfig& config) noexcept
     -> std::unique_ptr<network::OpenDHT>;
-auto ZMQContext() noexcept -> network::zeromq::Context*;
+auto ZMQContext(const std::size_t reactorThreads) noexcept
+    -> network::zeromq::Context*;
 auto ZMQFrame() noexcept -> network::zeromq::Frame*;
 auto ZMQFrame(std::size_t size) noexcept -> network::zeromq::Frame*;
 auto ZMQFrame(const void* data, const std::size_t size) noexcept
     -> network::zeromq::Frame*;
 auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame*;
+auto ZMQFrame(Space&& data) noexcept -> network::zeromq::Frame*;
+auto ZMQFrame(std::shared_ptr<const Space> data) noexcept
+    -> network::zeromq::Frame*;
 auto ZMQMessage() noexcept -> network::zeromq::Message*;
 auto ZMQMessage(const void* data, const std::size_t size) noexcept
     -> network::zeromq::Message*;
@@ -21,6 +21,14 @@
 
 namespace opentxs
 {
+namespace network
+{
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
+}  // namespace network
+
 struct OT_DownloadNymboxType {
 };
 struct OT_GetTransactionNumbersType {
@@ -227,6 +235,9 @@ struct OPENTXS_EXPORT Operation {
     using Result = otx::context::Server::DeliveryResult;
     using Future = std::future<Result>;
 
+    static auto ProcessThreadPool(
+        const network::zeromq::Message& task) noexcept -> void;
+
     virtual auto NymID() const -> const identifier::Nym& = 0;
     virtual auto ServerID() const -> const identifier::Server& = 0;
 
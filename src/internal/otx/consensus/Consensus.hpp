@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "opentxs/otx/consensus/Base.hpp"
 #include "opentxs/otx/consensus/Client.hpp"
 #include "opentxs/otx/consensus/Server.hpp"
@@ -56,6 +58,16 @@ struct Client : virtual public opentxs::otx::context::Client,
 };
 struct Server : virtual public opentxs::otx::context::Server,
                 virtual public otx::context::internal::Base {
+    using Notification = std::function<void()>;
+
+    /** Execute the callback once, the next time a queued message is resolved
+     *  or the context becomes able to accept a new message
+     *
+     *  The callback is executed immediately if the context is idle. It must
+     *  not block and must not call back into the context.
+     */
+    virtual auto Notify(Notification&& callback) const noexcept -> void = 0;
+
 
 #ifdef _MSC_VER
     Server() {}
@@ -451,12 +451,14 @@ struct List : virtual public ui::List {
         const QModelIndex& parent,
         int first,
         int last) const noexcept -> void = 0;
+    virtual auto emit_begin_reset_model() const noexcept -> void = 0;
     virtual auto emit_data_changed(
         const QModelIndex& topLeft,
         const QModelIndex& bottomRight) noexcept -> void = 0;
     virtual auto emit_end_insert_rows() const noexcept -> void = 0;
     virtual auto emit_end_move_rows() const noexcept -> void = 0;
     virtual auto emit_end_remove_rows() const noexcept -> void = 0;
+    virtual auto emit_end_reset_model() const noexcept -> void = 0;
     virtual auto me() const noexcept -> QModelIndex = 0;
     virtual auto register_child(const void* child) const noexcept -> void = 0;
     virtual auto unregister_child(const void* child) const noexcept -> void = 0;
@@ -818,6 +820,7 @@ struct List : virtual public ListType, public Row {
         const noexcept -> void final
     {
     }
+    auto emit_begin_reset_model() const noexcept -> void final {}
     auto emit_data_changed(const QModelIndex&, const QModelIndex&) noexcept
         -> void final
     {
@@ -825,6 +828,7 @@ struct List : virtual public ListType, public Row {
     auto emit_end_insert_rows() const noexcept -> void final {}
     auto emit_end_move_rows() const noexcept -> void final {}
     auto emit_end_remove_rows() const noexcept -> void final {}
+    auto emit_end_reset_model() const noexcept -> void final {}
     auto me() const noexcept -> QModelIndex final { return {}; }
     auto register_child(const void* child) const noexcept -> void final {}
     auto unregister_child(const void* child) const noexcept -> void final {}
@@ -20,6 +20,7 @@
 #include "PairEventListener.hpp"
 #include "internal/network/Factory.hpp"
 #include "internal/network/zeromq/socket/Socket.hpp"
+#include "network/zeromq/Reactor.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/core/Log.hpp"
@@ -49,11 +50,12 @@ template class opentxs::Pimpl<opentxs::network::zeromq::Context>;
 
 namespace opentxs::factory
 {
-auto ZMQContext() noexcept -> network::zeromq::Context*
+auto ZMQContext(const std::size_t reactorThreads) noexcept
+    -> network::zeromq::Context*
 {
     using ReturnType = network::zeromq::implementation::Context;
 
-    return new ReturnType;
+    return new ReturnType(reactorThreads);
 }
 }  // namespace opentxs::factory
 
@@ -125,8 +127,10 @@ auto Context::Z85ToRaw(
 
 namespace opentxs::network::zeromq::implementation
 {
-Context::Context() noexcept
-    : context_(::zmq_ctx_new())
+Context::Context(const std::size_t reactorThreads) noexcept
+    : reactor_threads_(reactorThreads)
+    , context_(::zmq_ctx_new())
+    , reactor_(implementation::Reactor::Factory(reactor_threads_))
 {
     assert(nullptr != context_);
     assert(1 == ::zmq_has("curve"));
@@ -364,6 +368,9 @@ auto Context::TaggedReply(
 
 Context::~Context()
 {
+    // Every socket has been closed by now so no handlers remain registered
+    reactor_.reset();
+
     if (nullptr != context_) {
         zmq_ctx_shutdown(context_);
         auto promise = std::promise<void>{};
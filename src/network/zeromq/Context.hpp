@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <functional>
 #include <iosfwd>
+#include <memory>
 #include <string>
 
 #include "Proto.hpp"
@@ -52,6 +53,11 @@ class ReplyCallback;
 class Factory;
 }  // namespace opentxs
 
+namespace opentxs::network::zeromq::implementation
+{
+class Reactor;
+}  // namespace opentxs::network::zeromq::implementation
+
 namespace opentxs::network::zeromq::implementation
 {
 class Context final : virtual public zeromq::Context
@@ -113,6 +119,12 @@ public:
         -> OTZMQPullSocket final;
     auto PushSocket(const socket::Socket::Direction direction) const noexcept
         -> OTZMQPushSocket final;
+    /// Shared poller for callback sockets, or nullptr if each socket should
+    /// run its own receiver thread
+    auto Reactor() const noexcept -> const implementation::Reactor*
+    {
+        return reactor_.get();
+    }
     auto ReplyMessage(const zeromq::Message& request) const noexcept
         -> OTZMQMessage final;
     auto ReplyMessage(const ReadView connectionID) const noexcept
@@ -142,13 +154,19 @@ public:
     ~Context() final;
 
 private:
-    friend network::zeromq::Context* opentxs::factory::ZMQContext() noexcept;
+    friend network::zeromq::Context* opentxs::factory::ZMQContext(
+        const std::size_t reactorThreads) noexcept;
 
+    const std::size_t reactor_threads_;
     void* context_{nullptr};
+    std::unique_ptr<implementation::Reactor> reactor_;
 
-    auto clone() const noexcept -> Context* final { return new Context; }
+    auto clone() const noexcept -> Context* final
+    {
+        return new Context(reactor_threads_);
+    }
 
-    Context() noexcept;
+    Context(const std::size_t reactorThreads) noexcept;
     Context(const Context&) = delete;
     Context(Context&&) = delete;
     auto operator=(const Context&) -> Context& = delete;
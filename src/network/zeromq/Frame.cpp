@@ -8,6 +8,7 @@
 #include "network/zeromq/Frame.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <utility>
 
 #include "internal/network/Factory.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -36,6 +37,17 @@ auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame*
 {
     return new ReturnType(data);
 }
+
+auto ZMQFrame(Space&& data) noexcept -> network::zeromq::Frame*
+{
+    return new ReturnType(std::move(data));
+}
+
+auto ZMQFrame(std::shared_ptr<const Space> data) noexcept
+    -> network::zeromq::Frame*
+{
+    return new ReturnType(std::move(data));
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::network::zeromq::implementation
@@ -43,6 +55,7 @@ namespace opentxs::network::zeromq::implementation
 Frame::Frame() noexcept
     : zeromq::Frame()
     , message_()
+    , writable_(false)
 {
     const auto init = zmq_msg_init(&message_);
 
@@ -55,6 +68,9 @@ Frame::Frame(const std::size_t bytes) noexcept
     const auto init = zmq_msg_init_size(&message_, bytes);
 
     OT_ASSERT(0 == init);
+
+    // Message::AppendBytes gives the caller a writable view of this buffer
+    writable_ = true;
 }
 
 Frame::Frame(const ProtobufType& input) noexcept
@@ -62,6 +78,7 @@ Frame::Frame(const ProtobufType& input) noexcept
 {
     input.SerializeToArray(
         zmq_msg_data(&message_), static_cast<int>(zmq_msg_size(&message_)));
+    writable_ = false;
 }
 
 Frame::Frame(const void* data, const std::size_t bytes) noexcept
@@ -70,6 +87,36 @@ Frame::Frame(const void* data, const std::size_t bytes) noexcept
     if (0u < bytes) {
         std::memcpy(zmq_msg_data(&message_), data, zmq_msg_size(&message_));
     }
+
+    writable_ = false;
+}
+
+Frame::Frame(Space&& buffer) noexcept
+    : Frame()
+{
+    if (buffer.empty()) { return; }
+
+    auto* holder = new Space(std::move(buffer));
+    const auto init = zmq_msg_init_data(
+        &message_, holder->data(), holder->size(), &release_owned, holder);
+
+    OT_ASSERT(0 == init);
+}
+
+Frame::Frame(std::shared_ptr<const Space> buffer) noexcept
+    : Frame()
+{
+    if ((false == bool(buffer)) || buffer->empty()) { return; }
+
+    auto* holder = new std::shared_ptr<const Space>(std::move(buffer));
+    const auto init = zmq_msg_init_data(
+        &message_,
+        const_cast<std::byte*>((*holder)->data()),
+        (*holder)->size(),
+        &release_shared,
+        holder);
+
+    OT_ASSERT(0 == init);
 }
 
 Frame::operator std::string() const noexcept { return std::string{Bytes()}; }
@@ -83,7 +130,28 @@ auto Frame::Bytes() const noexcept -> ReadView
 
 auto Frame::clone() const noexcept -> Frame*
 {
-    return new Frame(zmq_msg_data(&message_), zmq_msg_size(&message_));
+    // A buffer which may still be written through a view from AppendBytes
+    // gets a private copy. Every other frame is read-only after construction,
+    // so zmq_msg_copy can share its buffer via a reference count.
+    if (writable_) { return new Frame(data(), size()); }
+
+    auto* output = new Frame();
+    const auto copy = zmq_msg_copy(&output->message_, &message_);
+
+    OT_ASSERT(0 == copy);
+
+    return output;
+}
+
+auto Frame::release_owned(void*, void* hint) noexcept -> void
+{
+    std::unique_ptr<Space>(static_cast<Space*>(hint)).reset();
+}
+
+auto Frame::release_shared(void*, void* hint) noexcept -> void
+{
+    using Pointer = std::shared_ptr<const Space>;
+    std::unique_ptr<Pointer>(static_cast<Pointer*>(hint)).reset();
 }
 
 Frame::~Frame() { zmq_msg_close(&message_); }
@@ -8,6 +8,7 @@
 #include <zmq.h>
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <string>
 
 #include "Proto.hpp"
@@ -45,9 +46,18 @@ private:
         const std::size_t) noexcept;
     friend network::zeromq::Frame* opentxs::factory::ZMQFrame(
         const ProtobufType&) noexcept;
+    friend network::zeromq::Frame* opentxs::factory::ZMQFrame(
+        Space&&) noexcept;
+    friend network::zeromq::Frame* opentxs::factory::ZMQFrame(
+        std::shared_ptr<const Space>) noexcept;
     friend network::zeromq::Frame;
 
     mutable zmq_msg_t message_;
+    /// The buffer was handed out for writing and must not be shared
+    bool writable_;
+
+    static auto release_owned(void* data, void* hint) noexcept -> void;
+    static auto release_shared(void* data, void* hint) noexcept -> void;
 
     auto clone() const noexcept -> Frame* final;
 
@@ -55,6 +65,10 @@ private:
     explicit Frame(const ProtobufType& input) noexcept;
     explicit Frame(const std::size_t bytes) noexcept;
     Frame(const void* data, const std::size_t bytes) noexcept;
+    /// Takes ownership of the buffer without copying its contents
+    explicit Frame(Space&& buffer) noexcept;
+    /// Holds a reference to the buffer without copying its contents
+    explicit Frame(std::shared_ptr<const Space> buffer) noexcept;
     Frame(const Frame&) = delete;
     Frame(Frame&&) = delete;
     auto operator=(Frame&&) -> Frame& = delete;
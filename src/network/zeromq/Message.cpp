@@ -95,6 +95,33 @@ auto Message::AddFrame(const void* input, const std::size_t size) -> Frame&
     return frame;
 }
 
+auto Message::AddFrame(const Frame& input) -> Frame&
+{
+    auto& frame = messages_.emplace_back(input);
+
+    if (total_.has_value()) { total_.value() += frame->size(); }
+
+    return frame;
+}
+
+auto Message::AddFrame(Space&& input) -> Frame&
+{
+    auto& frame = messages_.emplace_back(factory::ZMQFrame(std::move(input)));
+
+    if (total_.has_value()) { total_.value() += frame->size(); }
+
+    return frame;
+}
+
+auto Message::AddFrame(std::shared_ptr<const Space> input) -> Frame&
+{
+    auto& frame = messages_.emplace_back(factory::ZMQFrame(std::move(input)));
+
+    if (total_.has_value()) { total_.value() += frame->size(); }
+
+    return frame;
+}
+
 auto Message::AddFrame(const ProtobufType& input) -> Frame&
 {
     auto& frame = messages_.emplace_back(factory::ZMQFrame(input));
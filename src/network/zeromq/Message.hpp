@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -40,6 +41,9 @@ public:
     auto AddFrame() -> Frame& final;
     auto AddFrame(const ProtobufType& input) -> Frame& final;
     auto AddFrame(const void* input, const std::size_t size) -> Frame& final;
+    auto AddFrame(const Frame& input) -> Frame& final;
+    auto AddFrame(Space&& input) -> Frame& final;
+    auto AddFrame(std::shared_ptr<const Space> input) -> Frame& final;
     auto AppendBytes() noexcept -> AllocateOutput final;
     auto at(const std::size_t index) -> Frame& final;
 
@@ -0,0 +1,463 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                // IWYU pragma: associated
+#include "1_Internal.hpp"              // IWYU pragma: associated
+#include "network/zeromq/Reactor.hpp"  // IWYU pragma: associated
+
+#ifdef __linux__
+extern "C" {
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+}
+#endif  // __linux__
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "network/zeromq/Context.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+#define REACTOR_MAX_EVENTS 64
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::Reactor::"
+
+namespace opentxs::network::zeromq::implementation
+{
+namespace
+{
+// Identifies the eventfd used to interrupt epoll_wait
+constexpr auto wake_id_ = std::uint64_t{0};
+// Delay before retrying a busy handler for the first time
+constexpr auto first_retry_ = std::chrono::milliseconds{1};
+// Upper bound for the doubling retry delay of a busy handler
+constexpr auto max_retry_ = std::chrono::milliseconds{100};
+// Queued work which makes no progress for this long while every worker is
+// occupied causes another worker to be started
+constexpr auto stall_interval_ = std::chrono::milliseconds{50};
+
+auto unwatch(const int epoll, const int fd) noexcept -> void
+{
+#ifdef __linux__
+    ::epoll_ctl(epoll, EPOLL_CTL_DEL, fd, nullptr);
+#endif  // __linux__
+}
+
+auto watch(const int epoll, const int fd, const std::uint64_t id) noexcept
+    -> bool
+{
+#ifdef __linux__
+    auto event = ::epoll_event{};
+    event.events = EPOLLIN | EPOLLET;
+    event.data.u64 = id;
+
+    return 0 == ::epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event);
+#else
+    return false;
+#endif  // __linux__
+}
+}  // namespace
+
+thread_local Reactor::Registration* Reactor::current_{nullptr};
+
+Reactor::Registration::Registration(Handler& handler) noexcept
+    : handler_(&handler)
+    , descriptors_(handler.reactor_descriptors())
+    , lock_()
+    , pending_(0)
+    , active_(true)
+    , retry_(0)
+{
+}
+
+auto Reactor::Factory(const std::size_t threads) noexcept
+    -> std::unique_ptr<Reactor>
+{
+    if (0 == threads) { return {}; }
+
+#ifdef __linux__
+    const auto epoll = ::epoll_create1(EPOLL_CLOEXEC);
+
+    if (-1 == epoll) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to create epoll: ")(
+            std::strerror(errno))
+            .Flush();
+
+        return {};
+    }
+
+    const auto wake = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    if (-1 == wake) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to create eventfd: ")(
+            std::strerror(errno))
+            .Flush();
+        ::close(epoll);
+
+        return {};
+    }
+
+    auto event = ::epoll_event{};
+    event.events = EPOLLIN;
+    event.data.u64 = wake_id_;
+
+    if (0 != ::epoll_ctl(epoll, EPOLL_CTL_ADD, wake, &event)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to watch eventfd: ")(
+            std::strerror(errno))
+            .Flush();
+        ::close(wake);
+        ::close(epoll);
+
+        return {};
+    }
+
+    return std::unique_ptr<Reactor>{new Reactor(epoll, wake, threads)};
+#else
+    LogOutput(OT_METHOD)(__FUNCTION__)(
+        ": Reactor mode is not supported on this platform")
+        .Flush();
+
+    return {};
+#endif  // __linux__
+}
+
+auto Reactor::Find(const zeromq::Context& context) noexcept -> const Reactor*
+{
+    const auto* imp = dynamic_cast<const Context*>(&context);
+
+    if (nullptr == imp) { return nullptr; }
+
+    return imp->Reactor();
+}
+
+Reactor::Reactor(
+    const int epoll,
+    const int wake,
+    const std::size_t threads) noexcept
+    : epoll_(epoll)
+    , wake_(wake)
+    , running_(true)
+    , next_id_(wake_id_)
+    , map_lock_()
+    , registrations_()
+    , index_()
+    , queue_lock_()
+    , queue_cv_()
+    , queue_()
+    , deferred_()
+    , idle_(0)
+    , progress_(0)
+    , poller_()
+    , workers_()
+{
+    workers_.reserve(threads);
+
+    for (auto i = std::size_t{0}; i < threads; ++i) {
+        workers_.emplace_back(&Reactor::work, this);
+    }
+
+    poller_ = std::thread{&Reactor::poll, this};
+}
+
+auto Reactor::Add(Handler& handler) const noexcept -> bool
+{
+    auto registration = std::make_shared<Registration>(handler);
+    Lock lock(map_lock_);
+
+    if (0 < index_.count(&handler)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Handler already registered")
+            .Flush();
+
+        return false;
+    }
+
+    const auto id = ++next_id_;
+    const auto& descriptors = registration->descriptors_;
+
+    for (auto i = descriptors.cbegin(); i != descriptors.cend(); ++i) {
+        if (false == watch(epoll_, *i, id)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to watch socket: ")(
+                std::strerror(errno))
+                .Flush();
+
+            for (auto j = descriptors.cbegin(); j != i; ++j) {
+                unwatch(epoll_, *j);
+            }
+
+            return false;
+        }
+    }
+
+    registrations_.emplace(id, std::move(registration));
+    index_.emplace(&handler, id);
+    lock.unlock();
+    // Messages which arrived before the descriptors were added will not
+    // generate an edge so the handler must be processed once unconditionally
+    dispatch(id);
+
+    return true;
+}
+
+auto Reactor::defer(Registration& registration, const ID id) const noexcept
+    -> void
+{
+    auto& retry = registration.retry_;
+    retry = (0 == retry.count()) ? first_retry_
+                                 : std::min<std::chrono::milliseconds>(
+                                       2 * retry, max_retry_);
+    Lock lock(queue_lock_);
+    deferred_.emplace(Clock::now() + retry, id);
+    lock.unlock();
+    wake();
+}
+
+auto Reactor::dispatch(const ID id) const noexcept -> void
+{
+    const auto registration = find(id);
+
+    if (false == bool(registration)) { return; }
+
+    if (0 == registration->pending_.fetch_add(1)) {
+        Lock lock(queue_lock_);
+        queue_.push(id);
+        const auto stalled = (0 == idle_);
+        queue_cv_.notify_one();
+        lock.unlock();
+
+        // The poller only watches for stalls while work is waiting
+        if (stalled) { wake(); }
+    }
+}
+
+auto Reactor::find(const ID id) const noexcept -> RegistrationPointer
+{
+    Lock lock(map_lock_);
+    const auto it = registrations_.find(id);
+
+    if (registrations_.end() == it) { return {}; }
+
+    return it->second;
+}
+
+auto Reactor::poll() const noexcept -> void
+{
+#ifdef __linux__
+    ::epoll_event events[REACTOR_MAX_EVENTS]{};
+    auto progress = std::size_t{0};
+    auto since = Clock::now();
+
+    while (running_) {
+        const auto count = ::epoll_wait(
+            epoll_, events, REACTOR_MAX_EVENTS, poll_timeout());
+
+        if (-1 == count) {
+            if (EINTR != errno) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Poll error: ")(
+                    std::strerror(errno))
+                    .Flush();
+            }
+
+            continue;
+        }
+
+        for (auto i = int{0}; i < count; ++i) {
+            const auto id = events[i].data.u64;
+
+            if (wake_id_ == id) {
+                auto value = std::uint64_t{};
+                [[maybe_unused]] const auto bytes =
+                    ::read(wake_, &value, sizeof(value));
+
+                continue;
+            }
+
+            dispatch(id);
+        }
+
+        const auto now = Clock::now();
+        Lock lock(queue_lock_);
+
+        if (false == running_) { return; }
+
+        while ((false == deferred_.empty()) &&
+               (deferred_.begin()->first <= now)) {
+            // Events for a deferred handler are still counted in pending_
+            // so nothing else will have queued it
+            queue_.push(deferred_.begin()->second);
+            deferred_.erase(deferred_.begin());
+            queue_cv_.notify_one();
+        }
+
+        if (queue_.empty() || (0 < idle_) || (progress != progress_)) {
+            progress = progress_;
+            since = now;
+        } else if ((now - since) >= stall_interval_) {
+            LogDetail(OT_METHOD)(__FUNCTION__)(
+                ": All workers are blocked. Adding worker ")(
+                workers_.size() + 1)
+                .Flush();
+            workers_.emplace_back(&Reactor::work, this);
+            since = now;
+        }
+    }
+#endif  // __linux__
+}
+
+auto Reactor::poll_timeout() const noexcept -> int
+{
+    using std::chrono::milliseconds;
+    auto output = int{-1};
+    Lock lock(queue_lock_);
+
+    if (false == deferred_.empty()) {
+        const auto wait = std::chrono::ceil<milliseconds>(
+            deferred_.begin()->first - Clock::now());
+        output = static_cast<int>(std::max(wait.count(), milliseconds::rep{0}));
+    }
+
+    if ((false == queue_.empty()) && (0 == idle_)) {
+        const auto stall = static_cast<int>(stall_interval_.count());
+        output = (-1 == output) ? stall : std::min(output, stall);
+    }
+
+    return output;
+}
+
+auto Reactor::process(Registration& registration) const noexcept -> bool
+{
+    Lock lock(registration.lock_);
+    auto output{true};
+    current_ = &registration;
+
+    while (registration.active_) {
+        const auto pending = registration.pending_.load();
+
+        if (false == registration.handler_->reactor_process()) {
+            output = false;
+
+            break;
+        }
+
+        if (pending == registration.pending_.fetch_sub(pending)) { break; }
+    }
+
+    current_ = nullptr;
+
+    return output || (false == registration.active_);
+}
+
+auto Reactor::Remove(const Handler& handler) const noexcept -> void
+{
+    Lock lock(map_lock_);
+    const auto index = index_.find(&handler);
+
+    if (index_.end() == index) { return; }
+
+    const auto id = index->second;
+    index_.erase(index);
+    const auto it = registrations_.find(id);
+
+    OT_ASSERT(registrations_.end() != it);
+
+    auto registration = it->second;
+    registrations_.erase(it);
+
+    for (const auto fd : registration->descriptors_) { unwatch(epoll_, fd); }
+
+    lock.unlock();
+
+    if (current_ == registration.get()) {
+        // Called from inside reactor_process() which already holds the lock
+        registration->active_ = false;
+
+        return;
+    }
+
+    Lock registrationLock(registration->lock_);
+    registration->active_ = false;
+}
+
+auto Reactor::Schedule(const Handler& handler) const noexcept -> void
+{
+    Lock lock(map_lock_);
+    const auto it = index_.find(&handler);
+
+    if (index_.end() == it) { return; }
+
+    const auto id = it->second;
+    lock.unlock();
+    dispatch(id);
+}
+
+auto Reactor::wake() const noexcept -> void
+{
+#ifdef __linux__
+    const auto value = std::uint64_t{1};
+    [[maybe_unused]] const auto bytes = ::write(wake_, &value, sizeof(value));
+#endif  // __linux__
+}
+
+auto Reactor::work() const noexcept -> void
+{
+    while (true) {
+        Lock lock(queue_lock_);
+        ++idle_;
+        queue_cv_.wait(lock, [&] { return !running_ || !queue_.empty(); });
+        --idle_;
+
+        if (false == running_) { return; }
+
+        const auto id = queue_.front();
+        queue_.pop();
+        ++progress_;
+        lock.unlock();
+        const auto registration = find(id);
+
+        if (false == bool(registration)) { continue; }
+
+        if (process(*registration)) {
+            registration->retry_ = std::chrono::milliseconds{0};
+        } else {
+            // Pending events remain counted, so the handler is not queued
+            // again until the poller releases it after the retry delay
+            defer(*registration, id);
+        }
+    }
+}
+
+auto Reactor::Workers() const noexcept -> std::size_t
+{
+    Lock lock(queue_lock_);
+
+    return workers_.size();
+}
+
+Reactor::~Reactor()
+{
+    {
+        Lock lock(queue_lock_);
+        running_ = false;
+    }
+
+    queue_cv_.notify_all();
+    wake();
+
+    if (poller_.joinable()) { poller_.join(); }
+
+    // The poller is the only thread which adds workers
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+
+#ifdef __linux__
+    ::close(wake_);
+    ::close(epoll_);
+#endif  // __linux__
+}
+}  // namespace opentxs::network::zeromq::implementation
@@ -0,0 +1,145 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/Version.hpp"
+
+namespace opentxs
+{
+namespace network
+{
+namespace zeromq
+{
+class Context;
+}  // namespace zeromq
+}  // namespace network
+}  // namespace opentxs
+
+namespace opentxs::network::zeromq::implementation
+{
+/** Multiplexes many callback sockets onto a fixed set of threads
+ *
+ *  A single poller thread waits on the ZMQ_FD descriptor of every registered
+ *  socket via epoll in edge-triggered mode. Readiness is dispatched to a pool
+ *  of worker threads which call Handler::reactor_process(). A handler is
+ *  never processed by more than one worker at a time, and events which
+ *  arrive while it is being processed cause it to run again before the
+ *  worker releases it.
+ *
+ *  Because ZMQ_FD is edge-triggered, reactor_process() must keep receiving
+ *  until ZMQ_EVENTS no longer reports ZMQ_POLLIN on each of its sockets.
+ *
+ *  A handler which reports that it is busy is retried after a delay which
+ *  doubles on each consecutive failure. If queued work makes no progress
+ *  while every worker is occupied, for example because callbacks are blocked
+ *  waiting on other reactor sockets, the poller adds another worker.
+ */
+class OPENTXS_EXPORT Reactor
+{
+public:
+    class OPENTXS_EXPORT Handler
+    {
+    public:
+        /// ZMQ_FD values for every socket owned by the handler
+        virtual auto reactor_descriptors() const noexcept
+            -> std::vector<int> = 0;
+        /// Returns false if the handler could not run and must be retried
+        virtual auto reactor_process() noexcept -> bool = 0;
+
+        virtual ~Handler() = default;
+    };
+
+    static auto Factory(const std::size_t threads) noexcept
+        -> std::unique_ptr<Reactor>;
+    /// Number of worker threads, including any added to avoid a stall
+    auto Workers() const noexcept -> std::size_t;
+    /// Returns nullptr if the context does not operate in reactor mode
+    static auto Find(const zeromq::Context& context) noexcept
+        -> const Reactor*;
+
+    /// Begin polling the descriptors of the handler
+    auto Add(Handler& handler) const noexcept -> bool;
+    /** Stop polling the handler
+     *
+     *  On return the handler is not being processed and will not be processed
+     *  again. May be called from inside reactor_process() of the same handler.
+     */
+    auto Remove(const Handler& handler) const noexcept -> void;
+    /// Run reactor_process() for the handler even if no descriptor fired
+    auto Schedule(const Handler& handler) const noexcept -> void;
+
+    ~Reactor();
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using ID = std::uint64_t;
+
+    struct Registration {
+        Handler* handler_;
+        const std::vector<int> descriptors_;
+        std::mutex lock_;
+        std::atomic<std::size_t> pending_;
+        bool active_;
+        /// Current retry delay, only accessed by the worker processing it
+        std::chrono::milliseconds retry_;
+
+        Registration(Handler& handler) noexcept;
+    };
+
+    using RegistrationPointer = std::shared_ptr<Registration>;
+
+    static thread_local Registration* current_;
+
+    const int epoll_;
+    const int wake_;
+    mutable std::atomic<bool> running_;
+    mutable std::atomic<ID> next_id_;
+    mutable std::mutex map_lock_;
+    mutable std::map<ID, RegistrationPointer> registrations_;
+    mutable std::map<const Handler*, ID> index_;
+    mutable std::mutex queue_lock_;
+    mutable std::condition_variable queue_cv_;
+    mutable std::queue<ID> queue_;
+    mutable std::multimap<Clock::time_point, ID> deferred_;
+    mutable std::size_t idle_;
+    mutable std::size_t progress_;
+    std::thread poller_;
+    mutable std::vector<std::thread> workers_;
+
+    auto defer(Registration& registration, const ID id) const noexcept
+        -> void;
+    auto dispatch(const ID id) const noexcept -> void;
+    auto find(const ID id) const noexcept -> RegistrationPointer;
+    auto poll() const noexcept -> void;
+    auto poll_timeout() const noexcept -> int;
+    auto process(Registration& registration) const noexcept -> bool;
+    auto wake() const noexcept -> void;
+    auto work() const noexcept -> void;
+
+    Reactor(
+        const int epoll,
+        const int wake,
+        const std::size_t threads) noexcept;
+    Reactor() = delete;
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    auto operator=(const Reactor&) -> Reactor& = delete;
+    auto operator=(Reactor&&) -> Reactor& = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
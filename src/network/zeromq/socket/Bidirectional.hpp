@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "network/zeromq/socket/Receiver.hpp"
 #include "network/zeromq/socket/Receiver.tpp"
@@ -68,6 +69,8 @@ private:
         const std::string& endpoint) const noexcept -> bool;
 
     auto process_pull_socket(const Lock& lock) noexcept -> bool;
+    auto reactor_descriptors() const noexcept -> std::vector<int> final;
+    auto reactor_process() noexcept -> bool final;
     auto process_receiver_socket(const Lock& lock) noexcept -> bool;
     auto send(zeromq::Message& message) const noexcept -> bool final;
     auto send(const Lock& lock, zeromq::Message& message) noexcept -> bool;
@@ -150,10 +150,7 @@ void Bidirectional<InterfaceType, MessageType>::init() noexcept
 
     Socket::init();
 
-    if (bidirectional_start_thread_) {
-        this->receiver_thread_ = std::thread(
-            &Bidirectional<InterfaceType, MessageType>::thread, this);
-    }
+    if (bidirectional_start_thread_) { this->start_receiver(); }
 }
 
 template <typename InterfaceType, typename MessageType>
@@ -189,6 +186,48 @@ auto Bidirectional<InterfaceType, MessageType>::process_receiver_socket(
     return true;
 }
 
+template <typename InterfaceType, typename MessageType>
+auto Bidirectional<InterfaceType, MessageType>::reactor_descriptors()
+    const noexcept -> std::vector<int>
+{
+    return {
+        Socket::socket_descriptor(this->socket_),
+        Socket::socket_descriptor(pull_socket_.get())};
+}
+
+template <typename InterfaceType, typename MessageType>
+auto Bidirectional<InterfaceType, MessageType>::reactor_process() noexcept
+    -> bool
+{
+    if (false == this->running_.get()) { return true; }
+
+    if (false == this->have_callback()) { return false; }
+
+    Lock lock(this->lock_, std::try_to_lock);
+
+    if (false == lock.owns_lock()) { return false; }
+
+    this->start_endpoints(lock);
+    this->run_tasks(lock);
+    auto processed{true};
+
+    // Sending on the main socket may consume the edge for pending incoming
+    // messages so both sockets are drained until neither is readable
+    while (processed && this->running_.get()) {
+        processed = false;
+
+        if (Socket::socket_readable(lock, this->socket_)) {
+            processed |= process_receiver_socket(lock);
+        }
+
+        if (pull_socket_ && Socket::socket_readable(lock, pull_socket_.get())) {
+            processed |= process_pull_socket(lock);
+        }
+    }
+
+    return true;
+}
+
 template <typename InterfaceType, typename MessageType>
 auto Bidirectional<InterfaceType, MessageType>::send(
     zeromq::Message& message) const noexcept -> bool
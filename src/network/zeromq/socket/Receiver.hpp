@@ -5,10 +5,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <thread>
+#include <vector>
 
+#include "network/zeromq/Reactor.hpp"
 #include "network/zeromq/socket/Socket.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
@@ -34,7 +38,9 @@ class Context;
 namespace opentxs::network::zeromq::socket::implementation
 {
 template <typename InterfaceType, typename MessageType = zeromq::Message>
-class Receiver : virtual public InterfaceType, public Socket
+class Receiver : virtual public InterfaceType,
+                 public Socket,
+                 public zeromq::implementation::Reactor::Handler
 {
 public:
     auto apply_socket(SocketCallback&& cb) const noexcept -> bool override;
@@ -42,16 +48,26 @@ public:
 
 protected:
     const bool start_thread_;
+    const zeromq::implementation::Reactor* const reactor_;
+    mutable std::atomic<bool> registered_;
     mutable std::thread receiver_thread_;
 
     virtual auto have_callback() const noexcept -> bool { return false; }
+    auto reactor_descriptors() const noexcept -> std::vector<int> override;
     void run_tasks(const Lock& lock) const noexcept;
+    void start_endpoints(const Lock& lock) const noexcept;
 
     void init() noexcept override;
+    void notify() const noexcept final;
     virtual void process_incoming(
         const Lock& lock,
         MessageType& message) noexcept = 0;
+    auto reactor_process() noexcept -> bool override;
     void shutdown(const Lock& lock) noexcept override;
+    /// Registers with the context reactor if one exists, otherwise starts a
+    /// dedicated thread running thread()
+    void start_receiver() noexcept;
+    void stop_receiver() const noexcept;
     virtual void thread() noexcept;
 
     Receiver(
@@ -65,12 +81,12 @@ protected:
 private:
     mutable int next_task_;
     mutable std::mutex task_lock_;
+    mutable std::condition_variable task_cv_;
     mutable std::map<int, SocketCallback> socket_tasks_;
     mutable std::map<int, bool> task_result_;
 
     auto add_task(SocketCallback&& cb) const noexcept -> int;
     auto task_result(const int id) const noexcept -> bool;
-    auto task_running(const int id) const noexcept -> bool;
 
     Receiver() = delete;
     Receiver(const Receiver&) = delete;
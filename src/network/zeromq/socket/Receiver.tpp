@@ -28,9 +28,12 @@ Receiver<InterfaceType, MessageType>::Receiver(
     const bool startThread) noexcept
     : Socket(context, type, direction)
     , start_thread_(startThread)
+    , reactor_(zeromq::implementation::Reactor::Find(context))
+    , registered_(false)
     , receiver_thread_()
     , next_task_(0)
     , task_lock_()
+    , task_cv_()
     , socket_tasks_()
     , task_result_()
 {
@@ -53,10 +56,10 @@ auto Receiver<InterfaceType, MessageType>::apply_socket(
     SocketCallback&& cb) const noexcept -> bool
 {
     const auto id = add_task(std::move(cb));
-
-    while (task_running(id)) {
-        Sleep(std::chrono::milliseconds(RECEIVER_POLL_MILLISECONDS));
-    }
+    notify();
+    Lock lock(task_lock_);
+    task_cv_.wait(lock, [&] { return 0 == socket_tasks_.count(id); });
+    lock.unlock();
 
     return task_result(id);
 }
@@ -65,8 +68,7 @@ template <typename InterfaceType, typename MessageType>
 auto Receiver<InterfaceType, MessageType>::Close() const noexcept -> bool
 {
     running_->Off();
-
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+    stop_receiver();
 
     return Socket::Close();
 }
@@ -76,9 +78,51 @@ void Receiver<InterfaceType, MessageType>::init() noexcept
 {
     Socket::init();
 
-    if (start_thread_) {
-        receiver_thread_ = std::thread(&Receiver::thread, this);
+    if (start_thread_) { start_receiver(); }
+}
+
+template <typename InterfaceType, typename MessageType>
+void Receiver<InterfaceType, MessageType>::notify() const noexcept
+{
+    if (registered_.load()) { reactor_->Schedule(*this); }
+}
+
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::reactor_descriptors() const noexcept
+    -> std::vector<int>
+{
+    return {Socket::socket_descriptor(socket_)};
+}
+
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::reactor_process() noexcept -> bool
+{
+    if (false == running_.get()) { return true; }
+
+    if (false == have_callback()) { return false; }
+
+    Lock lock(lock_, std::try_to_lock);
+
+    if (false == lock.owns_lock()) { return false; }
+
+    start_endpoints(lock);
+    run_tasks(lock);
+
+    while (running_.get() && Socket::socket_readable(lock, socket_)) {
+        auto reply = MessageType::Factory();
+        const auto received = Socket::receive_message(lock, socket_, reply);
+
+        if (false == received) {
+            std::cerr << RECEIVER_METHOD << __FUNCTION__
+                      << ": Failed to receive incoming message." << std::endl;
+
+            break;
+        }
+
+        process_incoming(lock, reply);
     }
+
+    return true;
 }
 
 template <typename InterfaceType, typename MessageType>
@@ -86,6 +130,9 @@ void Receiver<InterfaceType, MessageType>::run_tasks(
     const Lock& lock) const noexcept
 {
     Lock task_lock(task_lock_);
+
+    if (socket_tasks_.empty()) { return; }
+
     auto i = socket_tasks_.begin();
 
     while (i != socket_tasks_.end()) {
@@ -93,16 +140,45 @@ void Receiver<InterfaceType, MessageType>::run_tasks(
         task_result_.emplace(id, cb(lock));
         i = socket_tasks_.erase(i);
     }
+
+    task_lock.unlock();
+    task_cv_.notify_all();
 }
 
 template <typename InterfaceType, typename MessageType>
 void Receiver<InterfaceType, MessageType>::shutdown(const Lock& lock) noexcept
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
-
+    stop_receiver();
     Socket::shutdown(lock);
 }
 
+template <typename InterfaceType, typename MessageType>
+void Receiver<InterfaceType, MessageType>::start_endpoints(
+    const Lock& lock) const noexcept
+{
+    for (const auto& endpoint : endpoint_queue_.pop()) {
+        start(lock, endpoint);
+    }
+}
+
+template <typename InterfaceType, typename MessageType>
+void Receiver<InterfaceType, MessageType>::start_receiver() noexcept
+{
+    if ((nullptr != reactor_) && reactor_->Add(*this)) {
+        registered_.store(true);
+    } else {
+        receiver_thread_ = std::thread(&Receiver::thread, this);
+    }
+}
+
+template <typename InterfaceType, typename MessageType>
+void Receiver<InterfaceType, MessageType>::stop_receiver() const noexcept
+{
+    if (registered_.exchange(false)) { reactor_->Remove(*this); }
+
+    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+}
+
 template <typename InterfaceType, typename MessageType>
 auto Receiver<InterfaceType, MessageType>::task_result(
     const int id) const noexcept -> bool
@@ -118,15 +194,6 @@ auto Receiver<InterfaceType, MessageType>::task_result(
     return output;
 }
 
-template <typename InterfaceType, typename MessageType>
-auto Receiver<InterfaceType, MessageType>::task_running(
-    const int id) const noexcept -> bool
-{
-    Lock lock(task_lock_);
-
-    return (1 == socket_tasks_.count(id));
-}
-
 template <typename InterfaceType, typename MessageType>
 void Receiver<InterfaceType, MessageType>::thread() noexcept
 {
@@ -182,6 +249,6 @@ void Receiver<InterfaceType, MessageType>::thread() noexcept
 template <typename InterfaceType, typename MessageType>
 Receiver<InterfaceType, MessageType>::~Receiver()
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+    stop_receiver();
 }
 }  // namespace opentxs::network::zeromq::socket::implementation
@@ -321,6 +321,35 @@ auto Socket::StartAsync(const std::string& endpoint) const noexcept -> void
 {
     Lock lock{endpoint_queue_.lock_};
     endpoint_queue_.queue_.push(endpoint);
+    lock.unlock();
+    notify();
+}
+
+auto Socket::socket_descriptor(void* socket) noexcept -> int
+{
+    OT_ASSERT(nullptr != socket);
+
+    auto output = int{-1};
+    auto size = sizeof(output);
+
+    if (0 != zmq_getsockopt(socket, ZMQ_FD, &output, &size)) { return -1; }
+
+    return output;
+}
+
+auto Socket::socket_readable(const Lock& lock, void* socket) noexcept -> bool
+{
+    OT_ASSERT(nullptr != socket);
+    OT_ASSERT(lock.owns_lock());
+
+    auto events = int{0};
+    auto size = sizeof(events);
+
+    if (0 != zmq_getsockopt(socket, ZMQ_EVENTS, &events, &size)) {
+        return false;
+    }
+
+    return ZMQ_POLLIN == (events & ZMQ_POLLIN);
 }
 
 auto Socket::start(const Lock& lock, const std::string& endpoint) const noexcept
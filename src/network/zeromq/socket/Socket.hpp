@@ -57,6 +57,11 @@ public:
         const Lock& lock,
         void* socket,
         zeromq::Message& message) noexcept -> bool;
+    /// The ZMQ_FD descriptor which signals state changes of the socket
+    static auto socket_descriptor(void* socket) noexcept -> int;
+    /// True if ZMQ_EVENTS indicates a message can be received without waiting
+    static auto socket_readable(const Lock& lock, void* socket) noexcept
+        -> bool;
 
     auto Type() const noexcept -> SocketType final { return type_; }
 
@@ -126,6 +131,8 @@ protected:
         -> bool;
 
     virtual void init() noexcept {}
+    /// Called when work has been queued for the socket by another thread
+    virtual void notify() const noexcept {}
     virtual void shutdown(const Lock& lock) noexcept;
 
     explicit Socket(
@@ -24,8 +24,10 @@
 #include "Proto.tpp"
 #include "core/OTStorage.hpp"
 #include "core/StateMachine.hpp"
+#include "internal/api/Api.hpp"
 #include "internal/api/client/Client.hpp"
 #include "internal/otx/client/Client.hpp"
+#include "internal/otx/consensus/Consensus.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Shared.hpp"
@@ -38,6 +40,7 @@
 #include "opentxs/api/client/Activity.hpp"
 #include "opentxs/api/client/PaymentWorkflowState.hpp"
 #include "opentxs/api/client/Workflow.hpp"
+#include "opentxs/api/network/Network.hpp"
 #if OT_CASH
 #include "opentxs/blind/Mint.hpp"
 #include "opentxs/blind/Purse.hpp"
@@ -68,6 +71,9 @@
 #include "opentxs/crypto/Envelope.hpp"
 #include "opentxs/ext/OTPayment.hpp"
 #include "opentxs/identity/Nym.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/otx/LastReplyStatus.hpp"
 #include "opentxs/otx/OperationType.hpp"
 #include "opentxs/otx/Types.hpp"
@@ -98,8 +104,6 @@
                                                                                \
     reset();
 
-#define OPERATION_POLL_MILLISECONDS 100
-#define OPERATION_JOIN_MILLISECONDS OPERATION_POLL_MILLISECONDS
 #define MAX_ERROR_COUNT 3
 
 #define OT_METHOD "opentxs::otx::client::implementation::Operation::"
@@ -302,6 +306,29 @@ auto Factory::Operation(
 }
 }  // namespace opentxs
 
+namespace opentxs::otx::client::internal
+{
+auto Operation::ProcessThreadPool(const zmq::Message& in) noexcept -> void
+{
+    const auto body = in.Body();
+
+    if (1 > body.size()) {
+        LogOutput("opentxs::otx::client::internal::Operation::")(__FUNCTION__)(
+            ": Invalid message")
+            .Flush();
+
+        OT_FAIL;
+    }
+
+    auto* pOperation = reinterpret_cast<implementation::Operation*>(
+        body.at(0).as<std::uintptr_t>());
+
+    OT_ASSERT(nullptr != pOperation);
+
+    pOperation->process_job();
+}
+}  // namespace opentxs::otx::client::internal
+
 namespace opentxs::otx::client::implementation
 {
 const std::map<otx::OperationType, Operation::Category> Operation::category_{
@@ -399,16 +426,19 @@ Operation::Operation(
     , peer_reply_(api_.Factory().PeerReply())
     , peer_request_(api_.Factory().PeerRequest())
     , set_id_()
+    , reply_()
+    , refresh_nymbox_(false)
+    , sync_()
+    , jobs_(0)
+    , waker_(std::make_shared<Waker>(*this))
 {
 }
 
 void Operation::account_pre()
 {
-    otx::context::Server::DeliveryResult lastResult{};
-
     switch (category_.at(type_)) {
         case Category::Transaction: {
-            download_accounts(State::Execute, State::NymboxPre, lastResult);
+            download_accounts(State::Execute, State::NymboxPre);
         } break;
         default: {
             state_.store(State::Execute);
@@ -418,10 +448,8 @@ void Operation::account_pre()
 
 void Operation::account_post()
 {
-    otx::context::Server::DeliveryResult lastResult{};
-
-    if (download_accounts(State::NymboxPost, State::NymboxPre, lastResult)) {
-        if (false == result_set_.load()) { set_result(std::move(lastResult)); }
+    if (download_accounts(State::NymboxPost, State::NymboxPre)) {
+        if (false == result_set_.load()) { set_result(std::move(sync_.last_)); }
 
         affected_accounts_ = redownload_accounts_;
         redownload_accounts_.clear();
@@ -446,13 +474,6 @@ auto Operation::AddClaim(
     return start(lock, otx::OperationType::AddClaim, {});
 }
 
-auto Operation::check_future(otx::context::Server::SendFuture& future) -> bool
-{
-    return std::future_status::ready !=
-           future.wait_for(
-               std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
-}
-
 auto Operation::construct() -> std::shared_ptr<Message>
 {
     switch (type_.load()) {
@@ -1519,26 +1540,48 @@ auto Operation::DepositCheque(
 
 auto Operation::download_accounts(
     const State successState,
-    const State failState,
-    otx::context::Server::DeliveryResult& lastResult) -> bool
+    const State failState) -> bool
 {
-    if (affected_accounts_.empty()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Warning: no accounts to update")
-            .Flush();
-        state_.store(successState);
+    auto& sync = sync_;
 
-        return true;
-    }
+    if (false == sync.active_) {
+        sync = AccountSync{};
 
-    std::size_t ready{0};
+        if (affected_accounts_.empty()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Warning: no accounts to update")
+                .Flush();
+            state_.store(successState);
+
+            return true;
+        }
+
+        sync.active_ = true;
+        sync.accounts_.assign(
+            affected_accounts_.begin(), affected_accounts_.end());
+    }
 
-    for (const auto& accountID : affected_accounts_) {
+    while (sync.next_ < sync.accounts_.size()) {
         if (shutdown().load()) { return false; }
 
-        ready += download_account(accountID, lastResult);
+        const auto progress = download_account(sync.accounts_.at(sync.next_));
+
+        if (Progress::Waiting == progress) { return false; }
+
+        if (Progress::Success == progress) { ++sync.ready_; }
+
+        ++sync.next_;
+        sync.step_ = AccountStep::GetAccountData;
+        sync.inbox_.reset();
+        sync.outbox_.reset();
+        sync.receipts_.clear();
+        sync.receipt_ = 0;
+        sync.receipts_failed_ = false;
     }
 
-    if (affected_accounts_.size() == ready) {
+    sync.active_ = false;
+
+    if (sync.accounts_.size() == sync.ready_) {
         LogDetail(OT_METHOD)(__FUNCTION__)(": All accounts synchronized")
             .Flush();
         state_.store(successState);
@@ -1553,112 +1596,136 @@ auto Operation::download_accounts(
     return false;
 }
 
-auto Operation::download_account(
-    const Identifier& accountID,
-    otx::context::Server::DeliveryResult& lastResult) -> std::size_t
+auto Operation::download_account(const Identifier& accountID) -> Progress
 {
-    std::shared_ptr<Ledger> inbox{api_.Factory().Ledger(
-        nym_id_, accountID, server_id_, ledgerType::inbox)};
-    std::shared_ptr<Ledger> outbox{api_.Factory().Ledger(
-        nym_id_, accountID, server_id_, ledgerType::outbox)};
+    auto& sync = sync_;
 
-    OT_ASSERT(inbox);
-    OT_ASSERT(outbox);
-    OT_ASSERT(ledgerType::inbox == inbox->GetType());
-    OT_ASSERT(ledgerType::outbox == outbox->GetType());
+    switch (sync.step_) {
+        case AccountStep::GetAccountData: {
+            const auto progress = get_account_data(accountID);
 
-    if (get_account_data(accountID, inbox, outbox, lastResult)) {
-        LogDetail(OT_METHOD)(__FUNCTION__)(": Success downloading account ")(
-            accountID)
-            .Flush();
-    } else {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed downloading account ")(
-            accountID)
-            .Flush();
+            if (Progress::Waiting == progress) { return progress; }
 
-        return 0;
-    }
+            if (Progress::Success == progress) {
+                LogDetail(OT_METHOD)(__FUNCTION__)(
+                    ": Success downloading account ")(accountID)
+                    .Flush();
+            } else {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed downloading account ")(accountID)
+                    .Flush();
 
-    if (shutdown().load()) { return 0; }
+                return progress;
+            }
 
-    if (get_receipts(accountID, inbox, outbox)) {
-        LogDetail(OT_METHOD)(__FUNCTION__)(": Success synchronizing account ")(
-            accountID)
-            .Flush();
-    } else {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed synchronizing account ")(
-            accountID)
-            .Flush();
+            if (shutdown().load()) { return Progress::Failure; }
 
-        return 0;
-    }
+            list_receipts(BoxType::Inbox, *sync.inbox_);
+            list_receipts(BoxType::Outbox, *sync.outbox_);
+            sync.step_ = AccountStep::GetReceipts;
+            [[fallthrough]];
+        }
+        case AccountStep::GetReceipts: {
+            const auto progress = get_receipts(accountID);
 
-    if (shutdown().load()) { return 0; }
+            if (Progress::Waiting == progress) { return progress; }
 
-    if (process_inbox(accountID, inbox, outbox, lastResult)) {
-        LogDetail(OT_METHOD)(__FUNCTION__)(": Success processing inbox ")(
-            accountID)
-            .Flush();
+            if (Progress::Success == progress) {
+                LogDetail(OT_METHOD)(__FUNCTION__)(
+                    ": Success synchronizing account ")(accountID)
+                    .Flush();
+            } else {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed synchronizing account ")(accountID)
+                    .Flush();
 
-        return 1;
-    } else {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed processing inbox ")(
-            accountID)
-            .Flush();
+                return progress;
+            }
+
+            if (shutdown().load()) { return Progress::Failure; }
 
-        return 0;
+            sync.step_ = AccountStep::ProcessInbox;
+            [[fallthrough]];
+        }
+        case AccountStep::ProcessInbox:
+        default: {
+            const auto progress = process_inbox(accountID);
+
+            if (Progress::Success == progress) {
+                LogDetail(OT_METHOD)(__FUNCTION__)(
+                    ": Success processing inbox ")(accountID)
+                    .Flush();
+            } else if (Progress::Failure == progress) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed processing inbox ")(accountID)
+                    .Flush();
+            }
+
+            return progress;
+        }
     }
 }
 
 auto Operation::download_box_receipt(
     const Identifier& accountID,
     const BoxType box,
-    const TransactionNumber number) -> bool
+    const TransactionNumber number) -> Progress
 {
+    auto& command = sync_.request_;
+
     PREPARE_CONTEXT();
 
-    [[maybe_unused]] auto [requestNumber, message] =
-        context.InitializeServerCommand(
-            MessageType::getBoxReceipt, -1, false, false);
+    if (false == bool(reply_)) {
+        if (false == bool(command)) {
+            [[maybe_unused]] auto [requestNumber, message] =
+                context.InitializeServerCommand(
+                    MessageType::getBoxReceipt, -1, false, false);
 
-    if (false == bool(message)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct message")
-            .Flush();
+            if (false == bool(message)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to construct message")
+                    .Flush();
 
-        return false;
-    }
+                return Progress::Failure;
+            }
 
-    std::shared_ptr<Message> command{message.release()};
+            command.reset(message.release());
 
-    OT_ASSERT(command);
+            OT_ASSERT(command);
 
-    command->m_strAcctID = String::Factory(accountID);
-    command->m_lDepth = static_cast<std::int32_t>(box);
-    command->m_lTransactionNum = number;
-    const auto finalized = context.FinalizeServerCommand(*command, reason_);
+            command->m_strAcctID = String::Factory(accountID);
+            command->m_lDepth = static_cast<std::int32_t>(box);
+            command->m_lTransactionNum = number;
+            const auto finalized =
+                context.FinalizeServerCommand(*command, reason_);
 
-    if (false == finalized) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to sign message").Flush();
+            if (false == finalized) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to sign message")
+                    .Flush();
+                command.reset();
 
-        return false;
-    }
+                return Progress::Failure;
+            }
+        }
 
-    context.SetPush(enable_otx_push_.load());
-    auto result = context.Queue(api_, command, reason_, {});
+        reply_ = context.Queue(api_, command, reason_, {});
 
-    while (false == bool(result)) {
-        LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
-        result = context.Queue(api_, command, reason_, {});
+        if (false == bool(reply_)) {
+            LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
+            wait_for_context(context);
+
+            return Progress::Waiting;
+        }
     }
 
-    OT_ASSERT(result);
+    if (false == reply_ready(context)) { return Progress::Waiting; }
 
-    while (check_future(*result)) {
-        if (shutdown().load()) { return false; }
-    }
+    command.reset();
+    const auto status = std::get<0>(take_reply());
 
-    return otx::LastReplyStatus::MessageSuccess == std::get<0>(result->get());
+    return (otx::LastReplyStatus::MessageSuccess == status)
+               ? Progress::Success
+               : Progress::Failure;
 }
 
 auto Operation::DownloadContract(const Identifier& ID, const ContractType type)
@@ -1783,57 +1850,57 @@ auto Operation::evaluate_transaction_reply(
 
 void Operation::execute()
 {
-    if (refresh_account_.load()) {
-        state_.store(State::AccountPost);
+    if (false == bool(reply_)) {
+        if (refresh_account_.load()) {
+            state_.store(State::AccountPost);
 
-        return;
-    }
+            return;
+        }
 
-    if (result_set_.load()) {
-        state_.store(State::AccountPost);
+        if (result_set_.load()) {
+            state_.store(State::AccountPost);
 
-        return;
-    }
+            return;
+        }
 
-    if (message_) {
-        refresh();
-    } else {
-        message_ = construct();
-    }
+        if (message_) {
+            refresh();
+        } else {
+            message_ = construct();
+        }
 
-    if (false == bool(message_)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct command")
-            .Flush();
-        ++error_count_;
+        if (false == bool(message_)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct command")
+                .Flush();
+            ++error_count_;
 
-        return;
+            return;
+        }
     }
 
     const auto& category = category_.at(type_.load());
 
     PREPARE_CONTEXT();
 
-    otx::context::Server::QueueResult result{};
-
-    if (Category::Transaction == category) {
-        result = context.Queue(
-            api_, message_, inbox_, outbox_, &numbers_, reason_, args_);
-    } else {
-        result = context.Queue(api_, message_, reason_, args_);
-    }
+    if (false == bool(reply_)) {
+        if (Category::Transaction == category) {
+            reply_ = context.Queue(
+                api_, message_, inbox_, outbox_, &numbers_, reason_, args_);
+        } else {
+            reply_ = context.Queue(api_, message_, reason_, args_);
+        }
 
-    if (false == bool(result)) {
-        LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+        if (false == bool(reply_)) {
+            LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
+            wait_for_context(context);
 
-        return;
+            return;
+        }
     }
 
-    while (check_future(*result)) {
-        if (shutdown().load()) { return; }
-    }
+    if (false == reply_ready(context)) { return; }
 
-    auto finished = result->get();
+    auto finished = take_reply();
     update_workflow(*message_, finished);
 
     switch (std::get<0>(finished)) {
@@ -1878,114 +1945,101 @@ void Operation::execute()
     }
 }
 
-auto Operation::get_account_data(
-    const Identifier& accountID,
-    std::shared_ptr<Ledger> inbox,
-    std::shared_ptr<Ledger> outbox,
-    otx::context::Server::DeliveryResult& lastResult) -> bool
+auto Operation::get_account_data(const Identifier& accountID) -> Progress
 {
-    auto message = construct_get_account_data(accountID);
-
-    if (false == bool(message)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct command")
-            .Flush();
+    auto& sync = sync_;
+    auto message = std::shared_ptr<Message>{};
 
-        return false;
-    }
+    if (false == bool(reply_)) {
+        sync.inbox_ = api_.Factory().Ledger(
+            nym_id_, accountID, server_id_, ledgerType::inbox);
+        sync.outbox_ = api_.Factory().Ledger(
+            nym_id_, accountID, server_id_, ledgerType::outbox);
 
-    PREPARE_CONTEXT();
+        OT_ASSERT(sync.inbox_);
+        OT_ASSERT(sync.outbox_);
+        OT_ASSERT(ledgerType::inbox == sync.inbox_->GetType());
+        OT_ASSERT(ledgerType::outbox == sync.outbox_->GetType());
 
-    auto result = context.Queue(api_, message, inbox, outbox, {}, reason_);
+        message = construct_get_account_data(accountID);
 
-    if (false == bool(result)) {
-        LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+        if (false == bool(message)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct command")
+                .Flush();
 
-        return false;
+            return Progress::Failure;
+        }
     }
 
-    while (check_future(*result)) {
-        if (shutdown().load()) { return false; }
-    }
+    PREPARE_CONTEXT();
 
-    lastResult = result->get();
+    if (false == bool(reply_)) {
+        reply_ = context.Queue(
+            api_, message, sync.inbox_, sync.outbox_, {}, reason_);
 
-    return otx::LastReplyStatus::MessageSuccess == std::get<0>(lastResult);
-}
+        if (false == bool(reply_)) {
+            LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
+            wait_for_context(context);
 
-auto Operation::get_receipts(
-    const Identifier& accountID,
-    std::shared_ptr<Ledger> inbox,
-    std::shared_ptr<Ledger> outbox) -> bool
-{
-    OT_ASSERT(inbox);
-    OT_ASSERT(outbox);
+            return Progress::Waiting;
+        }
+    }
 
-    bool output{true};
+    if (false == reply_ready(context)) { return Progress::Waiting; }
 
-    output &= get_receipts(accountID, BoxType::Inbox, *inbox);
-    output &= get_receipts(accountID, BoxType::Outbox, *outbox);
+    sync.last_ = take_reply();
+    const auto status = std::get<0>(sync.last_);
 
-    return output;
+    return (otx::LastReplyStatus::MessageSuccess == status)
+               ? Progress::Success
+               : Progress::Failure;
 }
 
-auto Operation::get_receipts(
-    const Identifier& accountID,
-    const BoxType type,
-    Ledger& box) -> bool
+auto Operation::get_receipts(const Identifier& accountID) -> Progress
 {
-    const auto count = box.GetTransactionMap().size();
-    std::size_t good{0};
+    auto& sync = sync_;
 
-    if (0 == count) {
-        LogDetail(OT_METHOD)(__FUNCTION__)(": Box is empty").Flush();
-    }
+    while (sync.receipt_ < sync.receipts_.size()) {
+        const auto [type, number] = sync.receipts_.at(sync.receipt_);
 
-    for (auto [number, pItem] : box.GetTransactionMap()) {
-        if (1 > number) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid transaction number ")(
-                number)
-                .Flush();
+        if (false == bool(sync.request_)) {
+            const auto exists = VerifyBoxReceiptExists(
+                api_,
+                api_.DataFolder(),
+                server_id_,
+                nym_id_,
+                accountID,
+                static_cast<std::int32_t>(type),
+                number);
 
-            continue;
-        }
+            if (exists) {
+                LogDetail(OT_METHOD)(__FUNCTION__)(": Receipt ")(number)(
+                    " already exists.")
+                    .Flush();
+                ++sync.receipt_;
 
-        if (false == bool(pItem)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Warning: Invalid item ")(
-                number)
-                .Flush();
+                continue;
+            }
         }
 
-        const auto exists = VerifyBoxReceiptExists(
-            api_,
-            api_.DataFolder(),
-            server_id_,
-            nym_id_,
-            accountID,
-            static_cast<std::int32_t>(type),
-            number);
+        const auto progress = download_box_receipt(accountID, type, number);
 
-        if (exists) {
-            LogDetail(OT_METHOD)(__FUNCTION__)(": Receipt ")(number)(
-                " already exists.")
-                .Flush();
-            ++good;
-
-            continue;
-        }
+        if (Progress::Waiting == progress) { return progress; }
 
-        if (download_box_receipt(accountID, type, number)) {
+        if (Progress::Success == progress) {
             LogDetail(OT_METHOD)(__FUNCTION__)(": Downloaded receipt ")(number)
                 .Flush();
-            ++good;
         } else {
             LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to download receipt ")(
                 number)
                 .Flush();
+            sync.receipts_failed_ = true;
         }
+
+        ++sync.receipt_;
     }
 
-    return count == good;
+    return sync.receipts_failed_ ? Progress::Failure : Progress::Success;
 }
 
 auto Operation::hasContext() const -> bool
@@ -2032,10 +2086,51 @@ auto Operation::IssueUnitDefinition(
     return IssueUnitDefinition(unitdefinition, args);
 }
 
-void Operation::join()
+void Operation::join() { Wait().get(); }
+
+auto Operation::launch(const Lock& decisionLock) const noexcept -> void
+{
+    using Pool = api::internal::ThreadPool;
+    const auto type = value(Pool::Work::OTXOperation);
+    auto work = Pool::MakeWork(api_.Network().ZeroMQ(), type);
+    work->AddFrame(reinterpret_cast<std::uintptr_t>(this));
+    ++jobs_;
+
+    if (false == Pool::Get(api_).Submit(type, std::move(work))) {
+        --jobs_;
+        LogVerbose(OT_METHOD)(__FUNCTION__)(
+            ": Thread pool unavailable, executing on a new thread")
+            .Flush();
+        StateMachine::launch(decisionLock);
+    }
+}
+
+void Operation::list_receipts(const BoxType type, const Ledger& box)
 {
-    while (State::Idle != state_.load()) {
-        Sleep(std::chrono::milliseconds(OPERATION_JOIN_MILLISECONDS));
+    auto& sync = sync_;
+    const auto& transactions = box.GetTransactionMap();
+
+    if (transactions.empty()) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Box is empty").Flush();
+    }
+
+    for (const auto& [number, pItem] : transactions) {
+        if (1 > number) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid transaction number ")(
+                number)
+                .Flush();
+            sync.receipts_failed_ = true;
+
+            continue;
+        }
+
+        if (false == bool(pItem)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Warning: Invalid item ")(
+                number)
+                .Flush();
+        }
+
+        sync.receipts_.emplace_back(type, number);
     }
 }
 
@@ -2044,7 +2139,6 @@ void Operation::nymbox_post()
     auto contextEditor = context();
     auto& context = contextEditor.get();
     context.SetPush(enable_otx_push_.load());
-    auto mismatch = !context.NymboxHashMatch();
     bool post{false};
 
     switch (category_.at(type_)) {
@@ -2057,31 +2151,42 @@ void Operation::nymbox_post()
         } break;
         case Category::Basic:
         default: {
-            state_.store(State::Idle);
         }
     }
 
-    if (post || mismatch) {
-        auto result = context.RefreshNymbox(api_, reason_);
+    if (false == bool(reply_)) {
+        auto mismatch = !context.NymboxHashMatch();
 
-        if (false == bool(result)) {
-            LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
+        if (false == (post || mismatch)) {
+            state_.store(State::Idle);
 
             return;
         }
 
-        while (check_future(*result)) {
-            if (shutdown().load()) { return; }
-        }
+        reply_ = context.RefreshNymbox(api_, reason_);
 
-        switch (std::get<0>(result->get())) {
-            case otx::LastReplyStatus::MessageSuccess: {
-                if (context.NymboxHashMatch()) { state_.store(State::Idle); }
-            } break;
-            default: {
+        if (false == bool(reply_)) {
+            LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
+
+            if (post) {
+                wait_for_context(context);
+            } else {
+                state_.store(State::Idle);
             }
+
+            return;
         }
     }
+
+    if (false == reply_ready(context)) { return; }
+
+    const auto status = std::get<0>(take_reply());
+
+    if (false == post) {
+        state_.store(State::Idle);
+    } else if (otx::LastReplyStatus::MessageSuccess == status) {
+        if (context.NymboxHashMatch()) { state_.store(State::Idle); }
+    }
 }
 
 void Operation::nymbox_pre()
@@ -2100,29 +2205,31 @@ void Operation::nymbox_pre()
             auto& context = contextEditor.get();
             context.SetPush(enable_otx_push_.load());
 
-            if (context.NymboxHashMatch()) {
-                if (needInbox) {
-                    state_.store(State::TransactionNumbers);
-                } else {
-                    state_.store(State::Execute);
-                }
+            if (false == bool(reply_)) {
+                if (context.NymboxHashMatch()) {
+                    if (needInbox) {
+                        state_.store(State::TransactionNumbers);
+                    } else {
+                        state_.store(State::Execute);
+                    }
 
-                return;
-            }
+                    return;
+                }
 
-            auto result = context.RefreshNymbox(api_, reason_);
+                reply_ = context.RefreshNymbox(api_, reason_);
 
-            if (false == bool(result)) {
-                LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
+                if (false == bool(reply_)) {
+                    LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy")
+                        .Flush();
+                    wait_for_context(context);
 
-                break;
+                    break;
+                }
             }
 
-            while (check_future(*result)) {
-                if (shutdown().load()) { return; }
-            }
+            if (false == reply_ready(context)) { return; }
 
-            switch (std::get<0>(result->get())) {
+            switch (std::get<0>(take_reply())) {
                 case otx::LastReplyStatus::MessageSuccess: {
                     if (needInbox) {
                         state_.store(State::TransactionNumbers);
@@ -2142,189 +2249,168 @@ void Operation::nymbox_pre()
     }
 }
 
-auto Operation::process_inbox(
-    const Identifier& accountID,
-    std::shared_ptr<Ledger> inbox,
-    std::shared_ptr<Ledger> outbox,
-    otx::context::Server::DeliveryResult& lastResult) -> bool
+auto Operation::process_inbox(const Identifier& accountID) -> Progress
 {
-    class Cleanup
-    {
-    public:
-        void SetSuccess() { recover_ = false; }
-
-        Cleanup(const TransactionNumber number, otx::context::Server& context)
-            : context_(context)
-            , number_(number)
-        {
-        }
-        Cleanup() = delete;
-        ~Cleanup()
-        {
-            if (recover_ && (0 != number_)) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": Recovering unused number ")(number_)(".")
-                    .Flush();
-                const bool recovered = context_.RecoverAvailableNumber(number_);
-
-                if (false == recovered) {
-                    LogOutput(OT_METHOD)(__FUNCTION__)("Failed.").Flush();
-                }
-            }
-        }
-
-    private:
-        otx::context::Server& context_;
-        const TransactionNumber number_{0};
-        bool recover_{true};
-    };
+    auto& sync = sync_;
+    const auto& inbox = sync.inbox_;
+    const auto& outbox = sync.outbox_;
 
     OT_ASSERT(inbox);
     OT_ASSERT(outbox);
     OT_ASSERT(ledgerType::inbox == inbox->GetType());
     OT_ASSERT(ledgerType::outbox == outbox->GetType());
 
-    const auto count =
-        (inbox->GetTransactionCount() > 0) ? inbox->GetTransactionCount() : 0;
+    if (false == bool(sync.request_)) {
+        const auto count = (inbox->GetTransactionCount() > 0)
+                               ? inbox->GetTransactionCount()
+                               : 0;
 
-    if (1 > count) {
-        LogDetail(OT_METHOD)(__FUNCTION__)(": No items to accept in account ")(
-            accountID)
-            .Flush();
+        if (1 > count) {
+            LogDetail(OT_METHOD)(__FUNCTION__)(
+                ": No items to accept in account ")(accountID)
+                .Flush();
 
-        return true;
-    } else {
-        LogDetail(OT_METHOD)(__FUNCTION__)(": ")(count)(
-            " items to accept in account ")(accountID)
-            .Flush();
-        redownload_accounts_.insert(accountID);
-    }
+            return Progress::Success;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(": ")(count)(
+                " items to accept in account ")(accountID)
+                .Flush();
+            redownload_accounts_.insert(accountID);
+        }
 
-    PREPARE_CONTEXT();
+        PREPARE_CONTEXT();
 
-    auto [response, recoverNumber] =
-        api_.OTAPI().CreateProcessInbox(accountID, context, *inbox);
+        auto [response, recoverNumber] =
+            api_.OTAPI().CreateProcessInbox(accountID, context, *inbox);
 
-    if (false == bool(response)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(
-            ": Error instantiating processInbox for account: ")(accountID)
-            .Flush();
+        if (false == bool(response)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Error instantiating processInbox for account: ")(accountID)
+                .Flush();
 
-        return false;
-    }
+            return Progress::Failure;
+        }
 
-    Cleanup cleanup(recoverNumber, context);
+        sync.recover_ = recoverNumber;
 
-    for (auto i = std::int32_t{0}; i < count; ++i) {
-        auto transaction = inbox->GetTransactionByIndex(i);
+        for (auto i = std::int32_t{0}; i < count; ++i) {
+            auto transaction = inbox->GetTransactionByIndex(i);
 
-        if (false == bool(transaction)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid transaction").Flush();
+            if (false == bool(transaction)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid transaction")
+                    .Flush();
+                recover_number(context);
 
-            return false;
-        }
+                return Progress::Failure;
+            }
 
-        const auto number = transaction->GetTransactionNum();
+            const auto number = transaction->GetTransactionNum();
 
-        if (transaction->IsAbbreviated()) {
-            inbox->LoadBoxReceipt(number);
-            transaction = inbox->GetTransaction(number);
+            if (transaction->IsAbbreviated()) {
+                inbox->LoadBoxReceipt(number);
+                transaction = inbox->GetTransaction(number);
 
-            if (false == bool(transaction)) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(": Unable to load item: ")(
-                    number)(".")
-                    .Flush();
+                if (false == bool(transaction)) {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Unable to load item: ")(number)(".")
+                        .Flush();
 
-                continue;
+                    continue;
+                }
             }
-        }
 
-        // TODO This should happen when the box receipt is downloaded
-        if (transactionType::chequeReceipt == transaction->GetType()) {
-            const auto workflowUpdated =
-                api_.Workflow().ClearCheque(context.Nym()->ID(), *transaction);
+            // TODO This should happen when the box receipt is downloaded
+            if (transactionType::chequeReceipt == transaction->GetType()) {
+                const auto workflowUpdated = api_.Workflow().ClearCheque(
+                    context.Nym()->ID(), *transaction);
 
-            if (workflowUpdated) {
-                LogVerbose(OT_METHOD)(__FUNCTION__)(": Updated workflow.")
-                    .Flush();
-            } else {
+                if (workflowUpdated) {
+                    LogVerbose(OT_METHOD)(__FUNCTION__)(": Updated workflow.")
+                        .Flush();
+                } else {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Failed to update workflow.")
+                        .Flush();
+                }
+            }
+
+            const bool accepted = api_.OTAPI().IncludeResponse(
+                accountID, true, context, *transaction, *response);
+
+            if (false == accepted) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": Failed to update workflow.")
+                    ": Failed to accept item: ")(number)
                     .Flush();
+                recover_number(context);
+
+                return Progress::Failure;
             }
         }
 
-        const bool accepted = api_.OTAPI().IncludeResponse(
-            accountID, true, context, *transaction, *response);
+        const bool finalized = api_.OTAPI().FinalizeProcessInbox(
+            accountID, context, *response, *inbox, *outbox, reason_);
 
-        if (false == accepted) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to accept item: ")(
-                number)
+        if (false == finalized) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Unable to finalize response.")
                 .Flush();
+            recover_number(context);
 
-            return false;
+            return Progress::Failure;
         }
-    }
 
-    const bool finalized = api_.OTAPI().FinalizeProcessInbox(
-        accountID, context, *response, *inbox, *outbox, reason_);
+        sync.request_ = construct_process_inbox(accountID, *response, context);
 
-    if (false == finalized) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Unable to finalize response.")
-            .Flush();
+        if (false == bool(sync.request_)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct command")
+                .Flush();
+            recover_number(context);
 
-        return false;
+            return Progress::Failure;
+        }
     }
 
-    auto message = construct_process_inbox(accountID, *response, context);
-
-    if (false == bool(message)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct command")
-            .Flush();
+    PREPARE_CONTEXT();
 
-        return false;
-    }
+    if (false == bool(reply_)) {
+        reply_ = context.Queue(api_, sync.request_, reason_, {});
 
-    auto result = context.Queue(api_, message, reason_, {});
+        if (false == bool(reply_)) {
+            LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
+            wait_for_context(context);
 
-    while (false == bool(result)) {
-        LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
-        result = context.Queue(api_, message, reason_, {});
+            return Progress::Waiting;
+        }
     }
 
-    while (check_future(*result)) {
-        if (shutdown().load()) { return false; }
-    }
+    if (false == reply_ready(context)) { return Progress::Waiting; }
 
-    lastResult = result->get();
-    const auto [status, reply] = lastResult;
+    sync.request_.reset();
+    sync.last_ = take_reply();
+    const auto& [status, reply] = sync.last_;
 
     if (otx::LastReplyStatus::MessageSuccess != status) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to deliver processInbox ")(
             value(status))
             .Flush();
+        recover_number(context);
 
-        return false;
+        return Progress::Failure;
     }
 
-    cleanup.SetSuccess();
+    sync.recover_ = 0;
 
     OT_ASSERT(reply);
 
     const auto success = evaluate_transaction_reply(accountID, *reply);
 
-    if (success) {
-        LogDetail(OT_METHOD)(__FUNCTION__)(": Success processing inbox ")(
-            accountID)
-            .Flush();
-    } else {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failure processing inbox ")(
-            accountID)
-            .Flush();
-    }
+    return success ? Progress::Success : Progress::Failure;
+}
 
-    return success;
+auto Operation::process_job() noexcept -> void
+{
+    run();
+    --jobs_;
 }
 
 auto Operation::PublishContract(const identifier::Nym& id) -> bool
@@ -2354,6 +2440,23 @@ auto Operation::PublishContract(const identifier::UnitDefinition& id) -> bool
     return start(lock, otx::OperationType::PublishUnit, {});
 }
 
+void Operation::recover_number(otx::context::Server& context)
+{
+    auto& number = sync_.recover_;
+
+    if (0 == number) { return; }
+
+    LogOutput(OT_METHOD)(__FUNCTION__)(": Recovering unused number ")(number)(
+        ".")
+        .Flush();
+
+    if (false == context.RecoverAvailableNumber(number)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed.").Flush();
+    }
+
+    number = 0;
+}
+
 void Operation::refresh()
 {
     OT_ASSERT(message_);
@@ -2370,6 +2473,19 @@ auto Operation::RequestAdmin(const String& password) -> bool
     return start(lock, otx::OperationType::RequestAdmin, {});
 }
 
+auto Operation::reply_ready(const otx::context::Server& context) -> bool
+{
+    OT_ASSERT(reply_);
+
+    const auto status = reply_->wait_for(std::chrono::seconds(0));
+
+    if (std::future_status::ready == status) { return true; }
+
+    wait_for_context(context);
+
+    return false;
+}
+
 void Operation::reset()
 {
     state_.store(State::NymboxPre);
@@ -2404,6 +2520,9 @@ void Operation::reset()
     peer_reply_ = api_.Factory().PeerReply();
     peer_request_ = api_.Factory().PeerRequest();
     set_id_ = {};
+    reply_.reset();
+    refresh_nymbox_ = false;
+    sync_ = AccountSync{};
 }
 
 #if OT_CASH
@@ -2701,6 +2820,16 @@ auto Operation::state_machine() -> bool
     return true;
 }
 
+auto Operation::take_reply() -> otx::context::Server::DeliveryResult
+{
+    OT_ASSERT(reply_);
+
+    auto output = reply_->get();
+    reply_.reset();
+
+    return output;
+}
+
 void Operation::transaction_numbers()
 {
     switch (category_.at(type_.load())) {
@@ -2722,48 +2851,44 @@ void Operation::transaction_numbers()
 
     PREPARE_CONTEXT();
 
-    const auto need = transaction_numbers_.at(type_.load());
-
-    if (context.AvailableNumbers() >= need) {
-        state_.store(State::AccountPre);
+    if (false == bool(reply_)) {
+        if (refresh_nymbox_) {
+            reply_ = context.RefreshNymbox(api_, reason_);
+        } else {
+            const auto need = transaction_numbers_.at(type_.load());
 
-        return;
-    }
+            if (context.AvailableNumbers() >= need) {
+                state_.store(State::AccountPre);
 
-    std::shared_ptr<Message> message{
-        api_.OTAPI().getTransactionNumbers(context)};
+                return;
+            }
 
-    if (false == bool(message)) { return; }
+            std::shared_ptr<Message> message{
+                api_.OTAPI().getTransactionNumbers(context)};
 
-    auto result = context.Queue(api_, message, reason_, {});
+            if (false == bool(message)) { return; }
 
-    if (false == bool(result)) {
-        LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
-        Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
+            reply_ = context.Queue(api_, message, reason_, {});
+        }
 
-        return;
-    }
+        if (false == bool(reply_)) {
+            LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
+            wait_for_context(context);
 
-    while (check_future(*result)) {
-        if (shutdown().load()) { return; }
+            return;
+        }
     }
 
-    if (otx::LastReplyStatus::MessageSuccess == std::get<0>(result->get())) {
-        auto nymbox = context.RefreshNymbox(api_, reason_);
+    if (false == reply_ready(context)) { return; }
 
-        while (false == bool(nymbox)) {
-            if (shutdown().load()) { return; }
-            LogTrace(OT_METHOD)(__FUNCTION__)(": Context is busy").Flush();
-            Sleep(std::chrono::milliseconds(OPERATION_POLL_MILLISECONDS));
-            nymbox = context.RefreshNymbox(api_, reason_);
-        }
-
-        while (check_future(*nymbox)) {
-            if (shutdown().load()) { return; }
-        }
+    const auto status = std::get<0>(take_reply());
 
-        [[maybe_unused]] auto done = nymbox->get();
+    if (refresh_nymbox_) {
+        refresh_nymbox_ = false;
         state_.store(State::NymboxPre);
+    } else if (otx::LastReplyStatus::MessageSuccess == status) {
+        // The new numbers are delivered through the nymbox
+        refresh_nymbox_ = true;
     }
 }
 
@@ -2864,11 +2989,28 @@ auto Operation::WithdrawCash(const Identifier& accountID, const Amount amount)
 }
 #endif
 
+auto Operation::wait_for_context(const otx::context::Server& context) const
+    -> void
+{
+    const auto& internal =
+        dynamic_cast<const otx::context::internal::Server&>(context);
+    suspend();
+    internal.Notify([waker = waker_] { waker->Fire(); });
+}
+
 Operation::~Operation()
 {
+    waker_->Stop();
     Stop().get();
 
-    if (hasContext()) { context().get().Join(); }
+    while (0 < jobs_.load()) { Sleep(std::chrono::microseconds(100)); }
+
+    if (hasContext()) {
+        auto contextEditor = context();
+        auto& context = contextEditor.get();
+        context.Join();
+        recover_number(context);
+    }
 
     const bool needPromise =
         (false == result_set_.load()) && (State::Idle != state_.load());
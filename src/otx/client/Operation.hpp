@@ -8,11 +8,15 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <future>
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include "Proto.hpp"
 #include "core/StateMachine.hpp"
@@ -165,6 +169,7 @@ public:
 private:
     using Promise = std::promise<Result>;
     friend opentxs::Factory;
+    friend otx::client::internal::Operation;
 
     enum class Category : int {
         Invalid = 0,
@@ -191,6 +196,63 @@ private:
         Outbox = 2,
     };
 
+    enum class AccountStep : int {
+        GetAccountData,
+        GetReceipts,
+        ProcessInbox,
+    };
+    enum class Progress : int {
+        Waiting,
+        Failure,
+        Success,
+    };
+
+    // Resumes the operation when the server context becomes idle. Context
+    // notifications may fire after the operation has been destroyed.
+    class Waker
+    {
+    public:
+        auto Fire() const noexcept -> void
+        {
+            Lock lock(lock_);
+
+            if (nullptr != parent_) { parent_->resume(); }
+        }
+
+        auto Stop() noexcept -> void
+        {
+            Lock lock(lock_);
+            parent_ = nullptr;
+        }
+
+        Waker(const Operation& parent) noexcept
+            : lock_()
+            , parent_(&parent)
+        {
+        }
+
+    private:
+        mutable std::mutex lock_;
+        const Operation* parent_;
+    };
+
+    // Position of download_accounts, which waits for several replies
+    struct AccountSync {
+        bool active_{false};
+        std::vector<OTIdentifier> accounts_{};
+        std::size_t next_{0};
+        std::size_t ready_{0};
+        AccountStep step_{AccountStep::GetAccountData};
+        std::shared_ptr<Ledger> inbox_{};
+        std::shared_ptr<Ledger> outbox_{};
+        std::vector<std::pair<BoxType, TransactionNumber>> receipts_{};
+        std::size_t receipt_{0};
+        bool receipts_failed_{false};
+        std::shared_ptr<Message> request_{};
+        TransactionNumber recover_{0};
+        otx::context::Server::DeliveryResult last_{};
+    };
+
     static const std::map<otx::OperationType, Category> category_;
     static const std::map<otx::OperationType, std::size_t> transaction_numbers_;
 
@@ -233,8 +295,12 @@ private:
     OTPeerReply peer_reply_;
     OTPeerRequest peer_request_;
     SetID set_id_;
+    otx::context::Server::QueueResult reply_;
+    bool refresh_nymbox_;
+    AccountSync sync_;
+    mutable std::atomic<std::size_t> jobs_;
+    const std::shared_ptr<Waker> waker_;
 
-    static auto check_future(otx::context::Server::SendFuture& future) -> bool;
     static void set_consensus_hash(
         OTTransaction& transaction,
         const otx::context::Base& context,
@@ -246,6 +312,7 @@ private:
         const Identifier& accountID,
         const Message& reply) const -> bool;
     auto hasContext() const -> bool;
+    auto launch(const Lock& decisionLock) const noexcept -> void final;
     void update_workflow(
         const Message& request,
         const otx::context::Server::DeliveryResult& result) const;
@@ -255,6 +322,8 @@ private:
     void update_workflow_send_cash(
         const Message& request,
         const otx::context::Server::DeliveryResult& result) const;
+    /// Suspends the state machine until the server context is idle
+    auto wait_for_context(const otx::context::Server& context) const -> void;
 
     void account_pre();
     void account_post();
@@ -305,41 +374,27 @@ private:
 #if OT_CASH
     auto construct_withdraw_cash() -> std::shared_ptr<Message>;
 #endif
-    auto download_account(
-        const Identifier& accountID,
-        otx::context::Server::DeliveryResult& lastResult) -> std::size_t;
-    auto download_accounts(
-        const State successState,
-        const State failState,
-        otx::context::Server::DeliveryResult& lastResult) -> bool;
+    auto download_account(const Identifier& accountID) -> Progress;
+    auto download_accounts(const State successState, const State failState)
+        -> bool;
     auto download_box_receipt(
         const Identifier& accountID,
         const BoxType box,
-        const TransactionNumber number) -> bool;
+        const TransactionNumber number) -> Progress;
     void evaluate_transaction_reply(
         otx::context::Server::DeliveryResult&& result);
     void execute();
-    auto get_account_data(
-        const Identifier& accountID,
-        std::shared_ptr<Ledger> inbox,
-        std::shared_ptr<Ledger> outbox,
-        otx::context::Server::DeliveryResult& lastResult) -> bool;
-    auto get_receipts(
-        const Identifier& accountID,
-        std::shared_ptr<Ledger> inbox,
-        std::shared_ptr<Ledger> outbox) -> bool;
-    auto get_receipts(
-        const Identifier& accountID,
-        const BoxType type,
-        Ledger& box) -> bool;
+    auto get_account_data(const Identifier& accountID) -> Progress;
+    auto get_receipts(const Identifier& accountID) -> Progress;
+    void list_receipts(const BoxType type, const Ledger& box);
     void nymbox_post();
     void nymbox_pre();
-    auto process_inbox(
-        const Identifier& accountID,
-        std::shared_ptr<Ledger> inbox,
-        std::shared_ptr<Ledger> outbox,
-        otx::context::Server::DeliveryResult& lastResult) -> bool;
+    auto process_inbox(const Identifier& accountID) -> Progress;
+    auto process_job() noexcept -> void;
+    void recover_number(otx::context::Server& context);
     void refresh();
+    /// Returns false and suspends if the pending reply has not arrived
+    auto reply_ready(const otx::context::Server& context) -> bool;
     void reset();
     void set_result(otx::context::Server::DeliveryResult&& result);
     auto start(
@@ -347,6 +402,7 @@ private:
         const otx::OperationType type,
         const otx::context::Server::ExtraArgs& args) -> bool;
     auto state_machine() -> bool;
+    auto take_reply() -> otx::context::Server::DeliveryResult;
     void transaction_numbers();
 
     Operation(
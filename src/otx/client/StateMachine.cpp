@@ -68,6 +68,7 @@
         return false;                                                          \
     }                                                                          \
                                                                                \
+    op_.join();                                                                \
     auto started = op_.a(__VA_ARGS__);                                         \
                                                                                \
     while (false == started) {                                                 \
@@ -102,6 +103,7 @@
         otx::LastReplyStatus::MessageSuccess == std::get<0>(result);
 
 #define DO_OPERATION_TASK_DONE(a, ...)                                         \
+    op_.join();                                                                \
     auto started = op_.a(__VA_ARGS__);                                         \
                                                                                \
     while (false == started) {                                                 \
@@ -199,6 +199,8 @@ Server::Server(
     , inbox_()
     , outbox_()
     , numbers_(nullptr)
+    , notification_lock_()
+    , notifications_()
     , find_nym_(api.Network().ZeroMQ().PushSocket(
           zmq::socket::Socket::Direction::Connect))
     , find_server_(api.Network().ZeroMQ().PushSocket(
@@ -260,6 +262,8 @@ Server::Server(
     , inbox_()
     , outbox_()
     , numbers_(nullptr)
+    , notification_lock_()
+    , notifications_()
     , find_nym_(api.Network().ZeroMQ().PushSocket(
           zmq::socket::Socket::Direction::Connect))
     , find_server_(api.Network().ZeroMQ().PushSocket(
@@ -1870,6 +1874,8 @@ auto Server::Highest() const -> TransactionNumber
     return highest_transaction_number_.load();
 }
 
+auto Server::idle(const Lock&) const noexcept -> void { notify(); }
+
 auto Server::init_new_account(
     const Identifier& accountID,
     const PasswordPrompt& reason) -> bool
@@ -6529,6 +6535,34 @@ auto Server::Purse(const identifier::UnitDefinition& id) const
 }
 #endif
 
+auto Server::Notify(Notification&& callback) const noexcept -> void
+{
+    Lock lock(notification_lock_);
+
+    // A context which is shutting down will not become idle again but may
+    // still resolve its pending message from the destructor
+    if (running().load() || shutdown().load()) {
+        notifications_.emplace_back(std::move(callback));
+
+        return;
+    }
+
+    lock.unlock();
+    callback();
+}
+
+auto Server::notify() const noexcept -> void
+{
+    auto notifications = std::vector<Notification>{};
+
+    {
+        Lock lock(notification_lock_);
+        notifications.swap(notifications_);
+    }
+
+    for (const auto& callback : notifications) { callback(); }
+}
+
 auto Server::Queue(
     const api::client::internal::Manager& client,
     std::shared_ptr<Message> message,
@@ -7189,6 +7223,7 @@ void Server::resolve_queue(
     outbox_.reset();
     pending_result_.set_value(std::move(result));
     pending_result_set_.store(true);
+    notify();
     pending_message_.reset();
     pending_args_ = {"", false};
     process_nymbox_.store(false);
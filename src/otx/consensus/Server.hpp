@@ -186,6 +186,7 @@ public:
         const bool withNymboxHash = false)
         -> std::pair<RequestNumber, std::unique_ptr<Message>> final;
     void Join() const final;
+    auto Notify(Notification&& callback) const noexcept -> void final;
 #if OT_CASH
     auto mutable_Purse(
         const identifier::UnitDefinition& id,
@@ -310,6 +311,8 @@ private:
     std::shared_ptr<Ledger> inbox_;
     std::shared_ptr<Ledger> outbox_;
     std::set<OTManagedNumber>* numbers_;
+    mutable std::mutex notification_lock_;
+    mutable std::vector<Notification> notifications_;
     OTZMQPushSocket find_nym_;
     OTZMQPushSocket find_server_;
     OTZMQPushSocket find_unit_definition_;
@@ -401,6 +404,7 @@ private:
         const TransactionNumber lReceiptId,
         Ledger& ledger,
         const PasswordPrompt& reason) -> std::shared_ptr<OTPayment>;
+    auto idle(const Lock& decisionLock) const noexcept -> void final;
     auto init_new_account(
         const Identifier& accountID,
         const PasswordPrompt& reason) -> bool;
@@ -409,6 +413,7 @@ private:
     void initialize_server_command(const MessageType type, Message& output)
         const;
     auto is_internal_transfer(const Item& item) const -> bool;
+    auto notify() const noexcept -> void;
     auto load_account_inbox(const Identifier& accountID) const
         -> std::unique_ptr<Ledger>;
     auto load_or_create_account_recordbox(
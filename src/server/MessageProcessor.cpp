@@ -54,6 +54,7 @@
 #include "opentxs/protobuf/verify/ServerRequest.hpp"
 #include "server/Server.hpp"
 #include "server/UserCommandProcessor.hpp"
+#include "util/Trace.hpp"
 
 #define OTX_ZAP_DOMAIN "opentxs-otx"
 
@@ -106,6 +107,8 @@ MessageProcessor::MessageProcessor(
     , drop_outgoing_(0)
     , active_connections_()
     , connection_map_lock_()
+    , requests_(metrics::Registry::Get().GetCounter("server.requests"))
+    , request_time_(metrics::Registry::Get().GetHistogram("server.request"))
 {
     auto bound = backend_socket_->Start(internal_endpoint_);
     bound &= internal_socket_->Start(internal_endpoint_);
@@ -230,6 +233,8 @@ auto MessageProcessor::process_backend(const zmq::Message& incoming)
 {
     // ProcessCron and process_backend must not run simultaneously
     Lock lock(lock_);
+    const auto timer = metrics::Timer{request_time_};
+    OT_TRACE_SPAN(span, "process_backend", "notary");
     std::string reply{};
 
     std::string messageString{};
@@ -287,6 +292,8 @@ void MessageProcessor::process_frontend(const zmq::Message& incoming)
         --drop_incoming_;
     } else {
         lock.unlock();
+        requests_.Add();
+        OT_TRACE_SPAN(span, "process_frontend", "notary");
         const auto id = get_connection(incoming);
         const bool isProto{1 < incoming.Body().size()};
 
@@ -29,6 +29,7 @@
 #include "opentxs/network/zeromq/socket/Sender.tpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "opentxs/protobuf/ServerRequest.pb.h"
+#include "util/Metrics.hpp"
 
 namespace opentxs
 {
@@ -95,6 +96,8 @@ private:
     // nym id, connection identifier
     std::map<OTIdentifier, OTData> active_connections_;
     mutable std::shared_mutex connection_map_lock_;
+    metrics::Counter& requests_;
+    metrics::Histogram& request_time_;
 
     static auto get_connection(const network::zeromq::Message& incoming)
         -> OTData;
@@ -0,0 +1,69 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"             // IWYU pragma: associated
+#include "1_Internal.hpp"           // IWYU pragma: associated
+#include "storage/ObjectCache.hpp"  // IWYU pragma: associated
+
+#include <utility>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::storage
+{
+ObjectCache::ObjectCache(const std::size_t limit) noexcept
+    : limit_(limit)
+    , lock_()
+    , size_(0)
+    , lru_()
+    , map_()
+{
+}
+
+auto ObjectCache::add(
+    const std::string& hash,
+    const std::type_index type,
+    Object object,
+    const std::size_t size) const noexcept -> void
+{
+    Lock lock(lock_);
+
+    if (0 < map_.count(hash)) { return; }
+
+    while ((false == lru_.empty()) && ((size_ + size) > limit_)) {
+        const auto it = map_.find(lru_.back());
+
+        if (map_.end() != it) {
+            size_ -= it->second.size_;
+            map_.erase(it);
+        }
+
+        lru_.pop_back();
+    }
+
+    lru_.emplace_front(hash);
+    map_.emplace(hash, Entry{type, std::move(object), size, lru_.begin()});
+    size_ += size;
+}
+
+auto ObjectCache::get(const std::string& hash, const std::type_index type)
+    const noexcept -> Object
+{
+    Lock lock(lock_);
+    const auto it = map_.find(hash);
+
+    if (map_.end() == it) { return {}; }
+
+    auto& entry = it->second;
+
+    if (entry.type_ != type) { return {}; }
+
+    lru_.splice(lru_.begin(), lru_, entry.position_);
+
+    return entry.object_;
+}
+
+ObjectCache::~ObjectCache() = default;
+}  // namespace opentxs::storage
@@ -0,0 +1,84 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+#include "Proto.hpp"
+#include "opentxs/Version.hpp"
+
+namespace opentxs::storage
+{
+/** Size-limited LRU cache of validated protobuf objects
+ *
+ *  Objects are keyed by the content hash under which they are stored, so a
+ *  cached entry can never become stale. Every caller shares the cached
+ *  instance, which is immutable.
+ */
+class OPENTXS_EXPORT ObjectCache
+{
+public:
+    template <typename T>
+    auto Load(const std::string& hash) const noexcept
+        -> std::shared_ptr<const T>
+    {
+        return std::static_pointer_cast<const T>(get(hash, typeid(T)));
+    }
+    template <typename T>
+    auto Store(
+        const std::string& hash,
+        std::shared_ptr<const T> object,
+        const std::size_t size) const noexcept -> void
+    {
+        if ((false == bool(object)) || (size > limit_)) { return; }
+
+        add(hash, typeid(T), std::move(object), size);
+    }
+
+    ObjectCache(const std::size_t limit) noexcept;
+
+    ~ObjectCache();
+
+private:
+    using Object = std::shared_ptr<const ProtobufType>;
+    using LRU = std::list<std::string>;
+
+    struct Entry {
+        std::type_index type_;
+        Object object_;
+        std::size_t size_;
+        LRU::iterator position_;
+    };
+
+    const std::size_t limit_;
+    mutable std::mutex lock_;
+    mutable std::size_t size_;
+    mutable LRU lru_;
+    mutable std::unordered_map<std::string, Entry> map_;
+
+    auto add(
+        const std::string& hash,
+        const std::type_index type,
+        Object object,
+        const std::size_t size) const noexcept -> void;
+    auto get(const std::string& hash, const std::type_index type)
+        const noexcept -> Object;
+
+    ObjectCache() = delete;
+    ObjectCache(const ObjectCache&) = delete;
+    ObjectCache(ObjectCache&&) = delete;
+    auto operator=(const ObjectCache&) -> ObjectCache& = delete;
+    auto operator=(ObjectCache&&) -> ObjectCache& = delete;
+};
+}  // namespace opentxs::storage
@@ -29,9 +29,27 @@ Plugin::Plugin(
     , storage_(storage)
     , digest_(hash)
     , current_bucket_(bucket)
+    , written_lock_()
+    , track_writes_(false)
+    , written_()
 {
 }
 
+auto Plugin::DeleteFromBucket(const std::string& key, const bool bucket) const
+    -> bool
+{
+    if (key.empty()) { return false; }
+
+    // Holding the lock for the duration of the delete ensures a concurrent
+    // store of the same key either lands in written_ first or happens after
+    // the object has been removed
+    Lock lock(written_lock_);
+
+    if (0 < written_.count(key)) { return false; }
+
+    return delete_from_bucket(key, bucket);
+}
+
 auto Plugin::Load(
     const std::string& key,
     const bool checking,
@@ -111,12 +129,20 @@ auto Plugin::Migrate(
     return true;
 }
 
+void Plugin::record_write(const std::string& key) const
+{
+    Lock lock(written_lock_);
+
+    if (track_writes_) { written_.emplace(key); }
+}
+
 auto Plugin::Store(
     const bool isTransaction,
     const std::string& key,
     const std::string& value,
     const bool bucket) const -> bool
 {
+    record_write(key);
     std::promise<bool> promise;
     auto future = promise.get_future();
     store(isTransaction, key, value, bucket, &promise);
@@ -131,6 +157,7 @@ void Plugin::Store(
     const bool bucket,
     std::promise<bool>& promise) const
 {
+    record_write(key);
     std::thread thread(
         &Plugin::store, this, isTransaction, key, value, bucket, &promise);
     thread.detach();
@@ -151,4 +178,38 @@ auto Plugin::Store(
 
     return false;
 }
+
+auto Plugin::store_batch(
+    const bool isTransaction,
+    const Batch& items,
+    const bool bucket) const -> bool
+{
+    auto output{true};
+
+    for (const auto& [key, value] : items) {
+        std::promise<bool> promise;
+        auto future = promise.get_future();
+        store(isTransaction, key, value, bucket, &promise);
+        output &= future.get();
+    }
+
+    return output;
+}
+
+auto Plugin::StoreBatch(
+    const bool isTransaction,
+    const Batch& items,
+    const bool bucket) const -> bool
+{
+    for (const auto& item : items) { record_write(item.first); }
+
+    return store_batch(isTransaction, items, bucket);
+}
+
+void Plugin::TrackWrites(const bool enabled) const
+{
+    Lock lock(written_lock_);
+    track_writes_ = enabled;
+    written_.clear();
+}
 }  // namespace opentxs
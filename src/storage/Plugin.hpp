@@ -8,7 +8,9 @@
 #include <atomic>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 
 #include "Proto.hpp"
 #include "Proto.tpp"
@@ -20,6 +22,7 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/protobuf/Check.hpp"
+#include "storage/ObjectCache.hpp"
 
 namespace opentxs
 {
@@ -37,7 +40,15 @@ class StorageConfig;
 class Plugin : virtual public opentxs::api::storage::Plugin
 {
 public:
+    auto Cache() const -> const opentxs::storage::ObjectCache* final
+    {
+        return nullptr;
+    }
+    auto DeleteFromBucket(const std::string& key, const bool bucket) const
+        -> bool final;
     auto EmptyBucket(const bool bucket) const -> bool override = 0;
+    auto ListBucket(const bool bucket, const KeyCallback cb) const
+        -> bool override = 0;
 
     auto Load(const std::string& key, const bool checking, std::string& value)
         const -> bool override;
@@ -60,6 +71,10 @@ public:
         const bool isTransaction,
         const std::string& value,
         std::string& key) const -> bool override;
+    auto StoreBatch(
+        const bool isTransaction,
+        const Batch& items,
+        const bool bucket) const -> bool final;
 
     auto Migrate(
         const std::string& key,
@@ -68,6 +83,7 @@ public:
     auto LoadRoot() const -> std::string override = 0;
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool override = 0;
+    void TrackWrites(const bool enabled) const final;
 
     virtual void Cleanup() = 0;
 
@@ -85,17 +101,28 @@ protected:
         const Flag& bucket);
     Plugin() = delete;
 
+    virtual auto delete_from_bucket(const std::string& key, const bool bucket)
+        const -> bool = 0;
     virtual void store(
         const bool isTransaction,
         const std::string& key,
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const = 0;
+    virtual auto store_batch(
+        const bool isTransaction,
+        const Batch& items,
+        const bool bucket) const -> bool;
 
 private:
     const api::storage::Storage& storage_;
     const Digest& digest_;
     const Flag& current_bucket_;
+    mutable std::mutex written_lock_;
+    mutable bool track_writes_;
+    mutable std::unordered_set<std::string> written_;
+
+    void record_write(const std::string& key) const;
 
     Plugin(const Plugin&) = delete;
     Plugin(Plugin&&) = delete;
@@ -109,6 +136,29 @@ auto opentxs::api::storage::Driver::LoadProto(
     std::shared_ptr<T>& serialized,
     const bool checking) const -> bool
 {
+    auto shared = std::shared_ptr<const T>{};
+
+    if (false == LoadProto(hash, shared, checking)) { return false; }
+
+    serialized = std::make_shared<T>(*shared);
+
+    return true;
+}
+
+template <class T>
+auto opentxs::api::storage::Driver::LoadProto(
+    const std::string& hash,
+    std::shared_ptr<const T>& serialized,
+    const bool checking) const -> bool
+{
+    const auto* cache = Cache();
+
+    if (nullptr != cache) {
+        serialized = cache->Load<T>(hash);
+
+        if (serialized) { return true; }
+    }
+
     auto raw = std::string{};
     const auto loaded = Load(hash, checking, raw);
     auto valid{false};
@@ -141,6 +191,8 @@ auto opentxs::api::storage::Driver::LoadProto(
 
     OT_ASSERT(valid);
 
+    if (nullptr != cache) { cache->Store<T>(hash, serialized, raw.size()); }
+
     return valid;
 }
 
@@ -19,6 +19,7 @@ StorageConfig::StorageConfig() noexcept
     , auto_publish_servers_(true)
     , auto_publish_units_(true)
     , gc_interval_(C::duration_cast<C::seconds>(C::hours(1)).count())
+    , cache_limit_(64 * 1024 * 1024)
     , path_()
     , dht_callback_()
     , primary_plugin_(default_plugin_)
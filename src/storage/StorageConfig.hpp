@@ -6,6 +6,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -31,6 +32,7 @@ public:
     bool auto_publish_servers_;
     bool auto_publish_units_;
     std::int64_t gc_interval_;
+    std::size_t cache_limit_;
     std::string path_;
     InsertCB dht_callback_;
 
@@ -20,6 +20,7 @@ extern "C" {
 #include <fstream>
 #include <ios>
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "opentxs/core/Log.hpp"
@@ -31,6 +32,37 @@ extern "C" {
 
 namespace opentxs
 {
+namespace
+{
+class FileDescriptor
+{
+public:
+    FileDescriptor(const std::string& path, const int flags)
+        : fd_(::open(path.c_str(), flags))
+    {
+    }
+
+    operator bool() const { return good(); }
+    operator int() const { return fd_; }
+
+    ~FileDescriptor()
+    {
+        if (good()) { ::close(fd_); }
+    }
+
+private:
+    int fd_{-1};
+
+    auto good() const -> bool { return (-1 != fd_); }
+
+    FileDescriptor() = delete;
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor(FileDescriptor&&) = delete;
+    auto operator=(const FileDescriptor&) -> FileDescriptor& = delete;
+    auto operator=(FileDescriptor&&) -> FileDescriptor& = delete;
+};
+}  // namespace
+
 StorageFS::StorageFS(
     const api::storage::Storage& storage,
     const StorageConfig& config,
@@ -140,6 +172,52 @@ void StorageFS::store(
     }
 }
 
+auto StorageFS::store_batch(
+    const bool,
+    const Batch& items,
+    const bool bucket) const -> bool
+{
+    if ((false == ready_.get()) || folder_.empty()) { return false; }
+
+    auto output{true};
+    auto files = std::vector<std::string>{};
+    auto directories = std::set<std::string>{};
+    files.reserve(items.size());
+
+    for (const auto& [key, value] : items) {
+        std::string directory{};
+        const auto filename = calculate_path(key, bucket, directory);
+
+        if (write_file(filename, value, false)) {
+            files.emplace_back(filename);
+            directories.emplace(directory);
+        } else {
+            output = false;
+        }
+    }
+
+    // Every file is written before any of them is synced, so the kernel
+    // flushes the batch together instead of one file at a time
+    for (const auto& file : files) {
+        if (false == sync_file(file)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to sync file ")(
+                file)(".")
+                .Flush();
+        }
+    }
+
+    // Directory entries only need to be made durable once per batch
+    for (const auto& directory : directories) {
+        if (false == sync(directory)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to sync directory ")(
+                directory)(".")
+                .Flush();
+        }
+    }
+
+    return output;
+}
+
 auto StorageFS::StoreRoot(const bool, const std::string& hash) const -> bool
 {
     if (ready_.get() && false == folder_.empty()) {
@@ -152,35 +230,23 @@ auto StorageFS::StoreRoot(const bool, const std::string& hash) const -> bool
 
 auto StorageFS::sync(const std::string& path) const -> bool
 {
-    class FileDescriptor
-    {
-    public:
-        FileDescriptor(const std::string& path)
-            : fd_(::open(path.c_str(), O_DIRECTORY | O_RDONLY))
-        {
-        }
-
-        operator bool() const { return good(); }
-        operator int() const { return fd_; }
+    FileDescriptor fd(path, O_DIRECTORY | O_RDONLY);
 
-        ~FileDescriptor()
-        {
-            if (good()) { ::close(fd_); }
-        }
+    if (!fd) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to open ")(path)(".")
+            .Flush();
 
-    private:
-        int fd_{-1};
+        return false;
+    }
 
-        auto good() const -> bool { return (-1 != fd_); }
+    return sync(fd);
+}
 
-        FileDescriptor() = delete;
-        FileDescriptor(const FileDescriptor&) = delete;
-        FileDescriptor(FileDescriptor&&) = delete;
-        auto operator=(const FileDescriptor&) -> FileDescriptor& = delete;
-        auto operator=(FileDescriptor&&) -> FileDescriptor& = delete;
-    };
+auto StorageFS::sync(File& file) const -> bool { return sync(file->handle()); }
 
-    FileDescriptor fd(path);
+auto StorageFS::sync_file(const std::string& path) const -> bool
+{
+    FileDescriptor fd(path, O_RDONLY);
 
     if (!fd) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to open ")(path)(".")
@@ -192,8 +258,6 @@ auto StorageFS::sync(const std::string& path) const -> bool
     return sync(fd);
 }
 
-auto StorageFS::sync(File& file) const -> bool { return sync(file->handle()); }
-
 auto StorageFS::sync(int fd) const -> bool
 {
 #if defined(__APPLE__)
@@ -209,6 +273,22 @@ auto StorageFS::write_file(
     const std::string& directory,
     const std::string& filename,
     const std::string& contents) const -> bool
+{
+    if (false == write_file(filename, contents)) { return false; }
+
+    if (false == sync(directory)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to sync directory ")(
+            directory)(".")
+            .Flush();
+    }
+
+    return true;
+}
+
+auto StorageFS::write_file(
+    const std::string& filename,
+    const std::string& contents,
+    const bool durable) const -> bool
 {
     if (false == filename.empty()) {
         boost::filesystem::path filePath(filename);
@@ -218,18 +298,12 @@ auto StorageFS::write_file(
         if (file.good()) {
             file.write(data.c_str(), data.size());
 
-            if (false == sync(file)) {
+            if (durable && (false == sync(file))) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to sync file ")(
                     filename)(".")
                     .Flush();
             }
 
-            if (false == sync(directory)) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": Failed to sync directory ")(directory)(".")
-                    .Flush();
-            }
-
             file.close();
 
             return true;
@@ -93,12 +93,21 @@ private:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const override;
+    auto store_batch(
+        const bool isTransaction,
+        const Batch& items,
+        const bool bucket) const -> bool override;
     auto sync(File& file) const -> bool;
     auto sync(int fd) const -> bool;
+    auto sync_file(const std::string& path) const -> bool;
     auto write_file(
         const std::string& directory,
         const std::string& filename,
         const std::string& contents) const -> bool;
+    auto write_file(
+        const std::string& filename,
+        const std::string& contents,
+        const bool durable = true) const -> bool;
 
     void Cleanup_StorageFS();
     void Init_StorageFS();
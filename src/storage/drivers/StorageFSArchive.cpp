@@ -111,6 +111,13 @@ void StorageFSArchive::Cleanup_StorageFSArchive()
     // future cleanup actions go here
 }
 
+// NOTE: archives are append-only so there is never any garbage to report
+auto StorageFSArchive::delete_from_bucket(const std::string&, const bool) const
+    -> bool
+{
+    return true;
+}
+
 auto StorageFSArchive::EmptyBucket(const bool) const -> bool { return true; }
 
 void StorageFSArchive::Init_StorageFSArchive()
@@ -122,6 +129,11 @@ void StorageFSArchive::Init_StorageFSArchive()
     if (boost::filesystem::create_directory(folder_, ec)) { ready_->On(); }
 }
 
+auto StorageFSArchive::ListBucket(const bool, const KeyCallback) const -> bool
+{
+    return true;
+}
+
 auto StorageFSArchive::prepare_read(const std::string& input) const
     -> std::string
 {
@@ -47,6 +47,8 @@ private:
 
 public:
     auto EmptyBucket(const bool bucket) const -> bool final;
+    auto ListBucket(const bool bucket, const KeyCallback cb) const
+        -> bool final;
 
     void Cleanup() final;
 
@@ -62,6 +64,8 @@ private:
         const std::string& key,
         const bool bucket,
         std::string& directory) const -> std::string final;
+    auto delete_from_bucket(const std::string& key, const bool bucket) const
+        -> bool final;
     auto prepare_read(const std::string& ciphertext) const -> std::string final;
     auto prepare_write(const std::string& plaintext) const -> std::string final;
     auto root_filename() const -> std::string final;
@@ -8,6 +8,7 @@
 #include "storage/drivers/StorageFSGC.hpp"  // IWYU pragma: associated
 
 #include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
 #include <cassert>
 #include <cstdio>
 #include <memory>
@@ -73,6 +74,18 @@ void StorageFSGC::Cleanup_StorageFSGC()
     // future cleanup actions go here
 }
 
+auto StorageFSGC::delete_from_bucket(
+    const std::string& key,
+    const bool bucket) const -> bool
+{
+    std::string directory{};
+    const auto filename = calculate_path(key, bucket, directory);
+    boost::system::error_code ec{};
+    boost::filesystem::remove(filename, ec);
+
+    return !ec;
+}
+
 auto StorageFSGC::EmptyBucket(const bool bucket) const -> bool
 {
     assert(random_);
@@ -101,6 +114,30 @@ void StorageFSGC::Init_StorageFSGC()
     ready_->On();
 }
 
+auto StorageFSGC::ListBucket(const bool bucket, const KeyCallback cb) const
+    -> bool
+{
+    std::string directory{};
+    calculate_path("", bucket, directory);
+    boost::system::error_code ec{};
+    auto it = boost::filesystem::directory_iterator{directory, ec};
+
+    if (ec) { return false; }
+
+    for (const auto end = boost::filesystem::directory_iterator{}; it != end;
+         it.increment(ec)) {
+        if (ec) { return false; }
+
+        if (false == boost::filesystem::is_regular_file(it->status())) {
+            continue;
+        }
+
+        if (false == cb(it->path().filename().string())) { break; }
+    }
+
+    return true;
+}
+
 void StorageFSGC::purge(const std::string& path) const
 {
     if (path.empty()) { return; }
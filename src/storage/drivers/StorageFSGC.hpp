@@ -40,6 +40,8 @@ private:
 
 public:
     auto EmptyBucket(const bool bucket) const -> bool final;
+    auto ListBucket(const bool bucket, const KeyCallback cb) const
+        -> bool final;
 
     void Cleanup() final;
 
@@ -53,6 +55,8 @@ private:
         const std::string& key,
         const bool bucket,
         std::string& directory) const -> std::string final;
+    auto delete_from_bucket(const std::string& key, const bool bucket) const
+        -> bool final;
     void purge(const std::string& path) const;
     auto root_filename() const -> std::string final;
 
@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"                   // IWYU pragma: associated
 #include "storage/drivers/StorageLMDB.hpp"  // IWYU pragma: associated
 
+#include <exception>
 #include <string>
 #include <utility>
 
@@ -63,6 +64,13 @@ void StorageLMDB::Cleanup() { Cleanup_StorageLMDB(); }
 
 void StorageLMDB::Cleanup_StorageLMDB() {}
 
+auto StorageLMDB::delete_from_bucket(
+    const std::string& key,
+    const bool bucket) const -> bool
+{
+    return lmdb_.Delete(get_table(bucket), key);
+}
+
 auto StorageLMDB::EmptyBucket(const bool bucket) const -> bool
 {
     return lmdb_.Delete(get_table(bucket));
@@ -78,6 +86,17 @@ void StorageLMDB::Init_StorageLMDB()
     LogVerbose(OT_METHOD)(__FUNCTION__)(": Database initialized.").Flush();
 }
 
+auto StorageLMDB::ListBucket(const bool bucket, const KeyCallback cb) const
+    -> bool
+{
+    return lmdb_.Read(
+        get_table(bucket),
+        [&](const auto key, const auto) -> bool {
+            return cb(std::string{key});
+        },
+        lmdb::LMDB::Dir::Forward);
+}
+
 auto StorageLMDB::LoadFromBucket(
     const std::string& key,
     std::string& value,
@@ -117,6 +136,44 @@ void StorageLMDB::store(
     }
 }
 
+auto StorageLMDB::store_batch(
+    const bool isTransaction,
+    const Batch& items,
+    const bool bucket) const -> bool
+{
+    const auto table = get_table(bucket);
+
+    if (isTransaction) {
+        auto output{true};
+
+        for (const auto& [key, value] : items) {
+            output &= lmdb_.Queue(table, key, value);
+        }
+
+        return output;
+    }
+
+    try {
+        auto tx = lmdb_.TransactionRW();
+
+        for (const auto& [key, value] : items) {
+            if (false == lmdb_.Store(table, key, value, tx).first) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to store object")
+                    .Flush();
+                tx.Finalize(false);
+
+                return false;
+            }
+        }
+
+        return tx.Finalize(true);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return false;
+    }
+}
+
 auto StorageLMDB::StoreRoot(const bool commit, const std::string& hash) const
     -> bool
 {
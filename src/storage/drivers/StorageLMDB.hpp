@@ -43,6 +43,8 @@ public:
         const std::string& key,
         std::string& value,
         const bool bucket) const -> bool final;
+    auto ListBucket(const bool bucket, const KeyCallback cb) const
+        -> bool final;
     auto LoadRoot() const -> std::string final;
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool final;
@@ -66,6 +68,8 @@ private:
     const lmdb::TableNames table_names_;
     lmdb::LMDB lmdb_;
 
+    auto delete_from_bucket(const std::string& key, const bool bucket) const
+        -> bool final;
     auto get_table(const bool bucket) const -> Table;
     void store(
         const bool isTransaction,
@@ -73,6 +77,10 @@ private:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const final;
+    auto store_batch(
+        const bool isTransaction,
+        const Batch& items,
+        const bool bucket) const -> bool final;
 
     void Init_StorageLMDB();
 
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "2_Factory.hpp"
 #include "opentxs/core/Log.hpp"
@@ -44,6 +45,21 @@ StorageMemDB::StorageMemDB(
 {
 }
 
+auto StorageMemDB::delete_from_bucket(
+    const std::string& key,
+    const bool bucket) const -> bool
+{
+    eLock lock(shared_lock_);
+
+    if (bucket) {
+        a_.erase(key);
+    } else {
+        b_.erase(key);
+    }
+
+    return true;
+}
+
 auto StorageMemDB::EmptyBucket(const bool bucket) const -> bool
 {
     eLock lock(shared_lock_);
@@ -57,6 +73,26 @@ auto StorageMemDB::EmptyBucket(const bool bucket) const -> bool
     return true;
 }
 
+auto StorageMemDB::ListBucket(const bool bucket, const KeyCallback cb) const
+    -> bool
+{
+    auto keys = std::vector<std::string>{};
+
+    {
+        sLock lock(shared_lock_);
+        const auto& map = bucket ? a_ : b_;
+        keys.reserve(map.size());
+
+        for (const auto& [key, value] : map) { keys.emplace_back(key); }
+    }
+
+    for (const auto& key : keys) {
+        if (false == cb(key)) { break; }
+    }
+
+    return true;
+}
+
 auto StorageMemDB::LoadFromBucket(
     const std::string& key,
     std::string& value,
@@ -94,6 +130,8 @@ void StorageMemDB::store(
 {
     OT_ASSERT(nullptr != promise);
 
+    eLock lock(shared_lock_);
+
     if (bucket) {
         a_[key] = value;
     } else {
@@ -44,6 +44,8 @@ public:
         const std::string& key,
         std::string& value,
         const bool bucket) const -> bool final;
+    auto ListBucket(const bool bucket, const KeyCallback cb) const
+        -> bool final;
     auto LoadRoot() const -> std::string final;
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool final;
@@ -61,6 +63,8 @@ private:
     mutable std::map<std::string, std::string> a_{};
     mutable std::map<std::string, std::string> b_{};
 
+    auto delete_from_bucket(const std::string& key, const bool bucket) const
+        -> bool final;
     void store(
         const bool isTransaction,
         const std::string& key,
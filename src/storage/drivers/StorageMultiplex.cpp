@@ -7,11 +7,17 @@
 #include "1_Internal.hpp"                        // IWYU pragma: associated
 #include "storage/drivers/StorageMultiplex.hpp"  // IWYU pragma: associated
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <limits>
+#include <map>
 #include <memory>
 #include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "2_Factory.hpp"
@@ -33,6 +39,7 @@ namespace opentxs
 {
 auto Factory::StorageMultiplex(
     const api::storage::Storage& storage,
+    const storage::ObjectCache& cache,
     const Flag& primaryBucket,
     const StorageConfig& config,
     const String& primary,
@@ -43,6 +50,7 @@ auto Factory::StorageMultiplex(
 {
     return new opentxs::storage::implementation::StorageMultiplex(
         storage,
+        cache,
         primaryBucket,
         config,
         primary,
@@ -57,6 +65,7 @@ namespace opentxs::storage::implementation
 {
 StorageMultiplex::StorageMultiplex(
     const api::storage::Storage& storage,
+    const storage::ObjectCache& cache,
     const Flag& primaryBucket,
     const StorageConfig& config,
     const String& primary,
@@ -65,6 +74,7 @@ StorageMultiplex::StorageMultiplex(
     const Digest& hash,
     const Random& random)
     : storage_(storage)
+    , cache_(cache)
     , primary_bucket_(primaryBucket)
     , config_(config)
     , primary_plugin_()
@@ -72,6 +82,10 @@ StorageMultiplex::StorageMultiplex(
     , digest_(hash)
     , random_(random)
     , null_(crypto::key::Symmetric::Factory())
+    , write_lock_()
+    , write_cv_()
+    , writing_(false)
+    , pending_writes_()
 {
     Init_StorageMultiplex(primary, migrate, previous);
 }
@@ -131,10 +145,30 @@ auto StorageMultiplex::BestRoot(bool& primaryOutOfSync) -> std::string
     return bestHash;
 }
 
+auto StorageMultiplex::Cache() const -> const storage::ObjectCache*
+{
+    return &cache_;
+}
+
 void StorageMultiplex::Cleanup() { Cleanup_StorageMultiplex(); }
 
 void StorageMultiplex::Cleanup_StorageMultiplex() {}
 
+auto StorageMultiplex::DeleteFromBucket(
+    const std::string& key,
+    const bool bucket) const -> bool
+{
+    OT_ASSERT(primary_plugin_);
+
+    for (const auto& plugin : backup_plugins_) {
+        OT_ASSERT(plugin);
+
+        plugin->DeleteFromBucket(key, bucket);
+    }
+
+    return primary_plugin_->DeleteFromBucket(key, bucket);
+}
+
 auto StorageMultiplex::EmptyBucket(const bool bucket) const -> bool
 {
     OT_ASSERT(primary_plugin_);
@@ -203,6 +237,22 @@ void StorageMultiplex::InitEncryptedBackup(
     init_fs_backup(config_.fs_encrypted_backup_directory_);
 }
 
+auto StorageMultiplex::ListBucket(const bool bucket, const KeyCallback cb) const
+    -> bool
+{
+    OT_ASSERT(primary_plugin_);
+
+    auto output = primary_plugin_->ListBucket(bucket, cb);
+
+    for (const auto& plugin : backup_plugins_) {
+        OT_ASSERT(plugin);
+
+        output &= plugin->ListBucket(bucket, cb);
+    }
+
+    return output;
+}
+
 auto StorageMultiplex::Load(
     const std::string& key,
     const bool checking,
@@ -354,37 +404,58 @@ auto StorageMultiplex::Primary() -> opentxs::api::storage::Driver&
     return *primary_plugin_;
 }
 
-auto StorageMultiplex::Store(
+auto StorageMultiplex::queue_write(
     const bool isTransaction,
     const std::string& key,
     const std::string& value,
-    const bool bucket) const -> bool
+    const bool bucket) const -> std::future<bool>
 {
-    OT_ASSERT(primary_plugin_);
+    Lock lock(write_lock_);
+    auto& write = pending_writes_.emplace_back(
+        PendingWrite{isTransaction, bucket, key, value, {}});
+    auto output = write.promise_.get_future();
+    const auto finished = [&] {
+        return std::future_status::ready ==
+               output.wait_for(std::chrono::seconds{0});
+    };
+
+    // While another caller is committing, this write waits to be picked up as
+    // part of the next group. Each leader commits exactly one group and then
+    // hands off, so no caller is held past the completion of its own write.
+    write_cv_.wait(lock, [&] { return (false == writing_) || finished(); });
+
+    if (finished()) { return output; }
+
+    writing_ = true;
+    auto batch = std::vector<PendingWrite>{};
+    batch.swap(pending_writes_);
+    lock.unlock();
 
-    std::vector<std::promise<bool>> promises{};
-    std::vector<std::future<bool>> futures{};
-    promises.push_back(std::promise<bool>());
-    auto& primaryPromise = promises.back();
-    futures.push_back(primaryPromise.get_future());
-    primary_plugin_->Store(isTransaction, key, value, bucket, primaryPromise);
-
-    for (const auto& plugin : backup_plugins_) {
-        OT_ASSERT(plugin);
+    try {
+        write_batch(batch);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
-        promises.push_back(std::promise<bool>());
-        auto& promise = promises.back();
-        futures.push_back(promise.get_future());
-        plugin->Store(isTransaction, key, value, bucket, promise);
+        for (auto& item : batch) { item.promise_.set_value(false); }
     }
 
-    bool output = false;
-
-    for (auto& future : futures) { output |= future.get(); }
+    lock.lock();
+    writing_ = false;
+    lock.unlock();
+    write_cv_.notify_all();
 
     return output;
 }
 
+auto StorageMultiplex::Store(
+    const bool isTransaction,
+    const std::string& key,
+    const std::string& value,
+    const bool bucket) const -> bool
+{
+    return queue_write(isTransaction, key, value, bucket).get();
+}
+
 void StorageMultiplex::Store(
     const bool,
     const std::string&,
@@ -399,20 +470,14 @@ void StorageMultiplex::Store(
 
 auto StorageMultiplex::Store(
     const bool isTransaction,
-    const std::string& key,
-    std::string& value) const -> bool
+    const std::string& value,
+    std::string& key) const -> bool
 {
-    OT_ASSERT(primary_plugin_);
+    if (false == bool(digest_)) { return false; }
 
-    bool output = primary_plugin_->Store(isTransaction, key, value);
+    digest_(storage_.HashType(), value, writer(key));
 
-    for (const auto& plugin : backup_plugins_) {
-        OT_ASSERT(plugin);
-
-        output |= plugin->Store(isTransaction, key, value);
-    }
-
-    return output;
+    return Store(isTransaction, key, value, primary_bucket_);
 }
 
 auto StorageMultiplex::StoreRoot(const bool commit, const std::string& hash)
@@ -488,5 +553,85 @@ void StorageMultiplex::SynchronizePlugins(
     }
 }
 
+void StorageMultiplex::TrackWrites(const bool enabled) const
+{
+    OT_ASSERT(primary_plugin_);
+
+    primary_plugin_->TrackWrites(enabled);
+
+    for (const auto& plugin : backup_plugins_) {
+        OT_ASSERT(plugin);
+
+        plugin->TrackWrites(enabled);
+    }
+}
+
+auto StorageMultiplex::write_batch(std::vector<PendingWrite>& batch) const
+    -> void
+{
+    using Group = std::pair<bool, bool>;
+    auto groups = std::map<Group, opentxs::api::storage::Plugin::Batch>{};
+
+    for (const auto& write : batch) {
+        groups[{write.transaction_, write.bucket_}].emplace_back(
+            write.key_, write.value_);
+    }
+
+    auto results = std::map<Group, bool>{};
+
+    for (const auto& [group, items] : groups) {
+        const auto& [isTransaction, bucket] = group;
+        results[group] = write_group(isTransaction, bucket, items);
+    }
+
+    for (auto& write : batch) {
+        write.promise_.set_value(
+            results.at({write.transaction_, write.bucket_}));
+    }
+}
+
+auto StorageMultiplex::write_group(
+    const bool isTransaction,
+    const bool bucket,
+    const opentxs::api::storage::Plugin::Batch& items) const -> bool
+{
+    OT_ASSERT(primary_plugin_);
+
+    auto threads = std::vector<std::thread>{};
+    auto results = std::vector<int>(backup_plugins_.size(), 0);
+
+    for (auto i = std::size_t{0}; i < backup_plugins_.size(); ++i) {
+        const auto& plugin = backup_plugins_.at(i);
+
+        OT_ASSERT(plugin);
+
+        threads.emplace_back([&, i] {
+            try {
+                results.at(i) =
+                    plugin->StoreBatch(isTransaction, items, bucket);
+            } catch (const std::exception& e) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+            }
+        });
+    }
+
+    auto output = false;
+    auto error = std::exception_ptr{};
+
+    try {
+        output = primary_plugin_->StoreBatch(isTransaction, items, bucket);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    for (auto& thread : threads) { thread.join(); }
+
+    if (error) { std::rethrow_exception(error); }
+
+    for (const auto& result : results) { output |= (0 != result); }
+
+    return output;
+}
+
 StorageMultiplex::~StorageMultiplex() { Cleanup_StorageMultiplex(); }
 }  // namespace opentxs::storage::implementation
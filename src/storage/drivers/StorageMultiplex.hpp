@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -30,6 +32,7 @@ class Storage;
 
 namespace storage
 {
+class ObjectCache;
 class Root;
 }  // namespace storage
 
@@ -44,7 +47,12 @@ namespace opentxs::storage::implementation
 class StorageMultiplex final : virtual public opentxs::api::storage::Multiplex
 {
 public:
+    auto Cache() const -> const storage::ObjectCache* final;
+    auto DeleteFromBucket(const std::string& key, const bool bucket) const
+        -> bool final;
     auto EmptyBucket(const bool bucket) const -> bool final;
+    auto ListBucket(const bool bucket, const KeyCallback cb) const
+        -> bool final;
     auto LoadFromBucket(
         const std::string& key,
         std::string& value,
@@ -72,6 +80,7 @@ public:
         std::string& key) const -> bool final;
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool final;
+    void TrackWrites(const bool enabled) const final;
 
     auto BestRoot(bool& primaryOutOfSync) -> std::string final;
     void InitBackup() final;
@@ -87,7 +96,16 @@ public:
 private:
     friend Factory;
 
+    struct PendingWrite {
+        bool transaction_;
+        bool bucket_;
+        std::string key_;
+        std::string value_;
+        std::promise<bool> promise_;
+    };
+
     const api::storage::Storage& storage_;
+    const storage::ObjectCache& cache_;
     const Flag& primary_bucket_;
     const StorageConfig& config_;
     std::unique_ptr<opentxs::api::storage::Plugin> primary_plugin_;
@@ -95,6 +113,10 @@ private:
     const Digest digest_;
     const Random random_;
     OTSymmetricKey null_;
+    mutable std::mutex write_lock_;
+    mutable std::condition_variable write_cv_;
+    mutable bool writing_;
+    mutable std::vector<PendingWrite> pending_writes_;
 
     auto Cleanup() -> void;
     auto Cleanup_StorageMultiplex() -> void;
@@ -116,9 +138,20 @@ private:
         const String& previous) -> void;
     auto migrate_primary(const std::string& from, const std::string& to)
         -> void;
+    auto queue_write(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket) const -> std::future<bool>;
+    auto write_batch(std::vector<PendingWrite>& batch) const -> void;
+    auto write_group(
+        const bool isTransaction,
+        const bool bucket,
+        const opentxs::api::storage::Plugin::Batch& items) const -> bool;
 
     StorageMultiplex(
         const api::storage::Storage& storage,
+        const storage::ObjectCache& cache,
         const Flag& primaryBucket,
         const StorageConfig& config,
         const String& primary,
@@ -110,8 +110,30 @@ auto StorageSqlite3::Create(const std::string& tablename) const -> bool
         SQLITE_OK == sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr));
 }
 
+auto StorageSqlite3::delete_from_bucket(
+    const std::string& key,
+    const bool bucket) const -> bool
+{
+    OT_ASSERT(std::numeric_limits<int>::max() >= key.size());
+
+    sqlite3_stmt* statement{nullptr};
+    const std::string query =
+        "DELETE FROM `" + GetTableName(bucket) + "` WHERE k = ?1;";
+    Lock lock(transaction_lock_);
+    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr);
+    sqlite3_bind_text(
+        statement, 1, key.c_str(), static_cast<int>(key.size()), SQLITE_STATIC);
+    LogVerbose(OT_METHOD)(__FUNCTION__)(expand_sql(statement)).Flush();
+    const auto result = sqlite3_step(statement);
+    sqlite3_finalize(statement);
+
+    return (result == SQLITE_DONE);
+}
+
 auto StorageSqlite3::EmptyBucket(const bool bucket) const -> bool
 {
+    Lock lock(transaction_lock_);
+
     return Purge(GetTableName(bucket));
 }
 
@@ -153,6 +175,38 @@ void StorageSqlite3::Init_StorageSqlite3()
     }
 }
 
+auto StorageSqlite3::ListBucket(const bool bucket, const KeyCallback cb) const
+    -> bool
+{
+    sqlite3_stmt* statement{nullptr};
+    const std::string query = "SELECT k FROM `" + GetTableName(bucket) + "`;";
+    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr);
+    auto result = sqlite3_step(statement);
+
+    while (SQLITE_ROW == result) {
+        const auto size = sqlite3_column_bytes(statement, 0);
+        const auto* key = sqlite3_column_text(statement, 0);
+
+        if ((nullptr != key) && (0 < size)) {
+            const auto keep = cb(
+                std::string{reinterpret_cast<const char*>(key),
+                            static_cast<std::size_t>(size)});
+
+            if (false == keep) {
+                result = SQLITE_DONE;
+
+                break;
+            }
+        }
+
+        result = sqlite3_step(statement);
+    }
+
+    sqlite3_finalize(statement);
+
+    return (result == SQLITE_DONE);
+}
+
 auto StorageSqlite3::LoadFromBucket(
     const std::string& key,
     std::string& value,
@@ -344,10 +398,51 @@ void StorageSqlite3::store(
         pending_.emplace_back(key, value);
         promise->set_value(true);
     } else {
+        Lock lock(transaction_lock_);
         promise->set_value(Upsert(key, GetTableName(bucket), value));
     }
 }
 
+auto StorageSqlite3::store_batch(
+    const bool isTransaction,
+    const Batch& items,
+    const bool bucket) const -> bool
+{
+    if (isTransaction) {
+        Lock lock(transaction_lock_);
+        transaction_bucket_->Set(bucket);
+
+        for (const auto& [key, value] : items) {
+            pending_.emplace_back(key, value);
+        }
+
+        return true;
+    }
+
+    const auto tablename = GetTableName(bucket);
+    // Every statement on this connection between BEGIN and COMMIT joins the
+    // explicit transaction, so root commits and other writes must wait
+    Lock lock(transaction_lock_);
+
+    if (SQLITE_OK != sqlite3_exec(
+                         db_, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr)) {
+
+        return false;
+    }
+
+    auto output{true};
+
+    for (const auto& [key, value] : items) {
+        output &= Upsert(key, tablename, value);
+    }
+
+    const auto* finish = output ? "COMMIT TRANSACTION;" : "ROLLBACK;";
+    output &=
+        (SQLITE_OK == sqlite3_exec(db_, finish, nullptr, nullptr, nullptr));
+
+    return output;
+}
+
 auto StorageSqlite3::StoreRoot(const bool commit, const std::string& hash) const
     -> bool
 {
@@ -355,6 +450,7 @@ auto StorageSqlite3::StoreRoot(const bool commit, const std::string& hash) const
 
         return commit_transaction(hash);
     } else {
+        Lock lock(transaction_lock_);
 
         return Upsert(
             config_.sqlite3_root_key_, config_.sqlite3_control_table_, hash);
@@ -51,6 +51,8 @@ public:
         const std::string& key,
         std::string& value,
         const bool bucket) const -> bool final;
+    auto ListBucket(const bool bucket, const KeyCallback cb) const
+        -> bool final;
     auto LoadRoot() const -> std::string final;
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool final;
@@ -79,6 +81,8 @@ private:
     void commit(std::stringstream& sql) const;
     auto commit_transaction(const std::string& rootHash) const -> bool;
     auto Create(const std::string& tablename) const -> bool;
+    auto delete_from_bucket(const std::string& key, const bool bucket) const
+        -> bool final;
     auto expand_sql(sqlite3_stmt* statement) const -> std::string;
     auto GetTableName(const bool bucket) const -> std::string;
     auto Select(
@@ -95,6 +99,10 @@ private:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const final;
+    auto store_batch(
+        const bool isTransaction,
+        const Batch& items,
+        const bool bucket) const -> bool final;
     auto Upsert(
         const std::string& key,
         const std::string& tablename,
@@ -122,7 +122,7 @@ auto Bip47Channels::index(
 
 auto Bip47Channels::init(const std::string& hash) -> void
 {
-    auto proto = std::shared_ptr<proto::StorageBip47Contexts>{};
+    auto proto = std::shared_ptr<const proto::StorageBip47Contexts>{};
     driver_.LoadProto(hash, proto);
 
     if (!proto) {
@@ -88,7 +88,7 @@ void Contacts::extract_nyms(const Lock& lock, const proto::Contact& data) const
 
 void Contacts::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageContacts> serialized{nullptr};
+    std::shared_ptr<const proto::StorageContacts> serialized{nullptr};
     driver_.LoadProto(hash, serialized);
 
     if (false == bool(serialized)) {
@@ -301,6 +301,7 @@ auto Contacts::Store(const proto::Contact& data, const std::string& alias)
     const bool existingKey = (item_map_.end() != item_map_.find(id));
     auto& metadata = item_map_[id];
     auto& hash = std::get<0>(metadata);
+    invalidate(lock);
 
     if (existingKey) {
         const bool revisionCheck = check_revision<proto::Contact>(
@@ -327,6 +328,6 @@ auto Contacts::Store(const proto::Contact& data, const std::string& alias)
     reconcile_maps(lock, data);
     extract_nyms(lock, data);
 
-    return save(lock);
+    return commit(lock);
 }
 }  // namespace opentxs::storage
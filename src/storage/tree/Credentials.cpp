@@ -68,7 +68,7 @@ auto Credentials::check_existing(const bool incoming, Metadata& metadata) const
     // hasn't been updated
     // ...so we have to load the credential just to be sure
     if (!isPrivate) {
-        std::shared_ptr<proto::Credential> existing;
+        std::shared_ptr<const proto::Credential> existing;
 
         if (!driver_.LoadProto(hash, existing, false)) {
             std::cerr << __FUNCTION__ << ": Failed to load object" << std::endl;
@@ -90,7 +90,7 @@ auto Credentials::Delete(const std::string& id) -> bool
 
 void Credentials::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageCredentials> serialized;
+    std::shared_ptr<const proto::StorageCredentials> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -112,7 +112,7 @@ auto Credentials::Load(
     std::shared_ptr<proto::Credential>& cred,
     const bool checking) const -> bool
 {
-    std::lock_guard<std::mutex> lock(write_lock_);
+    Lock lock(write_lock_);
     const bool exists = (item_map_.end() != item_map_.find(id));
 
     if (!exists) {
@@ -131,10 +131,15 @@ auto Credentials::Load(
 
     if (!loaded) { return false; }
 
-    isPrivate =
+    const auto loadedPrivate =
         (crypto::key::asymmetric::Mode::Private ==
          opentxs::crypto::key::internal::translate(cred->mode()));
 
+    if (loadedPrivate != isPrivate) {
+        isPrivate = loadedPrivate;
+        invalidate(lock);
+    }
+
     return true;
 }
 
@@ -189,6 +194,7 @@ auto Credentials::Store(const proto::Credential& cred, const std::string& alias)
 
     auto& metadata = item_map_[id];
     auto& hash = std::get<0>(metadata);
+    invalidate(lock);
 
     if (existingKey && incomingPublic) {
         if (!check_existing(incomingPrivate, metadata)) {
@@ -204,7 +210,7 @@ auto Credentials::Store(const proto::Credential& cred, const std::string& alias)
 
     if (!alias.empty()) { std::get<1>(metadata) = alias; }
 
-    return save(lock);
+    return commit(lock);
 }
 }  // namespace storage
 }  // namespace opentxs
@@ -46,7 +46,7 @@ auto Issuers::Delete(const std::string& id) -> bool { return delete_item(id); }
 
 void Issuers::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageIssuers> serialized;
+    std::shared_ptr<const proto::StorageIssuers> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -44,7 +44,7 @@ auto Mailbox::Delete(const std::string& id) -> bool { return delete_item(id); }
 
 void Mailbox::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNymList> serialized;
+    std::shared_ptr<const proto::StorageNymList> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
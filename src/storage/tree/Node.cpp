@@ -7,6 +7,9 @@
 #include "1_Internal.hpp"         // IWYU pragma: associated
 #include "storage/tree/Node.hpp"  // IWYU pragma: associated
 
+#include <atomic>
+#include <memory>
+
 #include "opentxs/api/storage/Driver.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/protobuf/Contact.pb.h"
@@ -22,7 +25,8 @@ namespace opentxs::storage
 const std::string Node::BLANK_HASH = "blankblankblankblankblank";
 
 Node::Node(const opentxs::api::storage::Driver& storage, const std::string& key)
-    : driver_(storage)
+    : snapshot_()
+    , driver_(storage)
     , version_(0)
     , original_version_(0)
     , root_(key)
@@ -53,6 +57,13 @@ auto Node::delete_item(const std::string& id) -> bool
     return delete_item(lock, id);
 }
 
+auto Node::commit(const Lock& lock) const -> bool
+{
+    invalidate(lock);
+
+    return save(lock);
+}
+
 auto Node::delete_item(const Lock& lock, const std::string& id) -> bool
 {
     OT_ASSERT(verify_write_lock(lock))
@@ -61,7 +72,7 @@ auto Node::delete_item(const Lock& lock, const std::string& id) -> bool
 
     if (0 == items) { return false; }
 
-    return save(lock);
+    return commit(lock);
 }
 
 auto Node::extract_revision(const proto::Contact& input) const -> std::uint64_t
@@ -82,25 +93,42 @@ auto Node::extract_revision(const proto::Seed& input) const -> std::uint64_t
 auto Node::get_alias(const std::string& id) const -> std::string
 {
     std::string output;
-    std::lock_guard<std::mutex> lock(write_lock_);
-    const auto& it = item_map_.find(id);
+    const auto index = snapshot();
+    const auto& it = index->find(id);
 
-    if (item_map_.end() != it) { output = std::get<1>(it->second); }
+    if (index->end() != it) { output = std::get<1>(it->second); }
 
     return output;
 }
 
+auto Node::Hash(const std::string& id) const -> std::string
+{
+    const auto index = snapshot();
+    const auto it = index->find(id);
+
+    if (index->end() == it) { return {}; }
+
+    const auto& hash = std::get<0>(it->second);
+
+    return check_hash(hash) ? hash : std::string{};
+}
+
+void Node::invalidate(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock))
+
+    std::atomic_store(&snapshot_, std::shared_ptr<const Index>{});
+}
+
 auto Node::List() const -> ObjectList
 {
     ObjectList output;
-    Lock lock(write_lock_);
+    const auto index = snapshot();
 
-    for (const auto& it : item_map_) {
+    for (const auto& it : *index) {
         output.push_back({it.first, std::get<1>(it.second)});
     }
 
-    lock.unlock();
-
     return output;
 }
 
@@ -110,9 +138,9 @@ auto Node::load_raw(
     std::string& alias,
     const bool checking) const -> bool
 {
-    std::lock_guard<std::mutex> lock(write_lock_);
-    const auto& it = item_map_.find(id);
-    const bool exists = (item_map_.end() != it);
+    const auto index = snapshot();
+    const auto& it = index->find(id);
+    const bool exists = (index->end() != it);
 
     if (!exists) {
         if (!checking) {
@@ -215,7 +243,7 @@ auto Node::set_alias(const std::string& id, const std::string& alias) -> bool
 
     std::get<1>(item_map_[id]) = alias;
 
-    return save(lock);
+    return commit(lock);
 }
 
 void Node::set_hash(
@@ -266,16 +294,39 @@ auto Node::store_raw(
 
     auto& metadata = item_map_[id];
     auto& hash = std::get<0>(metadata);
+    invalidate(lock);
 
     if (!driver_.Store(true, data, hash)) { return false; }
 
     if (!alias.empty()) { std::get<1>(metadata) = alias; }
 
-    return save(lock);
+    return commit(lock);
+}
+
+auto Node::snapshot() const -> std::shared_ptr<const Index>
+{
+    auto output = std::atomic_load(&snapshot_);
+
+    if (output) { return output; }
+
+    Lock lock(write_lock_);
+    output = std::atomic_load(&snapshot_);
+
+    if (output) { return output; }
+
+    output = std::make_shared<const Index>(item_map_);
+    std::atomic_store(&snapshot_, output);
+
+    return output;
 }
 
 auto Node::UpgradeLevel() const -> VersionNumber { return original_version_; }
 
+auto Node::VerifiedKey(const std::string& hash) -> std::string
+{
+    return hash + ".verified";
+}
+
 auto Node::verify_write_lock(const Lock& lock) const -> bool
 {
     if (lock.mutex() != &write_lock_) {
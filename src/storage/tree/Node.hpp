@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
@@ -84,12 +85,13 @@ protected:
 
         auto& metadata = item_map_[id];
         auto& hash = std::get<0>(metadata);
+        invalidate(lock);
 
         if (!driver_.StoreProto<T>(data, hash, plaintext)) { return false; }
 
         if (!alias.empty()) { std::get<1>(metadata) = alias; }
 
-        return save(lock);
+        return commit(lock);
     }
 
     template <class T>
@@ -122,9 +124,9 @@ protected:
         std::string& alias,
         const bool checking) const -> bool
     {
-        Lock lock(write_lock_);
-        const auto& it = item_map_.find(id);
-        const bool exists = (item_map_.end() != it);
+        const auto index = snapshot();
+        const auto& it = index->find(id);
+        const bool exists = (index->end() != it);
 
         if (!exists) {
             if (!checking) {
@@ -143,13 +145,11 @@ protected:
     template <class T>
     void map(const std::function<void(const T&)> input) const
     {
-        Lock lock(write_lock_);
-        const auto copy = item_map_;
-        lock.unlock();
+        const auto index = snapshot();
 
-        for (const auto& it : copy) {
+        for (const auto& it : *index) {
             const auto& hash = std::get<0>(it.second);
-            std::shared_ptr<T> serialized;
+            std::shared_ptr<const T> serialized;
 
             if (Node::BLANK_HASH == hash) { continue; }
 
@@ -174,7 +174,7 @@ protected:
         // hasn't been updated
         // ...so we have to load the object just to be sure
         if (0 == revision) {
-            std::shared_ptr<T> existing{nullptr};
+            std::shared_ptr<const T> existing{nullptr};
 
             if (false == driver_.LoadProto(hash, existing, false)) {
                 LogOutput(method)(__FUNCTION__)(": Unable to load object.")
@@ -196,6 +196,9 @@ private:
     auto operator=(const Node&) -> Node& = delete;
     auto operator=(Node&&) -> Node& = delete;
 
+    /// Read-only copy of item_map_ shared by readers until the next mutation
+    mutable std::shared_ptr<const Index> snapshot_;
+
 protected:
     friend storage::Root;
 
@@ -211,10 +214,14 @@ protected:
     static auto normalize_hash(const std::string& hash) -> std::string;
 
     auto check_hash(const std::string& hash) const -> bool;
+    /// Drops the published snapshot and persists the modified index
+    auto commit(const Lock& lock) const -> bool;
     auto extract_revision(const proto::Contact& input) const -> std::uint64_t;
     auto extract_revision(const proto::Nym& input) const -> std::uint64_t;
     auto extract_revision(const proto::Seed& input) const -> std::uint64_t;
     auto get_alias(const std::string& id) const -> std::string;
+    /// Must be called with write_lock_ held whenever item_map_ is modified
+    void invalidate(const Lock& lock) const;
     auto load_raw(
         const std::string& id,
         std::string& output,
@@ -265,6 +272,7 @@ protected:
         const std::string& data,
         const std::string& id,
         const std::string& alias) -> bool;
+    auto snapshot() const -> std::shared_ptr<const Index>;
     auto verify_write_lock(const Lock& lock) const -> bool;
 
     virtual void init(const std::string& hash) = 0;
@@ -272,6 +280,11 @@ protected:
     Node(const opentxs::api::storage::Driver& storage, const std::string& key);
 
 public:
+    /// Storage key of the verification record for the object at hash
+    static auto VerifiedKey(const std::string& hash) -> std::string;
+
+    /// Storage key of the item with the specified id, if it exists
+    auto Hash(const std::string& id) const -> std::string;
     virtual auto List() const -> ObjectList;
     virtual auto Migrate(const opentxs::api::storage::Driver& to) const -> bool;
     auto Root() const -> std::string;
@@ -132,7 +132,7 @@ auto Notary::get_or_create_list(
 
 void Notary::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNotary> serialized;
+    std::shared_ptr<const proto::StorageNotary> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (false == bool(serialized)) {
@@ -220,6 +220,13 @@ auto Nym::contexts() const -> storage::Contexts*
 
 auto Nym::Contexts() const -> const storage::Contexts& { return *contexts(); }
 
+auto Nym::CredentialsHash() const -> std::string
+{
+    Lock lock(write_lock_);
+
+    return check_hash(credentials_) ? credentials_ : std::string{};
+}
+
 template <typename T>
 auto Nym::editor(std::string& root, std::mutex& mutex, T* (Nym::*get)() const)
     -> Editor<T>
@@ -281,7 +288,7 @@ auto Nym::IncomingReplyBox() const -> const PeerReplies&
 
 void Nym::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNym> serialized;
+    std::shared_ptr<const proto::StorageNym> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -872,7 +879,7 @@ auto Nym::Store(
             if (checked_.get()) {
                 saveOk = !private_.get();
             } else {
-                std::shared_ptr<proto::Nym> serialized;
+                std::shared_ptr<const proto::Nym> serialized;
                 driver_.LoadProto(credentials_, serialized, true);
                 saveOk = !private_.get();
             }
@@ -112,6 +112,7 @@ public:
     auto mutable_PaymentWorkflows() -> Editor<storage::PaymentWorkflows>;
 
     auto Alias() const -> std::string;
+    auto CredentialsHash() const -> std::string;
     auto Load(
         const std::string& id,
         std::shared_ptr<proto::HDAccount>& output,
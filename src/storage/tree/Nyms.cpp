@@ -59,7 +59,7 @@ auto Nyms::Exists(const std::string& id) const -> bool
 
 void Nyms::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNymList> serialized;
+    std::shared_ptr<const proto::StorageNymList> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -97,7 +97,7 @@ void Nyms::Map(NymLambda lambda) const
         const auto& node = *nym(id);
         const auto& hash = node.credentials_;
 
-        std::shared_ptr<proto::Nym> serialized;
+        std::shared_ptr<const proto::Nym> serialized;
 
         if (Node::BLANK_HASH == hash) { continue; }
 
@@ -140,6 +140,7 @@ auto Nyms::nym(const Lock& lock, const std::string& id) const -> storage::Nym*
     OT_ASSERT(verify_write_lock(lock))
 
     const auto index = item_map_[id];
+    invalidate(lock);
     const auto hash = std::get<0>(index);
     const auto alias = std::get<1>(index);
     auto& node = nyms_[id];
@@ -233,7 +234,7 @@ void Nyms::save(storage::Nym* nym, const Lock& lock, const std::string& id)
 
     if (nym->private_.get()) { local_nyms_.emplace(nym->nymid_); }
 
-    if (!save(lock)) {
+    if (!commit(lock)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Save error.").Flush();
         abort();
     }
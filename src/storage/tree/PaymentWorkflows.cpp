@@ -118,7 +118,7 @@ auto PaymentWorkflows::GetState(const std::string& workflowID) const
 
 void PaymentWorkflows::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StoragePaymentWorkflows> serialized;
+    std::shared_ptr<const proto::StoragePaymentWorkflows> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -47,7 +47,7 @@ auto PeerReplies::Delete(const std::string& id) -> bool
 
 void PeerReplies::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNymList> serialized;
+    std::shared_ptr<const proto::StorageNymList> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -47,7 +47,7 @@ auto PeerRequests::Delete(const std::string& id) -> bool
 
 void PeerRequests::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNymList> serialized;
+    std::shared_ptr<const proto::StorageNymList> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
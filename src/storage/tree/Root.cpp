@@ -7,8 +7,12 @@
 #include "1_Internal.hpp"         // IWYU pragma: associated
 #include "storage/tree/Root.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <ctime>
 #include <functional>
+#include <future>
+#include <utility>
+#include <vector>
 
 #include "opentxs/api/storage/Driver.hpp"
 #include "opentxs/core/Log.hpp"
@@ -21,6 +25,7 @@
 #include "storage/tree/Tree.hpp"
 
 #define CURRENT_VERSION 2
+#define GC_SWEEP_BATCH 1000
 
 #define OT_METHOD "opentxs::storage::Root::"
 
@@ -28,6 +33,94 @@ namespace opentxs
 {
 namespace storage
 {
+// Walks a tree in place of a real migration target: index objects are loaded
+// from the underlying driver but item hashes are only recorded, so marking
+// costs one read per index node and no writes.
+class GarbageMarker final : virtual public opentxs::api::storage::Driver
+{
+public:
+    auto Cache() const -> const ObjectCache* final { return nullptr; }
+    auto DeleteFromBucket(const std::string&, const bool) const -> bool final
+    {
+        return false;
+    }
+    auto EmptyBucket(const bool) const -> bool final { return false; }
+    auto ListBucket(const bool, const KeyCallback) const -> bool final
+    {
+        return false;
+    }
+    auto Load(const std::string& key, const bool checking, std::string& value)
+        const -> bool final
+    {
+        return driver_.Load(key, checking, value);
+    }
+    auto LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const -> bool final
+    {
+        return driver_.LoadFromBucket(key, value, bucket);
+    }
+    auto LoadRoot() const -> std::string final { return driver_.LoadRoot(); }
+    auto Migrate(const std::string& key, const Driver&) const -> bool final
+    {
+        live_.emplace(key);
+        // A verification record lives as long as the object it describes
+        live_.emplace(Node::VerifiedKey(key));
+
+        return true;
+    }
+    auto Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket) const -> bool final
+    {
+        return driver_.Store(isTransaction, key, value, bucket);
+    }
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final
+    {
+        driver_.Store(isTransaction, key, value, bucket, promise);
+    }
+    auto Store(
+        const bool isTransaction,
+        const std::string& value,
+        std::string& key) const -> bool final
+    {
+        return driver_.Store(isTransaction, value, key);
+    }
+    auto StoreRoot(const bool, const std::string&) const -> bool final
+    {
+        return false;
+    }
+    void TrackWrites(const bool) const final {}
+
+    GarbageMarker(
+        const opentxs::api::storage::Driver& driver,
+        std::unordered_set<std::string>& live)
+        : driver_(driver)
+        , live_(live)
+    {
+    }
+
+    ~GarbageMarker() final = default;
+
+private:
+    const opentxs::api::storage::Driver& driver_;
+    std::unordered_set<std::string>& live_;
+
+    GarbageMarker() = delete;
+    GarbageMarker(const GarbageMarker&) = delete;
+    GarbageMarker(GarbageMarker&&) = delete;
+    auto operator=(const GarbageMarker&) -> GarbageMarker& = delete;
+    auto operator=(GarbageMarker&&) -> GarbageMarker& = delete;
+};
+
 Root::Root(
     const opentxs::api::storage::Driver& storage,
     const std::string& hash,
@@ -39,6 +132,7 @@ Root::Root(
     , current_bucket_(bucket)
     , gc_running_(Flag::Factory(false))
     , gc_resume_(Flag::Factory(false))
+    , gc_shutdown_(Flag::Factory(false))
     , last_gc_()
     , sequence_()
     , gc_lock_()
@@ -66,43 +160,30 @@ void Root::blank(const VersionNumber version)
 
 void Root::cleanup() const
 {
-    Lock gclock(gc_lock_);
-
-    if (gc_thread_) {
-        if (gc_thread_->joinable()) { gc_thread_->join(); }
-
-        gc_thread_.reset();
-    }
+    gc_shutdown_->On();
+    join_gc();
 }
 
-void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
+void Root::collect_garbage() const
 {
     Lock lock(write_lock_);
     LogTrace(OT_METHOD)(__FUNCTION__)(": Beginning garbage collection.")
         .Flush();
-    const auto resume = gc_resume_->Set(false);
-    bool oldLocation = false;
-
-    if (resume) {
-        oldLocation = !current_bucket_;
-    } else {
-        gc_root_ = tree()->Root();
-        oldLocation = current_bucket_.Toggle();
-        save(lock);
-        driver_.StoreRoot(true, root_);
-    }
-
+    gc_resume_->Off();
+    // Every object stored from this point on is protected from the sweep,
+    // which covers anything which becomes reachable after the mark snapshot
+    driver_.TrackWrites(true);
+    gc_root_ = tree()->Root();
+    save(lock);
+    driver_.StoreRoot(true, root_);
     lock.unlock();
-    bool success{false};
+    auto live = std::unordered_set<std::string>{};
+    // NOTE both buckets are swept since objects written by the previous
+    // copying collector may reside in either one
+    const auto success = mark(live) && sweep(live, current_bucket_) &&
+                         sweep(live, !current_bucket_);
 
-    if (Node::check_hash(gc_root_)) {
-        const storage::Tree tree(driver_, gc_root_);
-        success = tree.Migrate(*to);
-    }
-
-    if (success) {
-        driver_.EmptyBucket(oldLocation);
-    } else {
+    if (false == success) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Garbage collection failed. "
                                            "Will retry next cycle.")
             .Flush();
@@ -110,11 +191,22 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
 
     Lock gcLock(gc_lock_, std::defer_lock);
     std::lock(gcLock, lock);
-    gc_running_->Off();
-    gc_root_ = "";
-    last_gc_.store(std::time(nullptr));
-    save(lock);
-    driver_.StoreRoot(true, root_);
+    driver_.TrackWrites(false);
+
+    if (gc_shutdown_.get()) {
+        // Leave the in-progress flag set in the saved root so the next
+        // session resumes collection immediately
+        save(lock);
+        driver_.StoreRoot(true, root_);
+        gc_running_->Off();
+    } else {
+        gc_running_->Off();
+        gc_root_ = "";
+        last_gc_.store(std::time(nullptr));
+        save(lock);
+        driver_.StoreRoot(true, root_);
+    }
+
     lock.unlock();
     gcLock.unlock();
     LogTrace(OT_METHOD)(__FUNCTION__)(": Finished garbage collection.").Flush();
@@ -122,7 +214,7 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
 
 void Root::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageRoot> serialized;
+    std::shared_ptr<const proto::StorageRoot> serialized;
 
     if (!driver_.LoadProto(hash, serialized)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to load root object file.")
@@ -140,7 +232,27 @@ void Root::init(const std::string& hash)
     tree_root_ = normalize_hash(serialized->items());
 }
 
-auto Root::Migrate(const opentxs::api::storage::Driver& to) const -> bool
+void Root::join_gc() const
+{
+    Lock gclock(gc_lock_);
+    auto thread = std::move(gc_thread_);
+    // collect_garbage acquires gc_lock_ before it returns
+    gclock.unlock();
+
+    if (thread && thread->joinable()) { thread->join(); }
+}
+
+auto Root::mark(std::unordered_set<std::string>& live) const -> bool
+{
+    if (false == check_hash(gc_root_)) { return true; }
+
+    const auto marker = GarbageMarker{driver_, live};
+    const storage::Tree tree(marker, gc_root_);
+
+    return tree.Migrate(marker);
+}
+
+auto Root::Migrate(const opentxs::api::storage::Driver&) const -> bool
 {
     if (0 == gc_interval_) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Garbage collection disabled.")
@@ -158,9 +270,8 @@ auto Root::Migrate(const opentxs::api::storage::Driver& to) const -> bool
         const auto running = gc_running_->Set(true);
 
         if (!running) {
-            cleanup();
-            gc_thread_.reset(
-                new std::thread(&Root::collect_garbage, this, &to));
+            join_gc();
+            gc_thread_.reset(new std::thread(&Root::collect_garbage, this));
 
             return true;
         }
@@ -236,6 +347,41 @@ auto Root::serialize() const -> proto::StorageRoot
     return output;
 }
 
+auto Root::sweep(
+    const std::unordered_set<std::string>& live,
+    const bool bucket) const -> bool
+{
+    auto garbage = std::vector<std::string>{};
+    const auto listed =
+        driver_.ListBucket(bucket, [&](const std::string& key) -> bool {
+            if (0 == live.count(key)) { garbage.emplace_back(key); }
+
+            return false == gc_shutdown_.get();
+        });
+
+    if (false == listed) { return false; }
+
+    // The same key may be reported by more than one plugin
+    std::sort(garbage.begin(), garbage.end());
+    garbage.erase(std::unique(garbage.begin(), garbage.end()), garbage.end());
+    LogTrace(OT_METHOD)(__FUNCTION__)(": Removing ")(garbage.size())(
+        " unreachable objects")
+        .Flush();
+    auto count = std::size_t{0};
+
+    for (const auto& key : garbage) {
+        if (0 == (++count % GC_SWEEP_BATCH)) {
+            if (gc_shutdown_.get()) { return false; }
+
+            std::this_thread::yield();
+        }
+
+        driver_.DeleteFromBucket(key, bucket);
+    }
+
+    return true;
+}
+
 auto Root::tree() const -> storage::Tree*
 {
     Lock lock(tree_lock_);
@@ -12,6 +12,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_set>
 
 #include "Proto.hpp"
 #include "opentxs/Types.hpp"
@@ -55,6 +56,7 @@ private:
     Flag& current_bucket_;
     mutable OTFlag gc_running_;
     mutable OTFlag gc_resume_;
+    mutable OTFlag gc_shutdown_;
     mutable std::atomic<std::uint64_t> last_gc_;
     mutable std::atomic<std::uint64_t> sequence_;
     mutable std::mutex gc_lock_;
@@ -64,12 +66,16 @@ private:
     mutable std::unique_ptr<storage::Tree> tree_;
 
     auto serialize() const -> proto::StorageRoot;
+    auto sweep(const std::unordered_set<std::string>& live, const bool bucket)
+        const -> bool;
     auto tree() const -> storage::Tree*;
 
     void blank(const VersionNumber version) final;
     void cleanup() const;
-    void collect_garbage(const opentxs::api::storage::Driver* to) const;
+    void collect_garbage() const;
     void init(const std::string& hash) final;
+    void join_gc() const;
+    auto mark(std::unordered_set<std::string>& live) const -> bool;
     auto save(const Lock& lock, const opentxs::api::storage::Driver& to) const
         -> bool;
     auto save(const Lock& lock) const -> bool final;
@@ -61,7 +61,7 @@ auto Seeds::Delete(const std::string& id) -> bool { return delete_item(id); }
 
 void Seeds::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageSeeds> serialized;
+    std::shared_ptr<const proto::StorageSeeds> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -156,6 +156,7 @@ auto Seeds::Store(const proto::Seed& data, const std::string& alias) -> bool
     const bool existingKey = (item_map_.end() != item_map_.find(id));
     auto& metadata = item_map_[id];
     auto& hash = std::get<0>(metadata);
+    invalidate(lock);
 
     if (existingKey) {
         const bool revisionCheck =
@@ -175,7 +176,7 @@ auto Seeds::Store(const proto::Seed& data, const std::string& alias) -> bool
 
     if (!alias.empty()) { std::get<1>(metadata) = alias; }
 
-    return save(lock);
+    return commit(lock);
 }
 }  // namespace storage
 }  // namespace opentxs
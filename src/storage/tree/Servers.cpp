@@ -49,7 +49,7 @@ auto Servers::Delete(const std::string& id) -> bool { return delete_item(id); }
 
 void Servers::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageServers> serialized;
+    std::shared_ptr<const proto::StorageServers> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -153,7 +153,7 @@ auto Thread::Alias() const -> std::string
 
 void Thread::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageThread> serialized;
+    std::shared_ptr<const proto::StorageThread> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (false == bool(serialized)) {
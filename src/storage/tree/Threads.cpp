@@ -139,6 +139,7 @@ auto Threads::create(
     }
 
     const auto index = item_map_[id];
+    invalidate(lock);
     const auto hash = std::get<0>(index);
     const auto alias = std::get<1>(index);
     auto& node = threads_[id];
@@ -147,7 +148,7 @@ auto Threads::create(
         Lock threadLock(newThread->write_lock_);
         newThread->save(threadLock);
         node.swap(newThread);
-        save(lock);
+        commit(lock);
     } else {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Thread already exists.").Flush();
     }
@@ -195,7 +196,7 @@ auto Threads::FindAndDeleteItem(const std::string& itemID) -> bool
 
 void Threads::init(const std::string& hash)
 {
-    auto input = std::shared_ptr<proto::StorageNymList>{};
+    auto input = std::shared_ptr<const proto::StorageNymList>{};
     driver_.LoadProto(hash, input);
 
     if (!input) {
@@ -216,7 +217,7 @@ void Threads::init(const std::string& hash)
     for (const auto& hash : input->localnymid()) {
         try {
             auto index =
-                std::shared_ptr<proto::StorageBlockchainTransactions>{};
+                std::shared_ptr<const proto::StorageBlockchainTransactions>{};
             auto loaded = driver_.LoadProto(hash, index, false);
 
             OT_ASSERT(loaded && index);
@@ -304,6 +305,7 @@ auto Threads::thread(
     }
 
     const auto index = item_map_[id];
+    invalidate(lock);
     const auto hash = std::get<0>(index);
     const auto alias = std::get<1>(index);
     auto& node = threads_[id];
@@ -371,7 +373,7 @@ auto Threads::Rename(const std::string& existingID, const std::string& newID)
     item_map_.erase(it);
     item_map_.emplace(newID, meta);
 
-    return save(lock);
+    return commit(lock);
 }
 
 auto Threads::RemoveIndex(const Data& txid, const Identifier& thread) noexcept
@@ -423,7 +425,7 @@ void Threads::save(
     hash = nym->Root();
     alias = nym->Alias();
 
-    if (!save(lock)) {
+    if (!commit(lock)) {
         std::cerr << __FUNCTION__ << ": Save error" << std::endl;
         abort();
     }
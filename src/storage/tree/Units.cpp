@@ -49,7 +49,7 @@ auto Units::Delete(const std::string& id) -> bool { return delete_item(id); }
 
 void Units::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageUnits> serialized;
+    std::shared_ptr<const proto::StorageUnits> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"                          // IWYU pragma: associated
 #include "ui/accountactivity/AccountActivity.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <future>
 #include <utility>
 
@@ -90,6 +91,8 @@ AccountActivity::AccountActivity(
             return api.Factory().ServerContract();
         }
     }())
+    , pending_lock_()
+    , oldest_loaded_()
 {
 }
 
@@ -115,6 +118,24 @@ auto AccountActivity::init(Endpoints endpoints) noexcept -> void
     pipeline_->Push(MakeWork(OT_ZMQ_INIT_SIGNAL));
 }
 
+auto AccountActivity::page_boundary(
+    const Lock&,
+    std::vector<AccountActivitySortKey> keys) noexcept
+    -> AccountActivitySortKey
+{
+    if (false == oldest_loaded_.has_value()) {
+        if (page_size_ < keys.size()) {
+            const auto first = keys.end() - page_size_;
+            std::nth_element(keys.begin(), first, keys.end());
+            oldest_loaded_ = *first;
+        } else {
+            oldest_loaded_ = AccountActivitySortKey::min();
+        }
+    }
+
+    return oldest_loaded_.value();
+}
+
 AccountActivity::~AccountActivity()
 {
     wait_for_startup();
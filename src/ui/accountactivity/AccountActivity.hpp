@@ -10,6 +10,8 @@
 #endif  // OT_QT
 #include <atomic>
 #include <functional>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
@@ -229,8 +231,20 @@ protected:
     const AccountType type_;
     OTUnitDefinition contract_;
     OTServerContract notary_;
+    mutable std::mutex pending_lock_;
+    // Sort key of the oldest row which has been constructed
+    std::optional<AccountActivitySortKey> oldest_loaded_;
 
     using AccountActivityList::init;
+    /** Rows older than the returned key are deferred unless already loaded
+     *
+     *  keys must hold the sort key of every row in the account. Before the
+     *  first page has been loaded the boundary selects the newest page.
+     */
+    auto page_boundary(
+        const Lock& lock,
+        std::vector<AccountActivitySortKey> keys) noexcept
+        -> AccountActivitySortKey;
     // NOTE only call in final class constructor bodies
     auto init(Endpoints endpoints) noexcept -> void;
 
@@ -10,12 +10,15 @@
 #include <atomic>
 #include <functional>
 #include <future>
+#include <iterator>
 #include <limits>
 #include <list>
 #include <memory>
 #include <set>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "display/Definition.hpp"
 #include "internal/blockchain/Blockchain.hpp"
@@ -98,6 +101,7 @@ BlockchainAccountActivity::BlockchainAccountActivity(
           zmq::socket::Socket::Direction::Connect))
     , progress_()
     , sync_cb_()
+    , pending_()
 {
     const auto connected =
         balance_socket_->Start(Widget::api_.Endpoints().BlockchainBalance());
@@ -141,21 +145,133 @@ auto BlockchainAccountActivity::DisplayBalance() const noexcept -> std::string
     return blockchain::internal::Format(chain_, balance_.load());
 }
 
+auto BlockchainAccountActivity::index() const noexcept -> Pending
+{
+    // Rows are sorted by transaction timestamp, which is only known once a
+    // transaction has been loaded. Only the index is kept for transactions
+    // outside the loaded window.
+    auto output = Pending{};
+
+    for (auto& txid :
+         Widget::api_.Storage().BlockchainTransactionList(primary_id_)) {
+        const auto pTX = Widget::api_.Blockchain().LoadTransactionBitcoin(txid);
+
+        if (false == bool(pTX)) { continue; }
+
+        const auto& tx = *pTX;
+
+        if (false == contains(tx.Chains(), chain_)) { continue; }
+
+        output.emplace(tx.Timestamp(), std::move(txid));
+    }
+
+    return output;
+}
+
+auto BlockchainAccountActivity::load_page(const std::size_t count) noexcept
+    -> std::vector<ItemData>
+{
+    auto txids = std::vector<OTData>{};
+
+    {
+        Lock lock(pending_lock_);
+
+        while ((txids.size() < count) && (false == pending_.empty())) {
+            auto it = std::prev(pending_.end());
+            oldest_loaded_ = it->first;
+            txids.emplace_back(it->second);
+            pending_.erase(it);
+        }
+    }
+
+    auto output = std::vector<ItemData>{};
+    output.reserve(txids.size());
+
+    for (const auto& txid : txids) {
+        if (auto item = load_row(txid); item.has_value()) {
+            output.emplace_back(std::move(item.value()));
+        }
+    }
+
+    return output;
+}
+
 auto BlockchainAccountActivity::load_thread() noexcept -> void
 {
-    const auto transactions =
-        Widget::api_.Storage().BlockchainTransactionList(primary_id_);
+    const auto indexed = index();
+    auto load = std::vector<OTData>{};
     auto active = std::set<AccountActivityRowID>{};
 
-    for (const auto& txid : transactions) {
-        if (const auto id = process_txid(txid); id.has_value()) {
-            active.emplace(id.value());
+    {
+        Lock lock(pending_lock_);
+        const auto boundary = page_boundary(lock, [&] {
+            auto out = std::vector<AccountActivitySortKey>{};
+            out.reserve(indexed.size());
+
+            for (const auto& [time, txid] : indexed) { out.emplace_back(time); }
+
+            return out;
+        }());
+        pending_.clear();
+
+        for (const auto& entry : indexed) {
+            const auto& [time, txid] = entry;
+            const auto id = row_id(txid);
+            const auto defer =
+                (time < boundary) && (false == find_index(id).has_value());
+            active.emplace(id);
+
+            if (defer) {
+                pending_.emplace(entry);
+            } else {
+                load.emplace_back(txid);
+            }
+        }
+    }
+
+    auto items = std::vector<ItemData>{};
+    items.reserve(load.size());
+
+    for (const auto& txid : load) {
+        if (auto item = load_row(txid); item.has_value()) {
+            items.emplace_back(std::move(item.value()));
         }
     }
 
+    update_items(items);
     delete_inactive(active);
 }
 
+auto BlockchainAccountActivity::load_row(const Data& txid) const noexcept
+    -> std::optional<ItemData>
+{
+    return load_row(Widget::api_.Blockchain().LoadTransactionBitcoin(txid));
+}
+
+auto BlockchainAccountActivity::load_row(
+    std::unique_ptr<const Transaction> pTX) const noexcept
+    -> std::optional<ItemData>
+{
+    if (false == bool(pTX)) { return std::nullopt; }
+
+    const auto& tx = *pTX;
+
+    if (false == contains(tx.Chains(), chain_)) { return std::nullopt; }
+
+    const auto rowID = row_id(tx.ID());
+    const auto sortKey{tx.Timestamp()};
+    auto custom = CustomData{
+        new proto::PaymentWorkflow(),
+        new proto::PaymentEvent(),
+        const_cast<void*>(static_cast<const void*>(pTX.release())),
+        new blockchain::Type{chain_},
+        new std::string{Widget::api_.Blockchain().ActivityDescription(
+            primary_id_, chain_, tx)},
+        new OTData{tx.ID()}};
+
+    return ItemData{rowID, sortKey, std::move(custom)};
+}
+
 auto BlockchainAccountActivity::pipeline(const Message& in) noexcept -> void
 {
     if (false == running_.get()) { return; }
@@ -318,29 +434,33 @@ auto BlockchainAccountActivity::process_txid(const Message& in) noexcept -> void
 auto BlockchainAccountActivity::process_txid(const Data& txid) noexcept
     -> std::optional<AccountActivityRowID>
 {
-    const auto rowID = AccountActivityRowID{
-        blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
-        proto::PAYMENTEVENTTYPE_COMPLETE};
     auto pTX = Widget::api_.Blockchain().LoadTransactionBitcoin(txid);
 
     if (false == bool(pTX)) { return std::nullopt; }
 
-    const auto& tx = *pTX;
+    {
+        Lock lock(pending_lock_);
+        const auto time = pTX->Timestamp();
+        const auto defer = oldest_loaded_.has_value() &&
+                           (time < oldest_loaded_.value()) &&
+                           (false == find_index(row_id(txid)).has_value()) &&
+                           contains(pTX->Chains(), chain_);
 
-    if (false == contains(tx.Chains(), chain_)) { return std::nullopt; }
+        if (defer) {
+            pending_.emplace(time, txid);
 
-    const auto sortKey{tx.Timestamp()};
-    auto custom = CustomData{
-        new proto::PaymentWorkflow(),
-        new proto::PaymentEvent(),
-        const_cast<void*>(static_cast<const void*>(pTX.release())),
-        new blockchain::Type{chain_},
-        new std::string{Widget::api_.Blockchain().ActivityDescription(
-            primary_id_, chain_, tx)},
-        new OTData{tx.ID()}};
+            return std::nullopt;
+        }
+    }
+
+    auto item = load_row(std::move(pTX));
+
+    if (false == item.has_value()) { return std::nullopt; }
+
+    auto& [rowID, sortKey, custom] = item.value();
     add_item(rowID, sortKey, custom);
 
-    return std::move(rowID);
+    return rowID;
 }
 
 auto BlockchainAccountActivity::Send(
@@ -413,6 +533,14 @@ auto BlockchainAccountActivity::Send(
     }
 }
 
+auto BlockchainAccountActivity::row_id(const Data& txid) const noexcept
+    -> AccountActivityRowID
+{
+    return {
+        blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
+        proto::PAYMENTEVENTTYPE_COMPLETE};
+}
+
 auto BlockchainAccountActivity::SetSyncCallback(const SyncCallback cb) noexcept
     -> void
 {
@@ -422,6 +550,13 @@ auto BlockchainAccountActivity::SetSyncCallback(const SyncCallback cb) noexcept
 
 auto BlockchainAccountActivity::startup() noexcept -> void { load_thread(); }
 
+auto BlockchainAccountActivity::unloaded() const noexcept -> std::size_t
+{
+    Lock lock(pending_lock_);
+
+    return pending_.size();
+}
+
 auto BlockchainAccountActivity::ValidateAddress(
     const std::string& in) const noexcept -> bool
 {
@@ -457,6 +592,7 @@ auto BlockchainAccountActivity::ValidateAmount(
 
 BlockchainAccountActivity::~BlockchainAccountActivity()
 {
+    fetch_.Stop();
     wait_for_startup();
     stop_worker().get();
 }
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
@@ -27,6 +29,7 @@
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/contact/ContactItemType.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/contract/UnitDefinition.hpp"
 #include "opentxs/core/identifier/Server.hpp"
@@ -58,6 +61,17 @@ struct Manager;
 }  // namespace client
 }  // namespace api
 
+namespace blockchain
+{
+namespace block
+{
+namespace bitcoin
+{
+class Transaction;
+}  // namespace bitcoin
+}  // namespace block
+}  // namespace blockchain
+
 namespace identifier
 {
 class Nym;
@@ -82,7 +96,6 @@ class PaymentEvent;
 class PaymentWorkflow;
 }  // namespace proto
 
-class Data;
 class Identifier;
 }  // namespace opentxs
 
@@ -205,6 +218,9 @@ private:
         std::pair<int, int> ratio_{};
     };
 
+    using Pending = std::set<std::pair<AccountActivitySortKey, OTData>>;
+    using Transaction = blockchain::block::bitcoin::Transaction;
+
     enum class Work : OTZMQWorkType {
         shutdown = value(WorkType::Shutdown),
         contact = value(WorkType::ContactUpdated),
@@ -221,7 +237,18 @@ private:
     OTZMQDealerSocket balance_socket_;
     Progress progress_;
     SyncCB sync_cb_;
+    // Transactions older than the loaded window, guarded by pending_lock_
+    Pending pending_;
+
+    auto index() const noexcept -> Pending;
+    auto load_row(const Data& txid) const noexcept -> std::optional<ItemData>;
+    auto load_row(std::unique_ptr<const Transaction> pTX) const noexcept
+        -> std::optional<ItemData>;
+    auto row_id(const Data& txid) const noexcept -> AccountActivityRowID;
+    auto unloaded() const noexcept -> std::size_t final;
 
+    auto load_page(const std::size_t count) noexcept
+        -> std::vector<ItemData> final;
     auto load_thread() noexcept -> void;
     auto pipeline(const Message& in) noexcept -> void final;
     auto process_balance(const Message& message) noexcept -> void;
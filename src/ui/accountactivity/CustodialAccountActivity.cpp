@@ -11,9 +11,12 @@
 #include <atomic>
 #include <chrono>
 #include <future>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "internal/api/client/Client.hpp"
@@ -69,6 +72,7 @@ CustodialAccountActivity::CustodialAccountActivity(
     const SimpleCallback& cb) noexcept
     : AccountActivity(api, nymID, accountID, AccountType::Custodial, cb, {})
     , alias_()
+    , pending_()
 {
     init({
         api.Endpoints().AccountUpdate(),
@@ -501,9 +505,65 @@ auto CustodialAccountActivity::process_notary(const Message& message) noexcept
     }
 }
 
+auto CustodialAccountActivity::load_page(const std::size_t count) noexcept
+    -> std::vector<ItemData>
+{
+    auto rows = PendingRows{};
+
+    {
+        Lock lock(pending_lock_);
+
+        while ((rows.size() < count) && (false == pending_.empty())) {
+            auto it = std::prev(pending_.end());
+            oldest_loaded_ = it->first;
+            rows.emplace(*it);
+            pending_.erase(it);
+        }
+    }
+
+    return load_rows(rows);
+}
+
+auto CustodialAccountActivity::load_rows(const PendingRows& rows)
+    const noexcept -> std::vector<ItemData>
+{
+    auto output = std::vector<ItemData>{};
+    auto workflows = std::map<OTIdentifier, proto::PaymentWorkflow>{};
+    output.reserve(rows.size());
+
+    for (const auto& [time, id] : rows) {
+        const auto& [workflowID, type] = id;
+        auto it = workflows.find(workflowID);
+
+        if (workflows.end() == it) {
+            auto workflow = proto::PaymentWorkflow{};
+            Widget::api_.Workflow().LoadWorkflow(
+                primary_id_, workflowID, workflow);
+            it = workflows.emplace(workflowID, std::move(workflow)).first;
+        }
+
+        const auto& workflow = it->second;
+
+        // The workflow may have changed since it was indexed
+        for (const auto& [eventType, row] : extract_rows(workflow)) {
+            if (eventType != type) { continue; }
+
+            const auto& [eventTime, event_p] = row;
+            output.emplace_back(
+                id,
+                eventTime,
+                CustomData{
+                    new proto::PaymentWorkflow(workflow),
+                    new proto::PaymentEvent(*event_p)});
+        }
+    }
+
+    return output;
+}
+
 auto CustodialAccountActivity::process_workflow(
     const Identifier& workflowID,
-    std::set<AccountActivityRowID>& active) noexcept -> void
+    PendingRows& rows) noexcept -> void
 {
     const auto workflow = [&] {
         auto out = proto::PaymentWorkflow{};
@@ -511,16 +571,11 @@ auto CustodialAccountActivity::process_workflow(
 
         return out;
     }();
-    const auto rows = extract_rows(workflow);
-
-    for (const auto& [type, row] : rows) {
-        const auto& [time, event_p] = row;
-        auto key = AccountActivityRowID{Identifier::Factory(workflowID), type};
-        auto custom = CustomData{
-            new proto::PaymentWorkflow(workflow),
-            new proto::PaymentEvent(*event_p)};
-        add_item(key, time, custom);
-        active.emplace(std::move(key));
+
+    for (const auto& [type, row] : extract_rows(workflow)) {
+        rows.emplace(
+            row.first,
+            AccountActivityRowID{Identifier::Factory(workflowID), type});
     }
 }
 
@@ -578,9 +633,44 @@ auto CustodialAccountActivity::startup() noexcept -> void
 
     const auto workflows =
         Widget::api_.Workflow().WorkflowsByAccount(primary_id_, account_id_);
+    auto rows = PendingRows{};
+
+    // Workflows must be read to learn the timestamps of their events. Only
+    // the index is kept for rows outside the loaded window.
+    for (const auto& id : workflows) { process_workflow(id, rows); }
+
     auto active = std::set<AccountActivityRowID>{};
+    auto load = PendingRows{};
+
+    {
+        Lock lock(pending_lock_);
+        const auto boundary = page_boundary(lock, [&] {
+            auto out = std::vector<AccountActivitySortKey>{};
+            out.reserve(rows.size());
+
+            for (const auto& [time, id] : rows) { out.emplace_back(time); }
+
+            return out;
+        }());
+        pending_.clear();
+
+        for (const auto& entry : rows) {
+            const auto& [time, id] = entry;
+            active.emplace(id);
+            const auto defer =
+                (time < boundary) && (false == find_index(id).has_value());
+
+            if (defer) {
+                pending_.emplace(entry);
+            } else {
+                load.emplace(entry);
+            }
+        }
+    }
 
-    for (const auto& id : workflows) { process_workflow(id, active); }
+    for (auto& [id, time, custom] : load_rows(load)) {
+        add_item(id, time, custom);
+    }
 
     delete_inactive(active);
 
@@ -590,6 +680,13 @@ auto CustodialAccountActivity::startup() noexcept -> void
     }
 }
 
+auto CustodialAccountActivity::unloaded() const noexcept -> std::size_t
+{
+    Lock lock(pending_lock_);
+
+    return pending_.size();
+}
+
 auto CustodialAccountActivity::Unit() const noexcept -> contact::ContactItemType
 {
     sLock lock(shared_lock_);
@@ -599,6 +696,7 @@ auto CustodialAccountActivity::Unit() const noexcept -> contact::ContactItemType
 
 CustodialAccountActivity::~CustodialAccountActivity()
 {
+    fetch_.Stop();
     wait_for_startup();
     stop_worker().get();
 }
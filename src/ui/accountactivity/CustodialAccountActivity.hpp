@@ -6,6 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <map>
 #include <set>
 #include <string>
 #include <utility>
@@ -97,6 +99,9 @@ private:
         std::pair<AccountActivitySortKey, const proto::PaymentEvent*>;
     using RowKey = std::pair<proto::PaymentEventType, EventRow>;
 
+    using PendingRows =
+        std::multimap<AccountActivitySortKey, AccountActivityRowID>;
+
     enum class Work : OTZMQWorkType {
         notary = value(WorkType::NotaryUpdated),
         unit = value(WorkType::UnitDefinitionUpdated),
@@ -109,6 +114,8 @@ private:
     };
 
     std::string alias_;
+    // Rows older than the loaded window, guarded by pending_lock_
+    PendingRows pending_;
 
     static auto extract_event(
         const proto::PaymentEventType event,
@@ -116,13 +123,19 @@ private:
     static auto extract_rows(const proto::PaymentWorkflow& workflow) noexcept
         -> std::vector<RowKey>;
 
+    auto load_rows(const PendingRows& rows) const noexcept
+        -> std::vector<ItemData>;
+    auto unloaded() const noexcept -> std::size_t final;
+
+    auto load_page(const std::size_t count) noexcept
+        -> std::vector<ItemData> final;
     auto pipeline(const Message& in) noexcept -> void final;
     auto process_balance(const Message& message) noexcept -> void;
     auto process_contact(const Message& message) noexcept -> void;
     auto process_notary(const Message& message) noexcept -> void;
     auto process_workflow(
         const Identifier& workflowID,
-        std::set<AccountActivityRowID>& active) noexcept -> void;
+        PendingRows& rows) noexcept -> void;
     auto process_workflow(const Message& message) noexcept -> void;
     auto process_unit(const Message& message) noexcept -> void;
     auto startup() noexcept -> void final;
@@ -15,7 +15,6 @@
 #include <iterator>
 #include <map>
 #include <set>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -98,9 +97,7 @@ IssuerItem::IssuerItem(
 
     init();
     setup_listeners(listeners_);
-    startup_.reset(new std::thread(&IssuerItem::startup, this));
-
-    OT_ASSERT(startup_)
+    schedule_startup([this] { startup(); });
 }
 
 auto IssuerItem::Debug() const noexcept -> std::string
@@ -15,7 +15,6 @@
 #include <ostream>
 #include <set>
 #include <string>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -100,9 +99,7 @@ ActivitySummary::ActivitySummary(
 {
     init();
     setup_listeners(listeners_);
-    startup_.reset(new std::thread(&ActivitySummary::startup, this));
-
-    OT_ASSERT(startup_)
+    schedule_startup([this] { startup(); });
 }
 
 auto ActivitySummary::construct_row(
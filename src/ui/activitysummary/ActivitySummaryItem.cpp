@@ -15,7 +15,6 @@
 #include <memory>
 #include <mutex>
 #include <string>
-#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -32,9 +31,9 @@
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/core/UniqueQueue.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
+#include "ui/base/Executor.hpp"
 #include "ui/base/Widget.hpp"
 
-#define GET_TEXT_MILLISECONDS 10
 
 #define OT_METHOD "opentxs::ui::implementation::ActivitySummaryItem::"
 
@@ -83,16 +82,12 @@ ActivitySummaryItem::ActivitySummaryItem(
     , text_(text)
     , type_(extract_custom<StorageBox>(custom, 1))
     , time_(extract_custom<Time>(custom, 3))
-    , newest_item_thread_(nullptr)
     , newest_item_()
     , next_task_id_(0)
-    , break_(false)
+    , text_task_()
 {
     startup(custom);
-    newest_item_thread_.reset(
-        new std::thread(&ActivitySummaryItem::get_text, this));
-
-    OT_ASSERT(newest_item_thread_)
+    text_task_ = Executor::Get().Schedule([this] { get_text(); });
 }
 
 auto ActivitySummaryItem::DisplayName() const noexcept -> std::string
@@ -152,25 +147,21 @@ auto ActivitySummaryItem::find_text(
 
 void ActivitySummaryItem::get_text() noexcept
 {
-    auto reason = api_.Factory().PasswordPrompt(__FUNCTION__);
-    eLock lock(shared_lock_, std::defer_lock);
     auto locator = ItemLocator{"", {}, "", api_.Factory().Identifier()};
+    auto found{false};
+    int taskID{0};
 
-    while (running_) {
-        if (break_.load()) { return; }
+    // Only the most recent item determines the displayed text
+    while (newest_item_.Pop(taskID, locator)) { found = true; }
 
-        int taskID{0};
-
-        if (newest_item_.Pop(taskID, locator)) {
-            const auto text = find_text(reason, locator);
-            lock.lock();
-            text_ = text;
-            lock.unlock();
-            UpdateNotify();
-        }
+    if ((false == found) || (false == running_)) { return; }
 
-        Sleep(std::chrono::milliseconds(GET_TEXT_MILLISECONDS));
-    }
+    auto reason = api_.Factory().PasswordPrompt(__FUNCTION__);
+    const auto text = find_text(reason, locator);
+    eLock lock(shared_lock_);
+    text_ = text;
+    lock.unlock();
+    UpdateNotify();
 }
 
 auto ActivitySummaryItem::ImageURI() const noexcept -> std::string
@@ -199,6 +190,8 @@ auto ActivitySummaryItem::LoadItemText(
 #if OT_QT
 QVariant ActivitySummaryItem::qt_data(const int column, int role) const noexcept
 {
+    text_task_.Prioritize(Executor::Priority::Visible);
+
     switch (column) {
         case 0: {
             return ThreadID().c_str();
@@ -247,6 +240,7 @@ void ActivitySummaryItem::startup(CustomData& custom) noexcept
         extract_custom<std::string>(custom, 2),
         extract_custom<OTIdentifier>(custom, 4)};
     newest_item_.Push(++next_task_id_, std::move(locator));
+    text_task_.Trigger(Executor::Priority::Normal);
 }
 
 auto ActivitySummaryItem::Text() const noexcept -> std::string
@@ -275,13 +269,5 @@ auto ActivitySummaryItem::Type() const noexcept -> StorageBox
     return type_;
 }
 
-ActivitySummaryItem::~ActivitySummaryItem()
-{
-    break_.store(true);
-
-    if (newest_item_thread_ && newest_item_thread_->joinable()) {
-        newest_item_thread_->join();
-        newest_item_thread_.reset();
-    }
-}
+ActivitySummaryItem::~ActivitySummaryItem() { text_task_.Stop(); }
 }  // namespace opentxs::ui::implementation
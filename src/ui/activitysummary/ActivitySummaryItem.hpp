@@ -12,7 +12,6 @@
 #include <chrono>
 #include <memory>
 #include <string>
-#include <thread>
 #include <tuple>
 
 #include "1_Internal.hpp"
@@ -24,6 +23,7 @@
 #include "opentxs/core/UniqueQueue.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/ui/ActivitySummaryItem.hpp"
+#include "ui/base/Executor.hpp"
 #include "ui/base/Row.hpp"
 
 namespace opentxs
@@ -119,10 +119,9 @@ private:
     std::string text_;
     StorageBox type_;
     Time time_;
-    std::unique_ptr<std::thread> newest_item_thread_;
     UniqueQueue<ItemLocator> newest_item_;
     std::atomic<int> next_task_id_;
-    std::atomic<bool> break_;
+    mutable Executor::Task text_task_;
 
     auto find_text(const PasswordPrompt& reason, const ItemLocator& locator)
         const noexcept -> std::string;
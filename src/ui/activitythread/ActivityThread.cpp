@@ -12,11 +12,12 @@
 #endif  // OT_QT
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <ostream>
 #include <set>
-#include <thread>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "Proto.hpp"
@@ -129,6 +130,18 @@ QString ActivityThreadQt::threadID() const noexcept
 
 namespace opentxs::ui::implementation
 {
+namespace
+{
+/// Sort thread items oldest first
+auto sort_items(std::vector<proto::StorageThreadItem>& items) noexcept -> void
+{
+    std::sort(items.begin(), items.end(), [](const auto& lhs, const auto& rhs) {
+        return std::make_pair(lhs.time(), lhs.index()) <
+               std::make_pair(rhs.time(), rhs.index());
+    });
+}
+}  // namespace
+
 ActivityThread::ActivityThread(
     const api::client::internal::Manager& api,
     const identifier::Nym& nymID,
@@ -158,17 +171,16 @@ ActivityThread::ActivityThread(
     , draft_()
     , draft_tasks_()
     , contact_(nullptr)
-    , contact_thread_(nullptr)
+    , pending_lock_()
+    , pending_()
+    , oldest_loaded_()
 {
     init();
     setup_listeners(listeners_);
-    startup_.reset(new std::thread(&ActivityThread::startup, this));
-
-    OT_ASSERT(startup_)
-
-    contact_thread_.reset(new std::thread(&ActivityThread::init_contact, this));
-
-    OT_ASSERT(contact_thread_)
+    schedule_startup([this] {
+        startup();
+        init_contact();
+    });
 }
 
 void ActivityThread::can_message() const noexcept
@@ -296,6 +308,52 @@ void ActivityThread::init_contact() noexcept
     UpdateNotify();
 }
 
+auto ActivityThread::item_data(const proto::StorageThreadItem& item)
+    const noexcept -> ItemData
+{
+    auto output = ItemData{
+        ActivityThreadRowID{
+            api_.Factory().Identifier(item.id()),
+            static_cast<StorageBox>(item.box()),
+            api_.Factory().Identifier(item.account())},
+        ActivityThreadSortKey{std::chrono::seconds(item.time()), item.index()},
+        CustomData{new std::string}};
+    auto& custom = std::get<2>(output);
+
+    switch (std::get<1>(std::get<0>(output))) {
+        case StorageBox::BLOCKCHAIN: {
+            auto txid = api_.Factory().Data(item.txid(), StringStyle::Raw);
+            const auto chain = static_cast<blockchain::Type>(item.chain());
+            custom.emplace_back(new blockchain::Type{chain});
+            custom.emplace_back(new OTData{std::move(txid)});
+        } break;
+        default: {
+        }
+    }
+
+    return output;
+}
+
+auto ActivityThread::load_page(const std::size_t count) noexcept
+    -> std::vector<ItemData>
+{
+    auto output = std::vector<ItemData>{};
+    Lock lock(pending_lock_);
+    const auto page = std::min(count, pending_.size());
+    output.reserve(page);
+
+    for (auto i = std::size_t{0}; i < page; ++i) {
+        output.emplace_back(item_data(pending_.back()));
+        pending_.pop_back();
+    }
+
+    if (false == output.empty()) {
+        oldest_loaded_ = std::get<1>(output.back());
+    }
+
+    return output;
+}
+
 void ActivityThread::load_thread(const proto::StorageThread& thread) noexcept
 {
     for (const auto& id : thread.participant()) {
@@ -307,8 +365,18 @@ void ActivityThread::load_thread(const proto::StorageThread& thread) noexcept
         " items.")
         .Flush();
 
-    for (const auto& item : thread.item()) { process_item(item); }
+    {
+        Lock lock(pending_lock_);
+        pending_.assign(thread.item().begin(), thread.item().end());
+        sort_items(pending_);
+    }
 
+    // The serialized thread is an index of item metadata and is always read in
+    // full. Only the rows for the most recent page, which load message and
+    // payment contents, are constructed here. Older rows are constructed on
+    // demand via FetchMore()
+    auto items = load_page(page_size_);
+    update_items(items);
     finish_startup();
 }
 
@@ -440,34 +508,6 @@ auto ActivityThread::process_drafts() noexcept -> bool
     return false;
 }
 
-auto ActivityThread::process_item(const proto::StorageThreadItem& item) noexcept
-    -> ActivityThreadRowID
-{
-    const auto id = ActivityThreadRowID{
-        api_.Factory().Identifier(item.id()),
-        static_cast<StorageBox>(item.box()),
-        api_.Factory().Identifier(item.account())};
-    auto& [itemID, box, account] = id;
-    const auto key =
-        ActivityThreadSortKey{std::chrono::seconds(item.time()), item.index()};
-    auto custom = CustomData{new std::string};
-
-    switch (box) {
-        case StorageBox::BLOCKCHAIN: {
-            auto txid = api_.Factory().Data(item.txid(), StringStyle::Raw);
-            const auto chain = static_cast<blockchain::Type>(item.chain());
-            custom.emplace_back(new blockchain::Type{chain});
-            custom.emplace_back(new OTData{std::move(txid)});
-        } break;
-        default: {
-        }
-    }
-
-    add_item(id, key, custom);
-
-    return id;
-}
-
 void ActivityThread::process_thread(const Message& message) noexcept
 {
     wait_for_startup();
@@ -493,12 +533,35 @@ void ActivityThread::process_thread(const Message& message) noexcept
     OT_ASSERT(loaded)
 
     std::set<ActivityThreadRowID> active{};
+    auto items = std::vector<ItemData>{};
+
+    {
+        Lock lock(pending_lock_);
+        pending_.clear();
+
+        for (const auto& item : thread.item()) {
+            const auto& id = *active.emplace(
+                api_.Factory().Identifier(item.id()),
+                static_cast<StorageBox>(item.box()),
+                api_.Factory().Identifier(item.account())).first;
+            const auto key = ActivityThreadSortKey{
+                std::chrono::seconds(item.time()), item.index()};
+            const auto older = oldest_loaded_.has_value() &&
+                               (key < oldest_loaded_.value()) &&
+                               (false == find_index(id).has_value());
+
+            if (older) {
+                pending_.emplace_back(item);
+            } else {
+                items.emplace_back(item_data(item));
+            }
+        }
 
-    for (const auto& item : thread.item()) {
-        const auto itemID = process_item(item);
-        active.emplace(itemID);
+        sort_items(pending_);
     }
 
+    for (auto& [id, key, custom] : items) { add_item(id, key, custom); }
+
     Lock draftLock(decision_lock_);
 
     for (const auto& [id, task] : draft_tasks_) { active.emplace(id); }
@@ -655,6 +718,13 @@ auto ActivityThread::ThreadID() const noexcept -> std::string
     return threadID_->str();
 }
 
+auto ActivityThread::unloaded() const noexcept -> std::size_t
+{
+    Lock lock(pending_lock_);
+
+    return pending_.size();
+}
+
 auto ActivityThread::validate_account(
     const Identifier& sourceAccount) const noexcept -> bool
 {
@@ -683,11 +753,9 @@ ActivityThread::~ActivityThread()
 {
     Stop();
 
-    for (auto& it : listeners_) { delete it.second; }
+    fetch_.Stop();
+    startup_.Stop();
 
-    if (contact_thread_ && contact_thread_->joinable()) {
-        contact_thread_->join();
-        contact_thread_.reset();
-    }
+    for (auto& it : listeners_) { delete it.second; }
 }
 }  // namespace opentxs::ui::implementation
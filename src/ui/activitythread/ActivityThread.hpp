@@ -12,9 +12,9 @@
 #include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <string>
-#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -174,7 +174,10 @@ private:
     mutable std::string draft_;
     mutable std::vector<DraftTask> draft_tasks_;
     std::shared_ptr<const opentxs::Contact> contact_;
-    std::unique_ptr<std::thread> contact_thread_;
+    mutable std::mutex pending_lock_;
+    // Items older than the loaded window, sorted oldest first
+    std::vector<proto::StorageThreadItem> pending_;
+    std::optional<ActivityThreadSortKey> oldest_loaded_;
 
     auto comma(const std::set<std::string>& list) const noexcept -> std::string;
     void can_message() const noexcept;
@@ -182,18 +185,21 @@ private:
         const ActivityThreadRowID& id,
         const ActivityThreadSortKey& index,
         CustomData& custom) const noexcept -> RowPointer final;
+    auto item_data(const proto::StorageThreadItem& item) const noexcept
+        -> ItemData;
     auto send_cheque(
         const Amount amount,
         const Identifier& sourceAccount,
         const std::string& memo) const noexcept -> bool;
+    auto unloaded() const noexcept -> std::size_t final;
     auto validate_account(const Identifier& sourceAccount) const noexcept
         -> bool;
 
     void init_contact() noexcept;
+    auto load_page(const std::size_t count) noexcept
+        -> std::vector<ItemData> final;
     void load_thread(const proto::StorageThread& thread) noexcept;
     void new_thread() noexcept;
-    auto process_item(const proto::StorageThreadItem& item) noexcept
-        -> ActivityThreadRowID;
     auto process_drafts() noexcept -> bool;
     void process_thread(const Message& message) noexcept;
     void startup() noexcept;
@@ -22,6 +22,7 @@
 #if OT_QT
 #include "opentxs/ui/qt/ActivityThread.hpp"
 #endif  // OT_QT
+#include "ui/base/Executor.hpp"
 #include "ui/base/Widget.hpp"
 #if OT_QT
 #include "util/Polarity.hpp"  // IWYU pragma: keep
@@ -47,6 +48,7 @@ ActivityThreadItem::ActivityThreadItem(
     , text_(extract_custom<std::string>(custom))
     , loading_(Flag::Factory(loading))
     , pending_(Flag::Factory(pending))
+    , load_()
 {
 }
 
@@ -59,6 +61,8 @@ auto ActivityThreadItem::MarkRead() const noexcept -> bool
 #if OT_QT
 QVariant ActivityThreadItem::qt_data(const int column, int role) const noexcept
 {
+    load_.Prioritize(Executor::Priority::Visible);
+
     switch (role) {
         case Qt::DisplayRole: {
             switch (column) {
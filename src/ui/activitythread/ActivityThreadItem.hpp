@@ -18,6 +18,7 @@
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/ui/ActivityThreadItem.hpp"
+#include "ui/base/Executor.hpp"
 #include "ui/base/Row.hpp"
 
 namespace opentxs
@@ -96,6 +97,8 @@ protected:
     std::string text_;
     OTFlag loading_;
     OTFlag pending_;
+    /// Child classes must stop this task in their destructors
+    mutable Executor::Task load_;
 
     ActivityThreadItem(
         const ActivityThreadInternalInterface& parent,
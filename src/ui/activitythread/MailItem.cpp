@@ -9,7 +9,6 @@
 
 #include <memory>
 #include <string>
-#include <thread>
 
 #include "internal/api/client/Client.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -21,6 +20,7 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "ui/activitythread/ActivityThreadItem.hpp"
+#include "ui/base/Executor.hpp"
 
 namespace opentxs::factory
 {
@@ -77,7 +77,6 @@ MailItem::MailItem(
           custom,
           loading,
           pending)
-    , load_(nullptr)
 {
     OT_ASSERT(false == nym_id_.empty());
     OT_ASSERT(false == item_id_.empty())
@@ -95,7 +94,7 @@ MailItem::MailItem(
     switch (box_) {
         case StorageBox::MAILINBOX:
         case StorageBox::MAILOUTBOX: {
-            load_.reset(new std::thread(&MailItem::load, this));
+            load_ = Executor::Get().Schedule([this] { load(); });
         } break;
         case StorageBox::SENTPEERREQUEST:
         case StorageBox::INCOMINGPEERREQUEST:
@@ -113,8 +112,6 @@ MailItem::MailItem(
         default: {
         }
     }
-
-    OT_ASSERT(load_)
 }
 
 void MailItem::load() noexcept
@@ -157,6 +154,6 @@ void MailItem::load() noexcept
 
 MailItem::~MailItem()
 {
-    if (load_ && load_->joinable()) { load_->join(); }
+    load_.Stop();
 }
 }  // namespace opentxs::ui::implementation
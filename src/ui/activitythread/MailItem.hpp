@@ -6,7 +6,6 @@
 #pragma once
 
 #include <memory>
-#include <thread>
 
 #include "1_Internal.hpp"
 #include "internal/ui/UI.hpp"
@@ -66,8 +65,6 @@ public:
     ~MailItem() final;
 
 private:
-    std::unique_ptr<std::thread> load_;
-
     void load() noexcept;
 
     MailItem() = delete;
@@ -8,7 +8,6 @@
 #include "ui/activitythread/PaymentItem.hpp"  // IWYU pragma: associated
 
 #include <memory>
-#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -27,6 +26,7 @@
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/ext/OTPayment.hpp"
 #include "ui/activitythread/ActivityThreadItem.hpp"
+#include "ui/base/Executor.hpp"
 
 #define OT_METHOD "opentxs::ui::implementation::PaymentItem::"
 
@@ -69,7 +69,6 @@ PaymentItem::PaymentItem(
     , display_amount_()
     , memo_()
     , amount_(0)
-    , load_(nullptr)
     , payment_()
 {
     OT_ASSERT(false == nym_id_.empty())
@@ -78,7 +77,7 @@ PaymentItem::PaymentItem(
     switch (box_) {
         case StorageBox::INCOMINGCHEQUE:
         case StorageBox::OUTGOINGCHEQUE: {
-            load_.reset(new std::thread(&PaymentItem::load, this));
+            load_ = Executor::Get().Schedule([this] { load(); });
         } break;
         case StorageBox::SENTPEERREQUEST:
         case StorageBox::INCOMINGPEERREQUEST:
@@ -96,8 +95,6 @@ PaymentItem::PaymentItem(
         default: {
         }
     }
-
-    OT_ASSERT(load_)
 }
 
 auto PaymentItem::Amount() const noexcept -> opentxs::Amount
@@ -232,6 +229,6 @@ auto PaymentItem::Memo() const noexcept -> std::string
 
 PaymentItem::~PaymentItem()
 {
-    if (load_ && load_->joinable()) { load_->join(); }
+    load_.Stop();
 }
 }  // namespace opentxs::ui::implementation
@@ -7,7 +7,6 @@
 
 #include <memory>
 #include <string>
-#include <thread>
 
 #include "1_Internal.hpp"
 #include "internal/ui/UI.hpp"
@@ -69,7 +68,6 @@ private:
     std::string display_amount_;
     std::string memo_;
     opentxs::Amount amount_;
-    std::unique_ptr<std::thread> load_;
     std::shared_ptr<const OTPayment> payment_;
 
     void load() noexcept;
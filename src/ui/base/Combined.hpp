@@ -34,6 +34,10 @@ public:
     {
         this->parent_.emit_begin_remove_rows(parent, first, last);
     }
+    auto emit_begin_reset_model() const noexcept -> void final
+    {
+        this->parent_.emit_begin_reset_model();
+    }
     auto emit_end_insert_rows() const noexcept -> void final
     {
         this->parent_.emit_end_insert_rows();
@@ -46,6 +50,10 @@ public:
     {
         this->parent_.emit_end_remove_rows();
     }
+    auto emit_end_reset_model() const noexcept -> void final
+    {
+        this->parent_.emit_end_reset_model();
+    }
     auto me() const noexcept -> QModelIndex final
     {
         sLock lock(this->shared_lock_);
@@ -0,0 +1,344 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"           // IWYU pragma: associated
+#include "1_Internal.hpp"         // IWYU pragma: associated
+#include "ui/base/Executor.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <utility>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::ui::implementation
+{
+namespace
+{
+constexpr auto minimum_workers_ = 2u;
+
+auto queue_index(const Executor::Priority priority) noexcept -> std::size_t
+{
+    return static_cast<std::size_t>(priority);
+}
+}  // namespace
+
+struct Executor::Task::State {
+    enum class Status : std::uint8_t {
+        idle,
+        queued,
+        running,
+        stopped,
+    };
+
+    Executor& parent_;
+    const bool blocking_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    Job job_;
+    Status status_;
+    Priority priority_;
+    bool again_;
+    std::thread::id runner_;
+
+    State(
+        Executor& parent,
+        Job&& job,
+        const Priority priority,
+        const bool blocking) noexcept
+        : parent_(parent)
+        , blocking_(blocking)
+        , lock_()
+        , cv_()
+        , job_(std::move(job))
+        , status_(Status::idle)
+        , priority_(priority)
+        , again_(false)
+        , runner_()
+    {
+    }
+};
+
+Executor::Task::Task(std::shared_ptr<State> state) noexcept
+    : state_(std::move(state))
+{
+}
+
+Executor::Task::Task() noexcept
+    : Task(std::shared_ptr<State>{})
+{
+}
+
+Executor::Task::Task(const Task&) noexcept = default;
+
+Executor::Task::Task(Task&&) noexcept = default;
+
+auto Executor::Task::operator=(const Task&) noexcept -> Task& = default;
+
+auto Executor::Task::operator=(Task&&) noexcept -> Task& = default;
+
+auto Executor::Task::Prioritize(const Priority priority) noexcept -> void
+{
+    if (false == bool(state_)) { return; }
+
+    auto& state = *state_;
+    Lock lock(state.lock_);
+
+    if (State::Status::queued != state.status_) { return; }
+
+    if (queue_index(priority) >= queue_index(state.priority_)) { return; }
+
+    // The entry in the lower priority queue is skipped when it is reached
+    state.priority_ = priority;
+    state.parent_.enqueue(state_, priority);
+}
+
+auto Executor::Task::Stop() noexcept -> void
+{
+    if (false == bool(state_)) { return; }
+
+    auto& state = *state_;
+    Lock lock(state.lock_);
+    state.again_ = false;
+
+    if (State::Status::running == state.status_) {
+        if (std::this_thread::get_id() == state.runner_) {
+            state.status_ = State::Status::stopped;
+
+            return;
+        }
+
+        state.cv_.wait(
+            lock, [&] { return State::Status::running != state.status_; });
+    }
+
+    state.status_ = State::Status::stopped;
+    state.job_ = {};
+}
+
+auto Executor::Task::Trigger(const Priority priority) noexcept -> void
+{
+    if (false == bool(state_)) { return; }
+
+    auto& state = *state_;
+    Lock lock(state.lock_);
+
+    switch (state.status_) {
+        case State::Status::idle: {
+            state.status_ = State::Status::queued;
+            state.priority_ = priority;
+            state.parent_.enqueue(state_, priority);
+        } break;
+        case State::Status::queued: {
+            lock.unlock();
+            Prioritize(priority);
+        } break;
+        case State::Status::running: {
+            state.again_ = true;
+            state.priority_ = std::min(state.priority_, priority);
+        } break;
+        case State::Status::stopped:
+        default: {
+        }
+    }
+}
+
+Executor::Task::~Task() = default;
+
+Executor::Executor() noexcept
+    : running_(true)
+    , lock_()
+    , cv_()
+    , queues_()
+    , workers_()
+    , blocked_(0)
+    , spare_(0)
+{
+    const auto count =
+        std::max(minimum_workers_, std::thread::hardware_concurrency());
+    workers_.reserve(count);
+
+    for (auto i = 0u; i < count; ++i) {
+        workers_.emplace_back(&Executor::work, this);
+    }
+}
+
+auto Executor::enqueue(StatePointer state, const Priority priority) noexcept
+    -> void
+{
+    {
+        Lock lock(lock_);
+        queues_[queue_index(priority)].emplace_back(std::move(state));
+    }
+
+    cv_.notify_one();
+}
+
+auto Executor::Get() noexcept -> Executor&
+{
+    static auto executor = Executor{};
+
+    return executor;
+}
+
+auto Executor::next(const bool spare) noexcept -> StatePointer
+{
+    Lock lock(lock_);
+    // A spare thread is surplus once there are more spares than blocked jobs
+    cv_.wait(lock, [&] {
+        return (false == running_) || (spare && (spare_ > blocked_)) ||
+               std::any_of(queues_.begin(), queues_.end(), [](const auto& q) {
+                   return false == q.empty();
+               });
+    });
+
+    if (running_) {
+        for (auto& queue : queues_) {
+            if (queue.empty()) { continue; }
+
+            auto output = std::move(queue.front());
+            queue.pop_front();
+
+            return output;
+        }
+    }
+
+    if (spare) {
+        // The destructor may be waiting for the last spare to exit, so the
+        // notification must be sent before the lock is released
+        --spare_;
+        cv_.notify_all();
+    }
+
+    return {};
+}
+
+auto Executor::run(const StatePointer& pointer) noexcept -> void
+{
+    using Status = Task::State::Status;
+    auto& state = *pointer;
+
+    {
+        Lock lock(state.lock_);
+
+        // Stale entries remain in lower priority queues after a promotion
+        if (Status::queued != state.status_) { return; }
+
+        state.status_ = Status::running;
+        state.runner_ = std::this_thread::get_id();
+    }
+
+    auto blocked{false};
+
+    if (state.blocking_) {
+        Lock lock(lock_);
+
+        if (running_) {
+            blocked = true;
+            ++blocked_;
+
+            if ((spare_ < blocked_) && (spare_ < MaximumSpares)) {
+                ++spare_;
+                std::thread{&Executor::spare, this}.detach();
+            }
+        }
+    }
+
+    state.job_();
+
+    if (blocked) {
+        Lock lock(lock_);
+        --blocked_;
+
+        // Wake spare threads so a surplus spare can exit
+        cv_.notify_all();
+    }
+
+    Lock lock(state.lock_);
+    state.runner_ = {};
+
+    if (Status::stopped == state.status_) {
+        state.job_ = {};
+    } else if (state.again_) {
+        const auto priority = state.priority_;
+        state.again_ = false;
+        state.status_ = Status::queued;
+        lock.unlock();
+        state.cv_.notify_all();
+        enqueue(pointer, priority);
+
+        return;
+    } else {
+        state.status_ = Status::idle;
+    }
+
+    lock.unlock();
+    state.cv_.notify_all();
+}
+
+auto Executor::Prepare(Job&& job, const bool blocking) noexcept -> Task
+{
+    return std::make_shared<Task::State>(
+        *this, std::move(job), Priority::Normal, blocking);
+}
+
+auto Executor::Schedule(
+    Job&& job,
+    const Priority priority,
+    const bool blocking) noexcept -> Task
+{
+    auto output = Prepare(std::move(job), blocking);
+    output.Trigger(priority);
+
+    return output;
+}
+
+auto Executor::spare() noexcept -> void
+{
+    while (true) {
+        auto state = next(true);
+
+        if (false == bool(state)) { return; }
+
+        run(state);
+    }
+}
+
+auto Executor::work() noexcept -> void
+{
+    while (true) {
+        auto state = next(false);
+
+        if (false == bool(state)) { return; }
+
+        run(state);
+    }
+}
+
+auto Executor::Workers() const noexcept -> std::size_t
+{
+    Lock lock(lock_);
+
+    return workers_.size() + spare_;
+}
+
+Executor::~Executor()
+{
+    {
+        Lock lock(lock_);
+        running_ = false;
+    }
+
+    cv_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+
+    // Spare threads are detached and must be gone before the members they
+    // use are destroyed
+    Lock lock(lock_);
+    cv_.wait(lock, [&] { return 0u == spare_; });
+}
+}  // namespace opentxs::ui::implementation
@@ -0,0 +1,132 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "opentxs/Version.hpp"
+
+namespace opentxs::ui::implementation
+{
+/** Shared worker pool for background work performed by UI models
+ *
+ *  Widgets and rows schedule their loading work here instead of creating
+ *  threads of their own. Jobs are executed in priority order, and FIFO order
+ *  within a priority, so rows which are on screen can be moved ahead of rows
+ *  which are not.
+ *
+ *  Jobs which wait for other jobs to run must be scheduled as blocking jobs.
+ *  Each running blocking job is matched by a spare thread, up to
+ *  MaximumSpares, so it does not reduce the number of workers available to
+ *  other jobs. Spare threads exit once the blocking jobs which caused them to
+ *  be created have finished.
+ */
+class OPENTXS_EXPORT Executor
+{
+public:
+    enum class Priority : std::uint8_t {
+        Visible = 0,
+        Normal = 1,
+        Background = 2,
+    };
+
+    using Job = std::function<void()>;
+
+    /// Upper limit on the number of spare threads for blocking jobs
+    static constexpr auto MaximumSpares = std::size_t{8};
+
+    /** Handle to a scheduled job
+     *
+     *  A default constructed Task does not refer to any job and all of its
+     *  member functions are no-ops.
+     */
+    class Task
+    {
+    public:
+        /// Move a queued job to a higher priority
+        auto Prioritize(const Priority priority) noexcept -> void;
+        /** Prevent the job from running again
+         *
+         *  A queued job is cancelled. If the job is running then this
+         *  function blocks until it finishes unless it is called by the job
+         *  itself.
+         */
+        auto Stop() noexcept -> void;
+        /** Run the job again
+         *
+         *  Does nothing if the job is already queued. If the job is running
+         *  then it will be queued again once it finishes.
+         */
+        auto Trigger(const Priority priority) noexcept -> void;
+
+        Task() noexcept;
+        Task(const Task&) noexcept;
+        Task(Task&&) noexcept;
+        auto operator=(const Task&) noexcept -> Task&;
+        auto operator=(Task&&) noexcept -> Task&;
+
+        ~Task();
+
+    private:
+        friend Executor;
+
+        struct State;
+
+        std::shared_ptr<State> state_;
+
+        Task(std::shared_ptr<State> state) noexcept;
+    };
+
+    static auto Get() noexcept -> Executor&;
+
+    /// Create a task which does not run until it is triggered
+    auto Prepare(Job&& job, const bool blocking = false) noexcept -> Task;
+    auto Schedule(
+        Job&& job,
+        const Priority priority = Priority::Normal,
+        const bool blocking = false) noexcept -> Task;
+    /// Number of threads currently owned by the executor, including spares
+    auto Workers() const noexcept -> std::size_t;
+
+    ~Executor();
+
+private:
+    using StatePointer = std::shared_ptr<Task::State>;
+    using Queue = std::deque<StatePointer>;
+
+    static constexpr auto priorities_ = std::size_t{3};
+
+    std::atomic<bool> running_;
+    mutable std::mutex lock_;
+    std::condition_variable cv_;
+    std::array<Queue, priorities_> queues_;
+    std::vector<std::thread> workers_;
+    std::size_t blocked_;
+    std::size_t spare_;
+
+    auto enqueue(StatePointer state, const Priority priority) noexcept -> void;
+    auto next(const bool spare) noexcept -> StatePointer;
+    auto run(const StatePointer& pointer) noexcept -> void;
+    auto spare() noexcept -> void;
+    auto work() noexcept -> void;
+
+    Executor() noexcept;
+    Executor(const Executor&) = delete;
+    Executor(Executor&&) = delete;
+    auto operator=(const Executor&) -> Executor& = delete;
+    auto operator=(Executor&&) -> Executor& = delete;
+};
+}  // namespace opentxs::ui::implementation
@@ -6,25 +6,78 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <list>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <optional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace opentxs::ui::implementation
 {
+/** Ordered row storage for list models
+ *
+ *  Rows are held in an implicit treap which tracks subtree sizes, so locating
+ *  the insert position for a key, finding the index of a row, and fetching
+ *  the row at an index are all O(log n) operations. Iterators remain valid
+ *  until the row they refer to is deleted or moved.
+ */
 template <typename RowID, typename SortKey, typename RowPointer>
 class ListItems
 {
+private:
+    struct Node;
+
 public:
     struct Row {
         SortKey key_;
         RowID id_;
         RowPointer item_;
     };
-    using Data = std::list<Row>;
-    using Iterator = typename Data::iterator;
-    using Index = std::map<RowID, Iterator>;
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Row;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Row*;
+        using reference = Row&;
+
+        auto operator*() const noexcept -> Row& { return node_->row_; }
+        auto operator->() const noexcept -> Row* { return &node_->row_; }
+        auto operator++() noexcept -> Iterator&
+        {
+            node_ = ListItems::next(node_);
+
+            return *this;
+        }
+        auto operator==(const Iterator& rhs) const noexcept -> bool
+        {
+            return node_ == rhs.node_;
+        }
+        auto operator!=(const Iterator& rhs) const noexcept -> bool
+        {
+            return node_ != rhs.node_;
+        }
+
+        Iterator(Node* node = nullptr) noexcept
+            : node_(node)
+        {
+        }
+
+    private:
+        friend ListItems;
+
+        Node* node_;
+    };
+
+    using Index = std::map<RowID, std::unique_ptr<Node>>;
     using Position = std::pair<Iterator, std::size_t>;
     using Move = std::pair<Position, Position>;
 
@@ -38,99 +91,58 @@ public:
 
         return output;
     }
-    auto size() const noexcept { return data_.size(); }
+    auto size() const noexcept { return size(root_); }
 
     auto at(const std::size_t pos) -> Row&
     {
-        if ((0 == data_.size()) || ((data_.size() - 1) < pos)) {
-            throw std::out_of_range("Invalid position");
-        }
-
-        auto output = data_.begin();
-        std::advance(output, pos);
+        if (size() <= pos) { throw std::out_of_range("Invalid position"); }
 
-        return *output;
+        return select(pos)->row_;
     }
-    auto get(const RowID& id) -> Row& { return *index_.at(id); }
-    auto begin() noexcept -> Iterator { return data_.begin(); }
+    auto get(const RowID& id) -> Row& { return index_.at(id)->row_; }
+    auto begin() noexcept -> Iterator { return first(root_); }
     auto delete_row(const RowID& id, Iterator position) noexcept -> void
     {
-        data_.erase(position);
+        detach(position.node_);
         index_.erase(id);
     }
-    auto end() noexcept -> Iterator { return data_.end(); }
+    auto end() noexcept -> Iterator { return {}; }
     auto find_delete_position(const RowID& id) noexcept
         -> std::optional<Position>
     {
-        try {
-            const auto it = index_.at(id);
+        const auto it = index_.find(id);
 
-            return Position{
-                it, static_cast<std::size_t>(std::distance(data_.begin(), it))};
+        if (index_.end() == it) { return std::nullopt; }
 
-        } catch (...) {
+        auto* node = it->second.get();
 
-            return std::nullopt;
-        }
+        return Position{node, rank(node)};
     }
     auto find_insert_position(const SortKey& key, const RowID& id) noexcept
         -> Position
     {
-        auto output = Position{data_.end(), 0};
-        auto& [it, index] = output;
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i, ++index) {
-            const auto& [rKey, rId, item] = *i;
-
-            if (sort(key, id, rKey, rId)) { continue; }
-
-            it = i;
+        const auto index = lower_bound(key, id);
 
-            break;
-        }
-
-        return output;
+        return Position{select(index), index};
     }
     auto find_move_position(
         const RowID& oldId,
         const SortKey& newKey,
         const RowID& newID) noexcept -> std::optional<Move>
     {
-        auto output = Move{{data_.end(), 0}, {data_.end(), 0}};
-        auto& [from, to] = output;
-        auto& [it, index] = to;
-
-        try {
-            const auto it = index_.at(oldId);
-            from = Position{
-                it, static_cast<std::size_t>(std::distance(data_.begin(), it))};
-        } catch (...) {
-
-            return std::nullopt;
-        }
+        auto from = find_delete_position(oldId);
 
-        for (auto i{data_.begin()}; i != data_.end(); ++i, ++index) {
-            const auto& [rKey, rId, item] = *i;
+        if (false == from.has_value()) { return std::nullopt; }
 
-            if (sort(newKey, newID, rKey, rId)) { continue; }
-
-            it = i;
-
-            break;
-        }
-
-        return std::move(output);
+        return Move{from.value(), find_insert_position(newKey, newID)};
     }
     auto get_index(const RowID& id) noexcept -> std::optional<std::size_t>
     {
-        try {
+        const auto it = index_.find(id);
 
-            return static_cast<std::size_t>(
-                std::distance(data_.begin(), index_.at(id)));
-        } catch (...) {
+        if (index_.end() == it) { return std::nullopt; }
 
-            return std::nullopt;
-        }
+        return rank(it->second.get());
     }
     auto insert_before(
         const Iterator& position,
@@ -138,8 +150,9 @@ public:
         const RowID& id,
         const RowPointer& item) noexcept
     {
-        auto& index = index_[id];
-        index = data_.emplace(position, Row{key, id, item});
+        auto& node = index_[id];
+        node = std::make_unique<Node>(Row{key, id, item}, random_());
+        attach_before(node.get(), position.node_);
     }
     auto move_before(
         const RowID& oldId,
@@ -148,25 +161,208 @@ public:
         const RowID& newID,
         Iterator newPosition) noexcept -> void
     {
-        index_.erase(oldId);
-        auto& oldData = *oldPosition;
-        auto& index = index_[newID];
-        index = data_.emplace(newPosition, Row{newKey, newID, oldData.item_});
-        data_.erase(oldPosition);
+        auto* node = oldPosition.node_;
+
+        if (oldId != newID) {
+            auto handle = index_.extract(oldId);
+            handle.key() = newID;
+            index_.insert(std::move(handle));
+        }
+
+        node->row_.key_ = newKey;
+        node->row_.id_ = newID;
+
+        if (node == newPosition.node_) { return; }
+
+        detach(node);
+        attach_before(node, newPosition.node_);
     }
 
     ListItems(const bool reverse) noexcept
         : reverse_sort_(reverse)
-        , data_()
+        , random_()
+        , root_(nullptr)
         , index_()
     {
     }
 
 private:
+    struct Node {
+        Row row_;
+        const std::uint_fast32_t priority_;
+        std::size_t size_;
+        Node* parent_;
+        Node* left_;
+        Node* right_;
+
+        Node(Row&& row, const std::uint_fast32_t priority) noexcept
+            : row_(std::move(row))
+            , priority_(priority)
+            , size_(1)
+            , parent_(nullptr)
+            , left_(nullptr)
+            , right_(nullptr)
+        {
+        }
+    };
+
+    using Split = std::pair<Node*, Node*>;
+
     const bool reverse_sort_;
-    Data data_;
+    std::minstd_rand random_;
+    Node* root_;
     Index index_;
 
+    static auto first(Node* node) noexcept -> Node*
+    {
+        if (nullptr == node) { return nullptr; }
+
+        while (nullptr != node->left_) { node = node->left_; }
+
+        return node;
+    }
+    static auto merge(Node* lhs, Node* rhs) noexcept -> Node*
+    {
+        if (nullptr == lhs) { return rhs; }
+        if (nullptr == rhs) { return lhs; }
+
+        if (lhs->priority_ > rhs->priority_) {
+            lhs->right_ = merge(lhs->right_, rhs);
+            update(lhs);
+
+            return lhs;
+        } else {
+            rhs->left_ = merge(lhs, rhs->left_);
+            update(rhs);
+
+            return rhs;
+        }
+    }
+    static auto next(Node* node) noexcept -> Node*
+    {
+        if (nullptr != node->right_) { return first(node->right_); }
+
+        while ((nullptr != node->parent_) && (node == node->parent_->right_)) {
+            node = node->parent_;
+        }
+
+        return node->parent_;
+    }
+    static auto rank(const Node* node) noexcept -> std::size_t
+    {
+        auto output = size(node->left_);
+
+        for (auto* i = node; nullptr != i->parent_; i = i->parent_) {
+            if (i == i->parent_->right_) {
+                output += size(i->parent_->left_) + 1u;
+            }
+        }
+
+        return output;
+    }
+    static auto size(const Node* node) noexcept -> std::size_t
+    {
+        return (nullptr == node) ? 0u : node->size_;
+    }
+    /// Left side of the output contains the first count nodes
+    static auto split(Node* node, const std::size_t count) noexcept -> Split
+    {
+        if (nullptr == node) { return {nullptr, nullptr}; }
+
+        const auto left = size(node->left_);
+
+        if (left < count) {
+            auto [lhs, rhs] = split(node->right_, count - left - 1u);
+            node->right_ = lhs;
+            update(node);
+
+            return {node, rhs};
+        } else {
+            auto [lhs, rhs] = split(node->left_, count);
+            node->left_ = rhs;
+            update(node);
+
+            return {lhs, node};
+        }
+    }
+    static auto update(Node* node) noexcept -> void
+    {
+        node->size_ = size(node->left_) + size(node->right_) + 1u;
+
+        if (nullptr != node->left_) { node->left_->parent_ = node; }
+        if (nullptr != node->right_) { node->right_->parent_ = node; }
+    }
+
+    auto attach_before(Node* node, Node* position) noexcept -> void
+    {
+        const auto index = (nullptr == position) ? size() : rank(position);
+        auto [lhs, rhs] = split(root_, index);
+        set_root(merge(merge(lhs, node), rhs));
+    }
+    auto detach(Node* node) noexcept -> void
+    {
+        auto* child = merge(node->left_, node->right_);
+        auto* parent = node->parent_;
+
+        if (nullptr == parent) {
+            set_root(child);
+        } else {
+            if (node == parent->left_) {
+                parent->left_ = child;
+            } else {
+                parent->right_ = child;
+            }
+
+            for (auto* i = parent; nullptr != i; i = i->parent_) { update(i); }
+        }
+
+        node->size_ = 1u;
+        node->parent_ = nullptr;
+        node->left_ = nullptr;
+        node->right_ = nullptr;
+    }
+    /// Number of rows which sort before the specified key
+    auto lower_bound(const SortKey& key, const RowID& id) const noexcept
+        -> std::size_t
+    {
+        auto output = std::size_t{0};
+
+        for (auto* i = root_; nullptr != i;) {
+            if (sort(key, id, i->row_.key_, i->row_.id_)) {
+                output += size(i->left_) + 1u;
+                i = i->right_;
+            } else {
+                i = i->left_;
+            }
+        }
+
+        return output;
+    }
+    auto select(std::size_t pos) const noexcept -> Node*
+    {
+        auto* i = root_;
+
+        while (nullptr != i) {
+            const auto left = size(i->left_);
+
+            if (pos < left) {
+                i = i->left_;
+            } else if (pos == left) {
+                break;
+            } else {
+                pos -= left + 1u;
+                i = i->right_;
+            }
+        }
+
+        return i;
+    }
+    auto set_root(Node* node) noexcept -> void
+    {
+        root_ = node;
+
+        if (nullptr != root_) { root_->parent_ = nullptr; }
+    }
     template <typename T>
     auto sort(const T& lhs, const T& rhs) const noexcept -> bool
     {
@@ -190,5 +386,10 @@ private:
 
         return (existingKey == incomingKey) && sort(existingID, incomingID);
     }
+
+    ListItems(const ListItems&) = delete;
+    ListItems(ListItems&&) = delete;
+    auto operator=(const ListItems&) -> ListItems& = delete;
+    auto operator=(ListItems&&) -> ListItems& = delete;
 };
 }  // namespace opentxs::ui::implementation
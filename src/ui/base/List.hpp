@@ -7,15 +7,19 @@
 
 #include <functional>
 #include <future>
+#include <map>
 #include <optional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "internal/api/client/Client.hpp"
 #include "internal/core/Core.hpp"
 #include "internal/ui/UI.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
+#include "ui/base/Executor.hpp"
 #include "ui/base/Items.hpp"
 #include "ui/base/Widget.hpp"
 
@@ -44,6 +48,15 @@ class List : virtual public ExternalInterface,
 public:
     using QtPointerType = RowInternal;
 
+    auto canFetchMore(const QModelIndex& parent) const noexcept
+        -> bool override
+    {
+        if (nullptr == get_pointer(parent)) {
+            return CanFetchMore();
+        } else {
+            return false;
+        }
+    }
     auto columnCount(const QModelIndex& parent) const noexcept -> int override
     {
         if (nullptr == get_pointer(parent)) {
@@ -61,6 +74,10 @@ public:
 
         return valid_pointers_.data(index, role);
     }
+    auto fetchMore(const QModelIndex& parent) noexcept -> void override
+    {
+        if (nullptr == get_pointer(parent)) { FetchMore(); }
+    }
     auto index(int row, int column, const QModelIndex& parent) const noexcept
         -> QModelIndex override
     {
@@ -107,6 +124,13 @@ public:
     using Roles = QHash<int, QByteArray>;
 #endif  // OT_QT
 
+    /// Returns true if the list contains rows which have not been loaded
+    auto CanFetchMore() const noexcept -> bool { return 0 < unloaded(); }
+    /// Load the next page of rows in the background
+    auto FetchMore() const noexcept -> void
+    {
+        if (0 < unloaded()) { fetch_.Trigger(Executor::Priority::Visible); }
+    }
     auto First() const noexcept -> SharedPimpl<RowInterface> override
     {
         rLock lock{recursive_lock_};
@@ -161,14 +185,13 @@ public:
 
     ~List() override
     {
-        if (startup_ && startup_->joinable()) {
-            startup_->join();
-            startup_.reset();
-        }
+        fetch_.Stop();
+        startup_.Stop();
     }
 
 protected:
     using RowPointer = std::shared_ptr<RowInternal>;
+    using ItemData = std::tuple<RowID, SortKey, CustomData>;
 
 #if OT_QT
     struct MyPointers {
@@ -268,7 +291,12 @@ protected:
     mutable std::size_t counter_;
     mutable OTFlag have_items_;
     mutable OTFlag start_;
-    std::unique_ptr<std::thread> startup_;
+    Executor::Task startup_;
+    /// Child classes which implement load_page() must stop this task in
+    /// their destructors
+    mutable Executor::Task fetch_;
+
+    static constexpr auto page_size_ = std::size_t{100};
 
 #if OT_QT
     static auto get_pointer(const QModelIndex& index) -> const QtPointerType*
@@ -391,6 +419,12 @@ protected:
         return get_index(lock, row, column);
     }
 #endif  // OT_QT
+    /// Remove up to count rows from the set of rows which are not loaded
+    virtual auto load_page([[maybe_unused]] const std::size_t count) noexcept
+        -> std::vector<ItemData>
+    {
+        return {};
+    }
     virtual auto lookup(const rLock&, const RowID& id) const noexcept
         -> const RowInternal&
     {
@@ -403,6 +437,8 @@ protected:
         }
     }
     auto size() const noexcept -> std::size_t { return items_.size(); }
+    /// Number of rows which exist but have not been loaded
+    virtual auto unloaded() const noexcept -> std::size_t { return 0; }
     auto wait_for_startup() const noexcept -> void { startup_future_.get(); }
 
     virtual auto add_item(
@@ -427,6 +463,48 @@ protected:
         }
     }
     auto init() noexcept -> void {}
+    /** Apply a set of row changes as a single model update
+     *
+     *  New rows are constructed and existing rows are moved and reindexed.
+     *  If replace is true then existing rows which do not appear in items are
+     *  deleted. If the batch only adds rows, and the new rows are adjacent to
+     *  each other once sorted, the model receives one row insertion signal.
+     *  Otherwise the model is reset once after all changes have been applied.
+     *
+     *  Lists which override add_item() must not use this function.
+     */
+    auto update_items(
+        std::vector<ItemData>& items,
+        const bool replace = false) noexcept -> void
+    {
+        rLock lock{recursive_lock_};
+        const auto deleteIDs = find_inactive(lock, items, replace);
+        const auto existing = std::any_of(
+            items.begin(), items.end(), [this](const auto& item) {
+                return items_.get_index(std::get<0>(item)).has_value();
+            });
+
+        auto rows = construct_rows(lock, items);
+
+        if (deleteIDs.empty() && (false == existing)) {
+            if (rows.empty()) { return; }
+
+            if (const auto pos = find_block(lock, rows); pos.has_value()) {
+                insert_block(lock, rows, pos.value());
+
+                return;
+            }
+        }
+
+        reset_items(lock, items, rows, deleteIDs);
+    }
+    /// Top level widgets are loaded ahead of the rows they contain
+    auto schedule_startup(Executor::Job&& job) noexcept -> void
+    {
+        using Priority = Executor::Priority;
+        startup_ = Executor::Get().Schedule(
+            std::move(job), subnode_ ? Priority::Normal : Priority::Visible);
+    }
     auto row_modified(const RowID& id) noexcept -> void
     {
         rLock lock{recursive_lock_};
@@ -480,7 +558,8 @@ protected:
         , counter_(0)
         , have_items_(Flag::Factory(false))
         , start_(Flag::Factory(true))
-        , startup_(nullptr)
+        , startup_()
+        , fetch_(Executor::Get().Prepare([this] { fetch_page(); }))
 #if OT_QT
         , qt_roles_(roles)
 #endif  // OT_QT
@@ -524,6 +603,7 @@ protected:
 
 private:
     using ItemsType = ListItems<RowID, SortKey, RowPointer>;
+    using NewRows = std::map<RowID, std::pair<SortKey, RowPointer>>;
 
 #if OT_QT
     const Roles qt_roles_;
@@ -540,6 +620,25 @@ private:
         const RowID& id,
         const SortKey& index,
         CustomData& custom) const noexcept -> RowPointer = 0;
+    auto construct_rows(const rLock&, std::vector<ItemData>& items)
+        const noexcept -> NewRows
+    {
+        auto output = NewRows{};
+
+        for (auto& [id, key, custom] : items) {
+            if (items_.get_index(id).has_value()) { continue; }
+
+            if (auto it = output.find(id); output.end() != it) {
+                auto& [existingKey, pointer] = it->second;
+                existingKey = key;
+                pointer->reindex(key, custom);
+            } else if (auto pointer = construct_row(id, key, custom); pointer) {
+                output.emplace(id, std::make_pair(key, std::move(pointer)));
+            }
+        }
+
+        return output;
+    }
 #if OT_QT
     auto emit_begin_insert_rows(const QModelIndex& parent, int first, int last)
         const noexcept -> void override
@@ -561,6 +660,10 @@ private:
     {
         const_cast<List&>(*this).beginRemoveRows(parent, first, last);
     }
+    auto emit_begin_reset_model() const noexcept -> void override
+    {
+        const_cast<List&>(*this).beginResetModel();
+    }
     auto emit_data_changed(
         const QModelIndex& topLeft,
         const QModelIndex& bottomRight) noexcept
@@ -580,6 +683,10 @@ private:
     {
         const_cast<List&>(*this).endRemoveRows();
     }
+    auto emit_end_reset_model() const noexcept -> void override
+    {
+        const_cast<List&>(*this).endResetModel();
+    }
     auto get_index(const rLock&, const int row, const int column) const noexcept
         -> QModelIndex
     {
@@ -626,6 +733,17 @@ private:
 #if OT_QT
     auto me() const noexcept -> QModelIndex override { return {}; }
 #endif  // OT_QT
+    auto insert_rows(const rLock&, NewRows& rows) noexcept -> void
+    {
+        for (auto& [id, row] : rows) {
+            auto& [key, pointer] = row;
+            const auto position = items_.find_insert_position(key, id);
+            items_.insert_before(position.first, key, id, pointer);
+#if OT_QT
+            register_child(pointer.get());
+#endif  // OT_QT
+        }
+    }
     auto move_item(
         const rLock&,
         const RowID& id,
@@ -675,6 +793,120 @@ private:
         if (changed || (!samePosition)) { UpdateNotify(); }
     }
 
+    auto fetch_page() noexcept -> void
+    {
+        auto items = load_page(page_size_);
+
+        if (items.empty()) { return; }
+
+        update_items(items);
+    }
+    /// Returns the row index of the new rows if they will be adjacent
+    auto find_block(const rLock&, const NewRows& rows) const noexcept
+        -> std::optional<std::size_t>
+    {
+        auto output = std::optional<std::size_t>{};
+
+        for (const auto& [id, row] : rows) {
+            const auto& [position, index] =
+                items_.find_insert_position(row.first, id);
+
+            if (false == output.has_value()) {
+                output = index;
+            } else if (output.value() != index) {
+
+                return std::nullopt;
+            }
+        }
+
+        return output;
+    }
+    auto find_inactive(
+        const rLock&,
+        const std::vector<ItemData>& items,
+        const bool replace) const noexcept -> std::vector<RowID>
+    {
+        auto output = std::vector<RowID>{};
+
+        if (false == replace) { return output; }
+
+        auto active = std::set<RowID>{};
+
+        for (const auto& item : items) { active.emplace(std::get<0>(item)); }
+
+        const auto existing = items_.active();
+        std::set_difference(
+            existing.begin(),
+            existing.end(),
+            active.begin(),
+            active.end(),
+            std::back_inserter(output));
+
+        return output;
+    }
+    auto insert_block(
+        const rLock& lock,
+        NewRows& rows,
+        [[maybe_unused]] const std::size_t position) noexcept -> void
+    {
+#if OT_QT
+        const auto first = static_cast<int>(position);
+        const auto count = static_cast<int>(rows.size());
+        emit_begin_insert_rows(me(), first, first + count - 1);
+#endif  // OT_QT
+        insert_rows(lock, rows);
+#if OT_QT
+        row_count_ += count;
+        emit_end_insert_rows();
+#endif  // OT_QT
+        UpdateNotify();
+    }
+    auto reset_items(
+        const rLock& lock,
+        std::vector<ItemData>& items,
+        NewRows& rows,
+        const std::vector<RowID>& deleteIDs) noexcept -> void
+    {
+        if (items.empty() && deleteIDs.empty()) { return; }
+
+#if OT_QT
+        const auto before = static_cast<int>(items_.size());
+        emit_begin_reset_model();
+#endif  // OT_QT
+
+        for (const auto& id : deleteIDs) {
+            auto position = items_.find_delete_position(id);
+
+            if (false == position.has_value()) { continue; }
+
+            auto& [it, index] = position.value();
+#if OT_QT
+            unregister_child(it->item_.get());
+#endif  // OT_QT
+            items_.delete_row(id, it);
+        }
+
+        for (auto& [id, key, custom] : items) {
+            if (0 < rows.count(id)) { continue; }
+
+            auto move = items_.find_move_position(id, key, id);
+
+            if (false == move.has_value()) { continue; }
+
+            auto& [from, to] = move.value();
+            auto* item = from.first->item_.get();
+            items_.move_before(id, from.first, key, id, to.first);
+            item->reindex(key, custom);
+        }
+
+        insert_rows(lock, rows);
+#if OT_QT
+        row_count_ += static_cast<int>(items_.size()) - before;
+        emit_end_reset_model();
+#endif  // OT_QT
+        UpdateNotify();
+    }
+
     List() = delete;
     List(const List&) = delete;
     List(List&&) = delete;
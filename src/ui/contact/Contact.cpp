@@ -13,7 +13,6 @@
 #include <map>
 #include <memory>
 #include <set>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -108,9 +107,7 @@ Contact::Contact(
     // NOTE nym_id_ is actually the contact id
     init();
     setup_listeners(listeners_);
-    startup_.reset(new std::thread(&Contact::startup, this));
-
-    OT_ASSERT(startup_)
+    schedule_startup([this] { startup(); });
 }
 
 auto Contact::check_type(const contact::ContactSectionName type) noexcept
@@ -11,7 +11,6 @@
 #include <memory>
 #include <set>
 #include <stdexcept>
-#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -137,12 +136,10 @@ ContactSection::ContactSection(
           key)
 {
     init();
-    startup_.reset(new std::thread(
-        &ContactSection::startup,
-        this,
-        extract_custom<opentxs::ContactSection>(custom)));
-
-    OT_ASSERT(startup_)
+    schedule_startup(
+        [this, section = extract_custom<opentxs::ContactSection>(custom)] {
+            startup(section);
+        });
 }
 
 auto ContactSection::check_type(const ContactSectionRowID type) noexcept -> bool
@@ -9,7 +9,6 @@
 
 #include <memory>
 #include <set>
-#include <thread>
 #include <type_traits>
 
 #include "internal/contact/Contact.hpp"
@@ -58,12 +57,10 @@ ContactSubsection::ContactSubsection(
     , sequence_(-1)
 {
     init();
-    startup_.reset(new std::thread(
-        &ContactSubsection::startup,
-        this,
-        extract_custom<opentxs::ContactGroup>(custom)));
-
-    OT_ASSERT(startup_)
+    schedule_startup(
+        [this, group = extract_custom<opentxs::ContactGroup>(custom)] {
+            startup(group);
+        });
 }
 
 auto ContactSubsection::construct_row(
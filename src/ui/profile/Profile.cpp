@@ -15,7 +15,6 @@
 #include <map>
 #include <memory>
 #include <set>
-#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -114,9 +113,7 @@ Profile::Profile(
 {
     init();
     setup_listeners(listeners_);
-    startup_.reset(new std::thread(&Profile::startup, this));
-
-    OT_ASSERT(startup_)
+    schedule_startup([this] { startup(); });
 }
 
 auto Profile::AddClaim(
@@ -12,7 +12,6 @@
 #include <memory>
 #include <set>
 #include <stdexcept>
-#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -161,12 +160,10 @@ ProfileSection::ProfileSection(
     : Combined(api, parent.NymID(), parent.WidgetID(), parent, rowID, key)
 {
     init();
-    startup_.reset(new std::thread(
-        &ProfileSection::startup,
-        this,
-        extract_custom<opentxs::ContactSection>(custom)));
-
-    OT_ASSERT(startup_)
+    schedule_startup(
+        [this, section = extract_custom<opentxs::ContactSection>(custom)] {
+            startup(section);
+        });
 }
 
 auto ProfileSection::AddClaim(
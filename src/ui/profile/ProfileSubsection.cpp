@@ -9,7 +9,6 @@
 
 #include <memory>
 #include <set>
-#include <thread>
 #include <type_traits>
 
 #include "internal/contact/Contact.hpp"
@@ -53,12 +52,10 @@ ProfileSubsection::ProfileSubsection(
     , sequence_(-1)
 {
     init();
-    startup_.reset(new std::thread(
-        &ProfileSubsection::startup,
-        this,
-        extract_custom<opentxs::ContactGroup>(custom)));
-
-    OT_ASSERT(startup_)
+    schedule_startup(
+        [this, group = extract_custom<opentxs::ContactGroup>(custom)] {
+            startup(group);
+        });
 }
 
 auto ProfileSubsection::AddItem(
@@ -10,7 +10,6 @@
 #include <map>
 #include <memory>
 #include <set>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -107,9 +106,7 @@ UnitList::UnitList(
 {
     init();
     setup_listeners(listeners_);
-    startup_.reset(new std::thread(&UnitList::startup, this));
-
-    OT_ASSERT(startup_)
+    schedule_startup([this] { startup(); });
 }
 
 auto UnitList::construct_row(
@@ -21,7 +21,9 @@ extern "C" {
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "util/ByteLiterals.hpp"
+#include "util/Metrics.hpp"
 #include "util/ScopeGuard.hpp"
+#include "util/Trace.hpp"
 
 #if OS_SUPPORTS_LARGE_SPARSE_FILES
 #define OT_LMDB_SIZE 1_TiB
@@ -35,6 +37,17 @@ extern "C" {
 
 namespace opentxs::storage::lmdb
 {
+namespace
+{
+auto commit_time() noexcept -> metrics::Histogram&
+{
+    static auto& output =
+        metrics::Registry::Get().GetHistogram("storage.lmdb.commit");
+
+    return output;
+}
+}  // namespace
+
 struct LMDB::Imp {
     auto Commit() const noexcept -> bool
     {
@@ -625,6 +638,8 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
         auto cleanup = Cleanup{ptr_};
 
         if (success_) {
+            const auto timer = metrics::Timer{commit_time()};
+            OT_TRACE_SPAN(span, "commit", "lmdb");
 
             return 0 == ::mdb_txn_commit(ptr_);
         } else {
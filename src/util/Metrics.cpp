@@ -0,0 +1,170 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"      // IWYU pragma: associated
+#include "1_Internal.hpp"    // IWYU pragma: associated
+#include "util/Metrics.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::metrics
+{
+namespace
+{
+/// Bucket i holds samples less than 2^i
+auto bucket(std::uint64_t value) noexcept -> std::size_t
+{
+    auto output = std::size_t{0};
+
+    while ((0 < value) && (output + 1u < Histogram::buckets_)) {
+        value >>= 1u;
+        ++output;
+    }
+
+    return output;
+}
+
+auto upper_bound(const std::size_t bucket) noexcept -> std::uint64_t
+{
+    return std::uint64_t{1} << bucket;
+}
+
+template <typename Map>
+auto get(std::mutex& lock, Map& map, const std::string& name) noexcept
+    -> typename Map::mapped_type::element_type&
+{
+    using Type = typename Map::mapped_type::element_type;
+    auto guard = Lock{lock};
+    auto& output = map[name];
+
+    if (false == bool(output)) { output = std::make_unique<Type>(); }
+
+    return *output;
+}
+}  // namespace
+
+Histogram::Histogram() noexcept
+    : counts_()
+    , count_(0)
+    , sum_(0)
+    , max_(0)
+{
+    for (auto& count : counts_) { count.store(0); }
+}
+
+auto Histogram::Record(const std::uint64_t microseconds) noexcept -> void
+{
+    counts_[bucket(microseconds)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(microseconds, std::memory_order_relaxed);
+    auto max = max_.load(std::memory_order_relaxed);
+
+    while ((max < microseconds) &&
+           (false == max_.compare_exchange_weak(
+                         max, microseconds, std::memory_order_relaxed))) {
+    }
+}
+
+auto Histogram::Summarize() const noexcept -> Summary
+{
+    auto counts = std::array<std::uint64_t, buckets_>{};
+    auto total = std::uint64_t{0};
+
+    for (auto i = std::size_t{0}; i < buckets_; ++i) {
+        counts[i] = counts_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    const auto percentile = [&](const std::uint64_t percent) {
+        const auto target = (total * percent + 99u) / 100u;
+        auto seen = std::uint64_t{0};
+
+        for (auto i = std::size_t{0}; i < buckets_; ++i) {
+            seen += counts[i];
+
+            if ((0 < seen) && (seen >= target)) { return upper_bound(i); }
+        }
+
+        return std::uint64_t{0};
+    };
+
+    return Summary{
+        total,
+        sum_.load(std::memory_order_relaxed),
+        percentile(50),
+        percentile(99),
+        max_.load(std::memory_order_relaxed)};
+}
+
+Registry::Registry() noexcept
+    : lock_()
+    , counters_()
+    , gauges_()
+    , histograms_()
+{
+}
+
+auto Registry::Get() noexcept -> Registry&
+{
+    static auto registry = Registry{};
+
+    return registry;
+}
+
+auto Registry::GetCounter(const std::string& name) noexcept -> Counter&
+{
+    return get(lock_, counters_, name);
+}
+
+auto Registry::GetGauge(const std::string& name) noexcept -> Gauge&
+{
+    return get(lock_, gauges_, name);
+}
+
+auto Registry::GetHistogram(const std::string& name) noexcept -> Histogram&
+{
+    return get(lock_, histograms_, name);
+}
+
+auto Registry::Report() const noexcept -> std::string
+{
+    auto lines = std::map<std::string, std::string>{};
+
+    {
+        auto lock = Lock{lock_};
+
+        for (const auto& [name, counter] : counters_) {
+            lines[name] = "counter " + std::to_string(counter->Value());
+        }
+
+        for (const auto& [name, gauge] : gauges_) {
+            lines[name] = "gauge " + std::to_string(gauge->Value());
+        }
+
+        for (const auto& [name, histogram] : histograms_) {
+            const auto summary = histogram->Summarize();
+            auto line = std::stringstream{};
+            line << "histogram count=" << summary.count_
+                 << " sum_us=" << summary.sum_ << " p50_us=" << summary.p50_
+                 << " p99_us=" << summary.p99_ << " max_us=" << summary.max_;
+            lines[name] = line.str();
+        }
+    }
+
+    auto output = std::stringstream{};
+
+    for (const auto& [name, value] : lines) {
+        output << name << ' ' << value << '\n';
+    }
+
+    return output.str();
+}
+
+Registry::~Registry() = default;
+}  // namespace opentxs::metrics
@@ -0,0 +1,182 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "opentxs/Version.hpp"
+
+namespace opentxs::metrics
+{
+/// Monotonically increasing count of events or bytes
+class OPENTXS_EXPORT Counter
+{
+public:
+    auto Value() const noexcept -> std::uint64_t
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+    auto Add(const std::uint64_t value = 1) noexcept -> void
+    {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    Counter() noexcept
+        : value_(0)
+    {
+    }
+
+private:
+    std::atomic<std::uint64_t> value_;
+
+    Counter(const Counter&) = delete;
+    Counter(Counter&&) = delete;
+    auto operator=(const Counter&) -> Counter& = delete;
+    auto operator=(Counter&&) -> Counter& = delete;
+};
+
+/// Instantaneous value such as a queue depth
+class OPENTXS_EXPORT Gauge
+{
+public:
+    auto Value() const noexcept -> std::int64_t
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+    auto Add(const std::int64_t value) noexcept -> void
+    {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+    auto Set(const std::int64_t value) noexcept -> void
+    {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    Gauge() noexcept
+        : value_(0)
+    {
+    }
+
+private:
+    std::atomic<std::int64_t> value_;
+
+    Gauge(const Gauge&) = delete;
+    Gauge(Gauge&&) = delete;
+    auto operator=(const Gauge&) -> Gauge& = delete;
+    auto operator=(Gauge&&) -> Gauge& = delete;
+};
+
+/** Distribution of durations in microseconds
+ *
+ *  Samples are counted in power of two buckets, so recording a sample is a
+ *  few relaxed atomic increments and percentiles are reported as the upper
+ *  bound of the bucket which contains them.
+ */
+class OPENTXS_EXPORT Histogram
+{
+public:
+    static constexpr auto buckets_ = std::size_t{40};
+
+    struct Summary {
+        std::uint64_t count_;
+        std::uint64_t sum_;
+        std::uint64_t p50_;
+        std::uint64_t p99_;
+        std::uint64_t max_;
+    };
+
+    auto Summarize() const noexcept -> Summary;
+
+    auto Record(const std::uint64_t microseconds) noexcept -> void;
+    template <typename Duration>
+    auto Record(const Duration duration) noexcept -> void
+    {
+        const auto value =
+            std::chrono::duration_cast<std::chrono::microseconds>(duration)
+                .count();
+        Record(static_cast<std::uint64_t>(std::max<decltype(value)>(value, 0)));
+    }
+
+    Histogram() noexcept;
+
+private:
+    std::array<std::atomic<std::uint64_t>, buckets_> counts_;
+    std::atomic<std::uint64_t> count_;
+    std::atomic<std::uint64_t> sum_;
+    std::atomic<std::uint64_t> max_;
+
+    Histogram(const Histogram&) = delete;
+    Histogram(Histogram&&) = delete;
+    auto operator=(const Histogram&) -> Histogram& = delete;
+    auto operator=(Histogram&&) -> Histogram& = delete;
+};
+
+/// Records the lifetime of the object into a histogram
+class Timer
+{
+public:
+    Timer(Histogram& histogram) noexcept
+        : histogram_(histogram)
+        , start_(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~Timer() { histogram_.Record(std::chrono::steady_clock::now() - start_); }
+
+private:
+    Histogram& histogram_;
+    const std::chrono::steady_clock::time_point start_;
+
+    Timer() = delete;
+    Timer(const Timer&) = delete;
+    Timer(Timer&&) = delete;
+    auto operator=(const Timer&) -> Timer& = delete;
+    auto operator=(Timer&&) -> Timer& = delete;
+};
+
+/** Process-wide collection of named metrics
+ *
+ *  Metrics are created on first use and live until the process exits, so
+ *  callers should look a metric up once and keep the reference.
+ */
+class OPENTXS_EXPORT Registry
+{
+public:
+    static auto Get() noexcept -> Registry&;
+
+    /// One line per metric, sorted by name
+    auto Report() const noexcept -> std::string;
+
+    auto GetCounter(const std::string& name) noexcept -> Counter&;
+    auto GetGauge(const std::string& name) noexcept -> Gauge&;
+    auto GetHistogram(const std::string& name) noexcept -> Histogram&;
+
+    ~Registry();
+
+private:
+    mutable std::mutex lock_;
+    std::map<std::string, std::unique_ptr<Counter>> counters_;
+    std::map<std::string, std::unique_ptr<Gauge>> gauges_;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms_;
+
+    Registry() noexcept;
+    Registry(const Registry&) = delete;
+    Registry(Registry&&) = delete;
+    auto operator=(const Registry&) -> Registry& = delete;
+    auto operator=(Registry&&) -> Registry& = delete;
+};
+}  // namespace opentxs::metrics
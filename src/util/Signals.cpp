@@ -15,6 +15,7 @@
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
+#include "util/Trace.hpp"
 
 #define OT_METHOD "opentxs::Signals::"
 
@@ -26,7 +27,13 @@ const std::map<int, std::function<bool()>> Signals::handler_{
     {3, &Signals::handle_3},   {4, &Signals::handle_4},
     {5, &Signals::handle_5},   {6, &Signals::handle_6},
     {7, &Signals::handle_7},   {8, &Signals::handle_8},
-    {9, &Signals::handle_9},   {10, &Signals::handle_10},
+    {9, &Signals::handle_9},
+#if OT_TRACE
+    // SIGUSR1 is only handled if trace spans are recorded
+    {10, &Signals::dump_trace},
+#else
+    {10, &Signals::handle_10},
+#endif
     {11, &Signals::handle_11}, {12, &Signals::handle_12},
     {13, &Signals::handle_13}, {14, &Signals::handle_14},
     {15, &Signals::handle_15}, {16, &Signals::handle_16},
@@ -82,6 +89,13 @@ void Signals::handle()
 #endif
 }
 
+auto Signals::dump_trace() -> bool
+{
+    trace::Dump();
+
+    return false;
+}
+
 auto Signals::process(const int signal) -> bool
 {
     auto handler = handler_.find(signal);
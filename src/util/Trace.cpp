@@ -0,0 +1,261 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "util/Trace.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+#define OT_METHOD "opentxs::trace::"
+
+namespace opentxs::trace
+{
+namespace
+{
+constexpr auto capacity_ = std::size_t{65536};
+constexpr auto default_file_{"opentxs-trace.json"};
+
+struct Event {
+    const char* name_;
+    const char* category_;
+    std::uint64_t flow_;
+    std::uint64_t start_;
+    std::uint64_t duration_;
+};
+
+/// Ring of the most recent spans recorded by one thread
+struct Buffer {
+    const std::uint64_t thread_;
+    std::mutex lock_;
+    std::vector<Event> events_;
+    std::size_t next_;
+
+    auto Add(const Event& event) noexcept -> void
+    {
+        auto lock = Lock{lock_};
+
+        if (events_.size() < capacity_) {
+            events_.emplace_back(event);
+        } else {
+            events_[next_] = event;
+            next_ = (next_ + 1u) % capacity_;
+        }
+    }
+
+    Buffer(const std::uint64_t thread) noexcept
+        : thread_(thread)
+        , lock_()
+        , events_()
+        , next_(0)
+    {
+    }
+};
+
+class Collector
+{
+public:
+    static auto Get() noexcept -> Collector&
+    {
+        static auto collector = Collector{};
+
+        return collector;
+    }
+
+    auto File() const noexcept -> std::string
+    {
+        auto lock = Lock{lock_};
+
+        return file_;
+    }
+    auto Now() const noexcept -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - epoch_)
+                .count());
+    }
+    auto Local() noexcept -> Buffer&
+    {
+        thread_local const auto owner = Owner{*this};
+
+        return *owner.buffer_;
+    }
+    /// Remove and return every recorded span
+    auto Take() noexcept
+        -> std::vector<std::pair<std::uint64_t, std::vector<Event>>>
+    {
+        auto buffers = decltype(buffers_){};
+
+        {
+            auto lock = Lock{lock_};
+            buffers = buffers_;
+        }
+
+        auto output =
+            std::vector<std::pair<std::uint64_t, std::vector<Event>>>{};
+        output.reserve(buffers.size());
+
+        for (const auto& buffer : buffers) {
+            auto lock = Lock{buffer->lock_};
+            auto& [thread, events] = output.emplace_back(
+                buffer->thread_, std::vector<Event>{});
+            events.swap(buffer->events_);
+            buffer->next_ = 0;
+        }
+
+        return output;
+    }
+    auto SetFile(const std::string& path) noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        file_ = path;
+    }
+
+private:
+    /// Releases the buffer of a thread when the thread exits
+    struct Owner {
+        Collector& parent_;
+        const std::shared_ptr<Buffer> buffer_;
+
+        Owner(Collector& parent) noexcept
+            : parent_(parent)
+            , buffer_(parent_.add_buffer())
+        {
+        }
+
+        ~Owner() { parent_.remove_buffer(buffer_); }
+    };
+
+    const std::chrono::steady_clock::time_point epoch_;
+    mutable std::mutex lock_;
+    std::string file_;
+    std::uint64_t next_thread_;
+    std::vector<std::shared_ptr<Buffer>> buffers_;
+
+    auto add_buffer() noexcept -> std::shared_ptr<Buffer>
+    {
+        auto lock = Lock{lock_};
+
+        return buffers_.emplace_back(std::make_shared<Buffer>(++next_thread_));
+    }
+    auto remove_buffer(const std::shared_ptr<Buffer>& buffer) noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        buffers_.erase(
+            std::remove(buffers_.begin(), buffers_.end(), buffer),
+            buffers_.end());
+    }
+
+    Collector() noexcept
+        : epoch_(std::chrono::steady_clock::now())
+        , lock_()
+        , file_(default_file_)
+        , next_thread_(0)
+        , buffers_()
+    {
+    }
+    Collector(const Collector&) = delete;
+    Collector(Collector&&) = delete;
+    auto operator=(const Collector&) -> Collector& = delete;
+    auto operator=(Collector&&) -> Collector& = delete;
+};
+}  // namespace
+
+Span::Span(const char* name, const char* category) noexcept
+    : name_(name)
+    , category_(category)
+    , flow_(0)
+    , start_(Collector::Get().Now())
+{
+}
+
+auto Dump() noexcept -> bool
+{
+    const auto path = Collector::Get().File();
+    auto file = std::ofstream{path, std::ios::out | std::ios::trunc};
+    file << Output();
+    file.close();
+
+    if (file.fail()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to write trace to ")(
+            path)
+            .Flush();
+
+        return false;
+    }
+
+    LogNormal("Wrote trace to ")(path).Flush();
+
+    return true;
+}
+
+auto FlowID(const ReadView id) noexcept -> std::uint64_t
+{
+    auto output = std::uint64_t{0};
+    std::memcpy(&output, id.data(), std::min(id.size(), sizeof(output)));
+
+    return output;
+}
+
+auto Output() noexcept -> std::string
+{
+    auto output = std::stringstream{};
+    auto first{true};
+    output << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+    for (const auto& [thread, events] : Collector::Get().Take()) {
+        for (const auto& event : events) {
+            if (first) {
+                first = false;
+            } else {
+                output << ',';
+            }
+
+            output << R"({"name":")" << event.name_ << R"(","cat":")"
+                   << event.category_ << R"(","ph":"X","pid":1,"tid":)"
+                   << thread << R"(,"ts":)" << event.start_ << R"(,"dur":)"
+                   << event.duration_;
+
+            if (0 != event.flow_) {
+                output << R"(,"bind_id":"0x)" << std::hex << event.flow_
+                       << std::dec << R"(","flow_in":true,"flow_out":true)";
+            }
+
+            output << '}';
+        }
+    }
+
+    output << "]}";
+
+    return output.str();
+}
+
+auto SetFile(const std::string& path) noexcept -> void
+{
+    Collector::Get().SetFile(path);
+}
+
+Span::~Span()
+{
+    auto& collector = Collector::Get();
+    collector.Local().Add(
+        Event{name_, category_, flow_, start_, collector.Now() - start_});
+}
+}  // namespace opentxs::trace
@@ -0,0 +1,63 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "opentxs/Bytes.hpp"
+
+namespace opentxs::trace
+{
+/** Timed region of a hot path
+ *
+ *  Spans are recorded into a per-thread ring buffer when they are destroyed.
+ *  Spans which share a flow id are linked by the trace viewer, which shows
+ *  how a single item (such as a block) moves between threads.
+ *
+ *  The name and category must be string literals. Use the OT_TRACE_SPAN and
+ *  OT_TRACE_FLOW macros instead of constructing spans directly so they can
+ *  be removed at compile time.
+ */
+class Span
+{
+public:
+    auto Bind(const std::uint64_t flow) noexcept -> void { flow_ = flow; }
+
+    Span(const char* name, const char* category) noexcept;
+
+    ~Span();
+
+private:
+    const char* name_;
+    const char* category_;
+    std::uint64_t flow_;
+    const std::uint64_t start_;
+
+    Span() = delete;
+    Span(const Span&) = delete;
+    Span(Span&&) = delete;
+    auto operator=(const Span&) -> Span& = delete;
+    auto operator=(Span&&) -> Span& = delete;
+};
+
+/// Write the recorded spans to the file set by SetFile
+auto Dump() noexcept -> bool;
+/// Derive a flow id from the leading bytes of an identifier such as a hash
+auto FlowID(const ReadView id) noexcept -> std::uint64_t;
+/// Recorded spans in Chrome trace event format
+auto Output() noexcept -> std::string;
+auto SetFile(const std::string& path) noexcept -> void;
+}  // namespace opentxs::trace
+
+#if OT_TRACE
+#define OT_TRACE_SPAN(span, name, category)                                    \
+    auto span = opentxs::trace::Span { name, category }
+#define OT_TRACE_FLOW(span, id) span.Bind(opentxs::trace::FlowID(id))
+#else
+#define OT_TRACE_SPAN(span, name, category) static_cast<void>(0)
+#define OT_TRACE_FLOW(span, id) static_cast<void>(0)
+#endif
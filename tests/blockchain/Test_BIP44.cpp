@@ -36,6 +36,7 @@
 #include "opentxs/crypto/Language.hpp"
 #include "opentxs/crypto/SeedStyle.hpp"
 #include "opentxs/crypto/Types.hpp"
+#include "opentxs/crypto/key/EllipticCurve.hpp"
 #include "opentxs/identity/Nym.hpp"
 #include "paymentcode/VectorsV3.hpp"
 
@@ -159,6 +160,34 @@ TEST_F(Test_BIP44, generate_expected_keys)
     }
 }
 
+TEST_F(Test_BIP44, lookahead_matches_sequential_derivation)
+{
+    // The lookahead window is generated as one batch when the account is
+    // created, which derives the keys on the thread pool
+    using Subchain = ot::blockchain::crypto::Subchain;
+    const auto test = [&](auto subchain, const auto& vector) {
+        const auto window = account_.Lookahead();
+        const auto last = account_.LastGenerated(subchain);
+
+        ASSERT_TRUE(last.has_value());
+        ASSERT_GE(last.value() + 1u, window);
+
+        for (auto i = ot::Bip32Index{0}; i < window; ++i) {
+            const auto pKey = account_.Key(subchain, i);
+
+            ASSERT_TRUE(pKey);
+
+            const auto correct = api_.Factory().Data(ot::reader(vector.at(i)));
+            const auto batch = api_.Factory().Data(pKey->PublicKey());
+
+            EXPECT_EQ(batch->asHex(), correct->asHex());
+        }
+    };
+
+    test(Subchain::External, external_);
+    test(Subchain::Internal, internal_);
+}
+
 TEST_F(Test_BIP44, balance_elements)
 {
     const auto test = [&](auto subchain, auto i, const auto& vector) {
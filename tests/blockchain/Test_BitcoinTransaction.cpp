@@ -3,12 +3,18 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <boost/endian/buffers.hpp>
 #include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
@@ -33,6 +39,9 @@
 #include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/crypto/HashType.hpp"
+#include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"
+
+namespace be = boost::endian;
 
 namespace
 {
@@ -96,6 +105,90 @@ const auto in_hex_3_ = std::string{
     "a8514ca51137c6d8a4befa476a7521197b886fceafa9f5c2830bea6df62792a6dd46f2b268"
     "12b250f13fad473e5cab6dcceaa2d53cf2c82e8e03d95a0e70836b"};
 
+// Scripts of the outputs spent by transaction_hex_
+const auto previous_script_hex_ = std::vector<std::string>{
+    "76a914ed598f72f7b6e3010f7dd26ae751d4fd8d36ff6c88ac",
+    "76a914c297fa1a92c151c5fb2d611f018b6b4db5b398d588ac",
+    "76a914b910efe6a88175b86a6803f36b0f997a4580342188ac"};
+// Legacy signature hashes of transaction_hex_ in the form of Bitcoin Core's
+// sighash.json: input index, hash type, and the double SHA256 digest. The
+// SIGHASH_ALL digests verify against the signatures in the transaction.
+const auto legacy_vectors_ =
+    std::vector<std::tuple<std::size_t, std::uint8_t, std::string>>{
+        {0,
+         0x01,
+         "5e61e5f6adbce551a03be4bea822bb89e09ace7318cd0108b2783575ebda74f4"},
+        {1,
+         0x01,
+         "edc73cb8cde72aba7e1c250986c90c167c6e949e440b221af1bb8103c1897dc4"},
+        {2,
+         0x01,
+         "4faeb798ded073d133143f38e29b5d2d86ec7ce97cf4d85c249d38ecede129c3"},
+        {1,
+         0x02,
+         "8ff48a18f46c2b706508603ef04ec1fbf60f2eb5ae6e89b37d9970fd91b1515e"},
+        {0,
+         0x03,
+         "f333831becec8f5203e6ebd9644be753eb61f13e989a0188e9dc48c5778b5794"},
+        {1,
+         0x03,
+         "24b205de3f5cc56e43ca7aac501a33954f3b8a762d60e2628f26afd3bf4cba98"},
+        {2,
+         0x81,
+         "ee7fd4e5961cdc6315e6c671322b65f945bf27f5ad69713d4ea93d19852a0c23"},
+        {0,
+         0x82,
+         "2b4375839819179a6dbbb5f80d351744678ff1554dd9b584f09ca0ce26ade5c4"},
+        {1,
+         0x83,
+         "1675ec1c6a7347e7a731d93d26587a3ccbf07dffa231450c11bd7b373b82cc9e"},
+    };
+// Mainnet transaction f4184fc596403b9d638783cf57adfe4c75c605f6356fbc91338530e9
+// 831e9e16 spending a pay to pubkey output
+const auto p2pk_transaction_hex_ = std::string{
+    "0100000001c997a5e56e104102fa209c6a852dd90660a20b2d9c352423edce25857fcd3704"
+    "000000004847304402204e45e16932b8af514961a1d3a1a25fdf3f4f7732e9d624c6c61548"
+    "ab5fb8cd410220181522ec8eca07de4860a4acdd12909d831cc56cbbac4622082221a8768d"
+    "1d0901ffffffff0200ca9a3b00000000434104ae1a62fe09c5f51b13905f07f06b99a2f715"
+    "9b2225f374cd378d71302fa28414e7aab37397f554a7df5f142c21c1b7303b8a0626f1bade"
+    "d5c72a704f7e6cd84cac00286bee0000000043410411db93e1dcdb8a016b49840f8c53bc1e"
+    "b68a382e97b1482ecad7b148a6909a5cb2e0eaddfb84ccf9744464f82e160bfa9b8b64f9d4"
+    "c03f999b8643f656b412a3ac00000000"};
+const auto p2pk_previous_script_hex_ = std::string{
+    "410411db93e1dcdb8a016b49840f8c53bc1eb68a382e97b1482ecad7b148a6909a5cb2e0ea"
+    "ddfb84ccf9744464f82e160bfa9b8b64f9d4c03f999b8643f656b412a3ac"};
+const auto p2pk_sighash_hex_ = std::string{
+    "7a05c6145f10101e9d6325494245adf1297d80f8f38d4d576d57cdba220bcb19"};
+// Native P2WPKH example from BIP143
+const auto bip143_transaction_hex_ = std::string{
+    "0100000002fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f"
+    "0000000000eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57"
+    "b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85"
+    "c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2"
+    "f0167faa815988ac11000000"};
+const auto bip143_previous_script_hex_ =
+    std::string{"00141d0f172a0ecb48aee1be1f2687d2963ae33f71a1"};
+const auto bip143_previous_value_ = std::uint64_t{600000000};
+const auto bip143_outpoints_hex_ = std::string{
+    "96b827c8483d4e9b96712b6713a7b68d6e8003a781feba36c31143470b4efd37"};
+const auto bip143_sequences_hex_ = std::string{
+    "52b0a642eea2fb7ae638c36f6252b6750293dbe574a806984b8e4d8548339a3b"};
+const auto bip143_outputs_hex_ = std::string{
+    "863ef3e1a92afbfdb97f31ad0fc7683ee943e9abcf2501590ff8f6551f47e5e5"};
+const auto bip143_single_hex_ = std::vector<std::string>{
+    "0701d9ec53c6c2f46dec454a0dab027e7b2cf8b6be6979f205672036280ce0b0",
+    "06a38ad2542a7afde41771be93bee525ead1614ced50b08df30ae70be5feab72"};
+const auto bip143_preimage_hex_ = std::string{
+    "0100000096b827c8483d4e9b96712b6713a7b68d6e8003a781feba36c31143470b4efd3752"
+    "b0a642eea2fb7ae638c36f6252b6750293dbe574a806984b8e4d8548339a3bef51e1b804cc"
+    "89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a010000001976a9141d0f17"
+    "2a0ecb48aee1be1f2687d2963ae33f71a188ac0046c32300000000ffffffff863ef3e1a92a"
+    "fbfdb97f31ad0fc7683ee943e9abcf2501590ff8f6551f47e5e51100000001000000"};
+const auto bip143_sighash_hex_ = std::string{
+    "c37af31116d1b27caf68aae9e3ac82f1477929014d5b917657d0eb49478cb670"};
+const auto bip143_single_acp_sighash_hex_ = std::string{
+    "79ff9ff708f79ce8f7a4f90d62028533a99d7340b7fb3d819dfd9a599a78e39c"};
+
 struct Test_BitcoinTransaction : public ::testing::Test {
     const ot::api::client::Manager& api_;
     const ot::OTData tx_id_;
@@ -110,6 +203,7 @@ struct Test_BitcoinTransaction : public ::testing::Test {
 
     using Pattern = ot::blockchain::block::bitcoin::Script::Pattern;
     using Position = ot::blockchain::block::bitcoin::Script::Position;
+    using Tx = ot::blockchain::block::bitcoin::internal::Transaction;
 
     Test_BitcoinTransaction()
         : api_(ot::Context().StartClient({}, 0))
@@ -129,6 +223,87 @@ struct Test_BitcoinTransaction : public ::testing::Test {
         , in_script_3_(api_.Factory().Data(in_hex_3_, ot::StringStyle::Hex))
     {
     }
+
+    static auto sighash(const std::uint8_t type)
+        -> ot::blockchain::bitcoin::SigHash
+    {
+        auto output = ot::blockchain::bitcoin::SigHash{
+            ot::blockchain::Type::Bitcoin};
+        output.flags_ = std::byte{type};
+
+        return output;
+    }
+
+    auto associate(
+        Tx& tx,
+        const std::size_t input,
+        const std::uint64_t value,
+        const std::string& script) const -> bool
+    {
+        auto output = ot::proto::BlockchainTransactionOutput{};
+        output.set_version(1);
+        output.set_index(tx.Inputs().at(input).PreviousOutput().Index());
+        output.set_value(value);
+        output.set_script(std::string{
+            api_.Factory().Data(script, ot::StringStyle::Hex)->Bytes()});
+
+        return tx.AssociatePreviousOutput(api_.Blockchain(), input, output);
+    }
+    auto hash(const ot::Space& preimage) const -> std::string
+    {
+        auto output = api_.Factory().Data();
+        const auto hashed = api_.Crypto().Hash().Digest(
+            ot::crypto::HashType::Sha256D,
+            ot::reader(preimage),
+            output->WriteInto());
+
+        EXPECT_TRUE(hashed);
+
+        return output->asHex();
+    }
+    auto hash(const std::string& hex) const
+        -> ot::blockchain::bitcoin::Bip143Hashes::Hash
+    {
+        const auto bytes = api_.Factory().Data(hex, ot::StringStyle::Hex);
+        auto output = ot::blockchain::bitcoin::Bip143Hashes::Hash{};
+
+        EXPECT_EQ(bytes->size(), output.size());
+
+        std::memcpy(output.data(), bytes->data(), output.size());
+
+        return output;
+    }
+    auto legacy(const ot::blockchain::block::bitcoin::Transaction& tx) const
+        -> ot::blockchain::bitcoin::LegacySighash
+    {
+        auto output = ot::blockchain::bitcoin::LegacySighash{};
+
+        for (const auto& input : tx.Inputs()) {
+            output.outpoints_.emplace_back(input.PreviousOutput());
+            output.sequences_.emplace_back(input.Sequence());
+        }
+
+        for (const auto& out : tx.Outputs()) {
+            auto& bytes = output.outputs_.emplace_back();
+
+            EXPECT_TRUE(out.Serialize(ot::writer(bytes)).has_value());
+        }
+
+        return output;
+    }
+    auto parse(const std::string& hex) const -> std::unique_ptr<Tx>
+    {
+        const auto bytes = api_.Factory().Data(hex, ot::StringStyle::Hex);
+
+        return ot::factory::BitcoinTransaction(
+            api_,
+            api_.Blockchain(),
+            ot::blockchain::Type::Bitcoin,
+            std::numeric_limits<std::size_t>::max(),
+            ot::Clock::now(),
+            ot::blockchain::bitcoin::EncodedTransaction::Deserialize(
+                api_, ot::blockchain::Type::Bitcoin, bytes->Bytes()));
+    }
 };
 
 TEST_F(Test_BitcoinTransaction, serialization)
@@ -437,4 +612,94 @@ TEST_F(Test_BitcoinTransaction, normalized_id)
     EXPECT_EQ(id1.get(), tx_id_.get());
     EXPECT_NE(id1.get(), id2.get());
 }
+
+TEST_F(Test_BitcoinTransaction, legacy_sighash)
+{
+    using Input = ot::blockchain::block::bitcoin::internal::Input;
+
+    auto tx = parse(transaction_hex_);
+
+    ASSERT_TRUE(tx);
+    ASSERT_EQ(tx->Inputs().size(), previous_script_hex_.size());
+
+    for (auto i = std::size_t{0}; i < previous_script_hex_.size(); ++i) {
+        ASSERT_TRUE(associate(*tx, i, 0, previous_script_hex_.at(i)));
+    }
+
+    const auto hashes = legacy(*tx);
+    const auto version = be::little_int32_buf_t{tx->Version()};
+    const auto locktime = be::little_uint32_buf_t{tx->Locktime()};
+
+    for (const auto& [index, type, expected] : legacy_vectors_) {
+        const auto& input = dynamic_cast<const Input&>(tx->Inputs().at(index));
+        const auto preimage =
+            hashes.Preimage(index, version, locktime, sighash(type), input);
+
+        EXPECT_EQ(hash(preimage), expected);
+    }
+
+    // SIGHASH_SINGLE is not defined for inputs without a matching output
+    const auto& input = dynamic_cast<const Input&>(tx->Inputs().at(2));
+
+    EXPECT_THROW(
+        hashes.Preimage(2, version, locktime, sighash(0x03), input),
+        std::runtime_error);
+}
+
+TEST_F(Test_BitcoinTransaction, legacy_sighash_p2pk)
+{
+    using Input = ot::blockchain::block::bitcoin::internal::Input;
+
+    auto tx = parse(p2pk_transaction_hex_);
+
+    ASSERT_TRUE(tx);
+    ASSERT_TRUE(associate(*tx, 0, 5000000000, p2pk_previous_script_hex_));
+
+    const auto& input = dynamic_cast<const Input&>(tx->Inputs().at(0));
+    const auto preimage = legacy(*tx).Preimage(
+        0,
+        be::little_int32_buf_t{tx->Version()},
+        be::little_uint32_buf_t{tx->Locktime()},
+        sighash(0x01),
+        input);
+
+    EXPECT_EQ(hash(preimage), p2pk_sighash_hex_);
+}
+
+TEST_F(Test_BitcoinTransaction, bip143_sighash)
+{
+    using Input = ot::blockchain::block::bitcoin::internal::Input;
+
+    auto tx = parse(bip143_transaction_hex_);
+
+    ASSERT_TRUE(tx);
+    ASSERT_TRUE(associate(
+        *tx, 1, bip143_previous_value_, bip143_previous_script_hex_));
+
+    auto hashes = ot::blockchain::bitcoin::Bip143Hashes{};
+    hashes.outpoints_ = hash(bip143_outpoints_hex_);
+    hashes.sequences_ = hash(bip143_sequences_hex_);
+    hashes.outputs_ = hash(bip143_outputs_hex_);
+
+    for (const auto& single : bip143_single_hex_) {
+        hashes.single_.emplace_back(hash(single));
+    }
+
+    const auto& input = dynamic_cast<const Input&>(tx->Inputs().at(1));
+    const auto version = be::little_int32_buf_t{tx->Version()};
+    const auto locktime = be::little_uint32_buf_t{tx->Locktime()};
+    const auto all =
+        hashes.Preimage(1, version, locktime, sighash(0x01), input);
+    const auto expected =
+        api_.Factory().Data(bip143_preimage_hex_, ot::StringStyle::Hex);
+
+    ASSERT_EQ(all.size(), expected->size());
+    EXPECT_EQ(std::memcmp(all.data(), expected->data(), all.size()), 0);
+    EXPECT_EQ(hash(all), bip143_sighash_hex_);
+
+    const auto singleACP =
+        hashes.Preimage(1, version, locktime, sighash(0x83), input);
+
+    EXPECT_EQ(hash(singleACP), bip143_single_acp_sighash_hex_);
+}
 }  // namespace
@@ -0,0 +1,64 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/blockchain/Types.hpp"
+
+namespace ot = opentxs;
+
+namespace
+{
+using Amount = ot::blockchain::Amount;
+using Params = ot::blockchain::node::internal::CoinSelection;
+
+const auto values_ =
+    std::vector<Amount>{100000, 50000, 30000, 20000, 7000, 5000, 100};
+constexpr auto input_fee_ = Amount{1000};
+
+auto effective(const std::vector<std::size_t>& selected) -> Amount
+{
+    auto output = Amount{0};
+
+    for (const auto index : selected) { output += values_[index] - input_fee_; }
+
+    return output;
+}
+
+TEST(CoinSelection, exact_match)
+{
+    const auto params = Params{58000, input_fee_, 500};
+    const auto selected =
+        ot::blockchain::node::internal::SelectCoins(params, values_);
+    const auto expected = std::vector<std::size_t>{2, 3, 4, 5};
+
+    EXPECT_EQ(selected, expected);
+    EXPECT_EQ(effective(selected), 58000);
+}
+
+TEST(CoinSelection, fallback)
+{
+    const auto params = Params{57300, input_fee_, 0};
+    const auto selected =
+        ot::blockchain::node::internal::SelectCoins(params, values_);
+
+    ASSERT_FALSE(selected.empty());
+    EXPECT_GE(effective(selected), params.target_);
+
+    for (const auto index : selected) { EXPECT_GT(values_[index], input_fee_); }
+}
+
+TEST(CoinSelection, insufficient)
+{
+    const auto params = Params{300000, input_fee_, 500};
+
+    EXPECT_TRUE(
+        ot::blockchain::node::internal::SelectCoins(params, values_).empty());
+}
+}  // namespace
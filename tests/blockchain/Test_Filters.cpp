@@ -408,6 +408,48 @@ TEST_F(Test_Filters, gcs)
     }
 }
 
+TEST_F(Test_Filters, gcs_overlapping_targets)
+{
+    const auto s1 = std::string{"blah"};
+    const auto s2 = std::string{"foo"};
+    const auto s3 = std::string{"justus"};
+    const auto s4 = std::string{"islajames"};
+    const auto object1(ot::Data::Factory(s1.data(), s1.length()));
+    const auto object2(ot::Data::Factory(s2.data(), s2.length()));
+    const auto object3(ot::Data::Factory(s3.data(), s3.length()));
+    const auto object4(ot::Data::Factory(s4.data(), s4.length()));
+    auto includedElements = std::vector<ot::OTData>{object1, object2, object3};
+    auto key = std::string{"0123456789abcdef"};
+    auto pGcs = ot::factory::GCS(
+        api_, params_.first, params_.second, key, includedElements);
+
+    ASSERT_TRUE(pGcs);
+
+    const auto& gcs = *pGcs;
+    // Targets of two subchains are concatenated as they are in a grouped
+    // wallet scan. The first subchain owns the first three targets and both
+    // subchains contain object2.
+    const auto targets = std::vector<ot::ReadView>{
+        object1->Bytes(),
+        object2->Bytes(),
+        object4->Bytes(),
+        object2->Bytes(),
+        object3->Bytes(),
+        object2->Bytes()};
+    const auto expected = std::vector<std::size_t>{0, 1, 3, 4, 5};
+    const auto matches = gcs.Match(targets);
+    auto positions = std::vector<std::size_t>{};
+
+    for (const auto& match : matches) {
+        positions.emplace_back(static_cast<std::size_t>(
+            std::distance(targets.cbegin(), match)));
+    }
+
+    std::sort(positions.begin(), positions.end());
+
+    EXPECT_EQ(positions, expected);
+}
+
 TEST_F(Test_Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
 
 TEST_F(Test_Filters, bip158_case_49291) { EXPECT_TRUE(TestGCSBlock(49291)); }
@@ -387,6 +387,7 @@ TEST_F(Regtest_payment_code, alice_after_receive_wallet)
         client_1_.Network().Blockchain().GetChain(test_chain_);
     const auto& wallet = network.Wallet();
     const auto& nym = alice_.ID();
+    const auto& otherNym = bob_.ID();
     const auto& account = SendHD().ID();
     const auto blankNym = client_1_.Factory().NymID();
     const auto blankAccount = client_1_.Factory().Identifier();
@@ -404,6 +405,7 @@ TEST_F(Regtest_payment_code, alice_after_receive_wallet)
     EXPECT_EQ(wallet.GetBalance(blankNym, blankAccount), noBalance);
     EXPECT_EQ(wallet.GetBalance(nym, blankAccount), noBalance);
     EXPECT_EQ(wallet.GetBalance(blankNym, account), noBalance);
+    EXPECT_EQ(wallet.GetBalance(otherNym, account), noBalance);
 
     using TxoState = ot::blockchain::node::Wallet::TxoState;
     auto type = TxoState::All;
@@ -576,6 +578,7 @@ TEST_F(Regtest_payment_code, alice_after_unconfirmed_spend_wallet)
         client_1_.Network().Blockchain().GetChain(test_chain_);
     const auto& wallet = network.Wallet();
     const auto& nym = alice_.ID();
+    const auto& otherNym = bob_.ID();
     const auto& accountHD = SendHD().ID();
     const auto& accountPC = SendPC().ID();
     const auto blankNym = client_1_.Factory().NymID();
@@ -596,6 +599,8 @@ TEST_F(Regtest_payment_code, alice_after_unconfirmed_spend_wallet)
     EXPECT_EQ(wallet.GetBalance(nym, blankAccount), noBalance);
     EXPECT_EQ(wallet.GetBalance(blankNym, accountHD), noBalance);
     EXPECT_EQ(wallet.GetBalance(blankNym, accountPC), noBalance);
+    EXPECT_EQ(wallet.GetBalance(otherNym, accountHD), noBalance);
+    EXPECT_EQ(wallet.GetBalance(otherNym, accountPC), noBalance);
 
     using TxoState = ot::blockchain::node::Wallet::TxoState;
     auto type = TxoState::All;
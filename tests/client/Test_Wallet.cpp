@@ -0,0 +1,52 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+
+#include "OTLowLevelTestEnvironment.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/server/Manager.hpp"
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/contract/ServerContract.hpp"
+#include "opentxs/core/identifier/Server.hpp"
+#include "opentxs/protobuf/ServerContract.pb.h"
+
+TEST(Wallet, storage_load_resolves_waiters)
+{
+    const auto& otx = ot::InitContext(OTLowLevelTestEnvironment::Args());
+    const auto& server = otx.StartServer({}, 0);
+    const auto& client = otx.StartClient({}, 0);
+    const auto& serverID = server.ID();
+    auto serialized = ot::proto::ServerContract{};
+
+    ASSERT_TRUE(server.Wallet().Server(serverID)->Serialize(serialized, true));
+
+    auto waiter = std::async(std::launch::async, [&] {
+        return client.Wallet()
+            .Server(serverID, std::chrono::minutes{1})
+            ->ID()
+            ->str();
+    });
+    // Give the waiter time to register before the contract is stored
+    std::this_thread::sleep_for(std::chrono::seconds{1});
+
+    // Store the contract without going through the wallet, then load it
+    ASSERT_TRUE(client.Storage().Store(serialized));
+    EXPECT_EQ(serverID.str(), client.Wallet().Server(serverID)->ID()->str());
+    ASSERT_EQ(
+        std::future_status::ready, waiter.wait_for(std::chrono::seconds{10}));
+    EXPECT_EQ(serverID.str(), waiter.get());
+
+    ot::Cleanup();
+}
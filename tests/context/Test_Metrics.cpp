@@ -0,0 +1,136 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Metrics.hpp"
+#include "util/Metrics.hpp"
+
+namespace ot = opentxs;
+
+namespace
+{
+using Histogram = ot::metrics::Histogram;
+using Registry = ot::metrics::Registry;
+
+auto contains(const std::string& report, const std::string& line) -> bool
+{
+    return std::string::npos != report.find(line + '\n');
+}
+}  // namespace
+
+TEST(Metrics, empty_histogram)
+{
+    const auto histogram = Histogram{};
+    const auto summary = histogram.Summarize();
+
+    EXPECT_EQ(summary.count_, 0u);
+    EXPECT_EQ(summary.sum_, 0u);
+    EXPECT_EQ(summary.p50_, 0u);
+    EXPECT_EQ(summary.p99_, 0u);
+    EXPECT_EQ(summary.max_, 0u);
+}
+
+TEST(Metrics, histogram_percentiles)
+{
+    auto histogram = Histogram{};
+
+    for (auto i = 0; i < 98; ++i) { histogram.Record(std::uint64_t{10}); }
+
+    histogram.Record(std::uint64_t{1000});
+    histogram.Record(std::uint64_t{0});
+    const auto summary = histogram.Summarize();
+
+    // Percentiles are reported as the upper bound of their bucket
+    EXPECT_EQ(summary.count_, 100u);
+    EXPECT_EQ(summary.sum_, 1980u);
+    EXPECT_EQ(summary.p50_, 16u);
+    EXPECT_EQ(summary.p99_, 16u);
+    EXPECT_EQ(summary.max_, 1000u);
+
+    histogram.Record(std::uint64_t{1000});
+
+    EXPECT_EQ(histogram.Summarize().p99_, 1024u);
+}
+
+TEST(Metrics, histogram_records_durations)
+{
+    auto histogram = Histogram{};
+    histogram.Record(std::chrono::milliseconds{2});
+    histogram.Record(std::chrono::microseconds{-5});
+    const auto summary = histogram.Summarize();
+
+    EXPECT_EQ(summary.count_, 2u);
+    EXPECT_EQ(summary.sum_, 2000u);
+    EXPECT_EQ(summary.max_, 2000u);
+}
+
+TEST(Metrics, histogram_saturates_largest_bucket)
+{
+    auto histogram = Histogram{};
+    histogram.Record(UINT64_MAX);
+    const auto summary = histogram.Summarize();
+
+    EXPECT_EQ(summary.p50_, std::uint64_t{1} << (Histogram::buckets_ - 1u));
+    EXPECT_EQ(summary.max_, UINT64_MAX);
+}
+
+TEST(Metrics, registry_returns_same_metric)
+{
+    auto& registry = Registry::Get();
+    auto& counter = registry.GetCounter("test.metrics.same");
+
+    EXPECT_EQ(&counter, &registry.GetCounter("test.metrics.same"));
+    EXPECT_NE(&counter, &registry.GetCounter("test.metrics.other"));
+    EXPECT_EQ(
+        &registry.GetHistogram("test.metrics.same"),
+        &registry.GetHistogram("test.metrics.same"));
+}
+
+TEST(Metrics, registry_report)
+{
+    auto& registry = Registry::Get();
+    registry.GetCounter("test.metrics.report.counter").Add(3);
+    auto& gauge = registry.GetGauge("test.metrics.report.gauge");
+    gauge.Set(7);
+    gauge.Add(-2);
+    registry.GetHistogram("test.metrics.report.histogram")
+        .Record(std::uint64_t{3});
+    const auto report = registry.Report();
+
+    EXPECT_TRUE(contains(report, "test.metrics.report.counter counter 3"));
+    EXPECT_TRUE(contains(report, "test.metrics.report.gauge gauge 5"));
+    EXPECT_TRUE(contains(
+        report,
+        "test.metrics.report.histogram histogram count=1 sum_us=3 p50_us=4 "
+        "p99_us=4 max_us=3"));
+
+    // Lines are sorted by name
+    EXPECT_LT(
+        report.find("test.metrics.report.counter"),
+        report.find("test.metrics.report.gauge"));
+    EXPECT_LT(
+        report.find("test.metrics.report.gauge"),
+        report.find("test.metrics.report.histogram"));
+}
+
+TEST(Metrics, not_published_unless_configured)
+{
+    const auto& metrics = ot::Context().Metrics();
+
+    EXPECT_TRUE(metrics.Endpoint().empty());
+
+    // Publishing without an endpoint is a no-op
+    metrics.Publish(std::chrono::milliseconds{10});
+    metrics.Publish(std::chrono::milliseconds{0});
+
+    EXPECT_FALSE(metrics.Report().empty());
+}
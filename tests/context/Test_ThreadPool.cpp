@@ -0,0 +1,243 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/api/Api.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/ThreadPool.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "util/Work.hpp"
+
+namespace ot = opentxs;
+
+namespace
+{
+using Pool = ot::api::internal::ThreadPool;
+using Priority = Pool::Priority;
+using Type = ot::OTZMQWorkType;
+
+constexpr auto block_{Type{ot::OT_ZMQ_INTERNAL_SIGNAL + 100}};
+constexpr auto ui_{Type{ot::OT_ZMQ_INTERNAL_SIGNAL + 101}};
+constexpr auto background_{Type{ot::OT_ZMQ_INTERNAL_SIGNAL + 102}};
+constexpr auto spawn_{Type{ot::OT_ZMQ_INTERNAL_SIGNAL + 103}};
+constexpr auto record_{Type{ot::OT_ZMQ_INTERNAL_SIGNAL + 104}};
+constexpr auto spawned_{std::size_t{64}};
+constexpr auto timeout_{std::chrono::seconds{30}};
+
+std::atomic<std::size_t> blocked_{0};
+std::vector<std::shared_future<void>> gates_{};
+std::mutex lock_{};
+std::vector<Type> order_{};
+std::vector<std::thread::id> threads_{};
+std::promise<std::thread::id> spawner_{};
+
+auto pool() -> Pool&
+{
+    return const_cast<Pool&>(
+        dynamic_cast<const Pool&>(ot::Context().ThreadPool()));
+}
+
+auto submit(const Type type, const std::size_t index = 0) -> bool
+{
+    auto work = Pool::MakeWork(ot::Context().ZMQ(), type);
+    work->AddFrame(index);
+
+    return pool().Submit(type, std::move(work));
+}
+
+auto wait_for(const std::function<bool()>& condition) -> bool
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    while (false == condition()) {
+        if ((std::chrono::steady_clock::now() - start) > timeout_) {
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return true;
+}
+
+auto recorded(const std::size_t count) -> std::function<bool()>
+{
+    return [=] {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        return count <= threads_.size();
+    };
+}
+
+auto workers() -> std::size_t
+{
+    return std::max<std::size_t>(Pool::Capacity(), 1u);
+}
+
+auto register_handlers() -> void
+{
+    static const auto registered = [] {
+        auto& threads = pool();
+        threads.Register(
+            block_,
+            [](const auto& in) {
+                const auto index =
+                    in.Body().at(0).template as<std::size_t>();
+                ++blocked_;
+                gates_.at(index).wait();
+            },
+            Priority::Background);
+        threads.Register(
+            ui_,
+            [](const auto&) {
+                auto lock = std::lock_guard<std::mutex>{lock_};
+                order_.emplace_back(ui_);
+            },
+            Priority::UI);
+        threads.Register(
+            background_,
+            [](const auto&) {
+                auto lock = std::lock_guard<std::mutex>{lock_};
+                order_.emplace_back(background_);
+            },
+            Priority::Background);
+        threads.Register(
+            record_,
+            [](const auto&) {
+                auto lock = std::lock_guard<std::mutex>{lock_};
+                threads_.emplace_back(std::this_thread::get_id());
+            },
+            Priority::Background);
+        threads.Register(
+            spawn_,
+            [](const auto&) {
+                spawner_.set_value(std::this_thread::get_id());
+
+                for (auto i = std::size_t{0}; i < spawned_; ++i) {
+                    submit(record_);
+                }
+
+                // The spawned jobs are queued on this worker, which does not
+                // return until other workers have run all of them
+                wait_for(recorded(spawned_));
+            },
+            Priority::Background);
+
+        return true;
+    }();
+
+    EXPECT_TRUE(registered);
+}
+}  // namespace
+
+TEST(ThreadPool, higher_priority_runs_first)
+{
+    register_handlers();
+    const auto count = workers();
+    auto gates = std::vector<std::promise<void>>(count);
+    gates_.clear();
+
+    for (auto& gate : gates) { gates_.emplace_back(gate.get_future()); }
+
+    blocked_ = 0;
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        ASSERT_TRUE(submit(block_, i));
+    }
+
+    ASSERT_TRUE(wait_for([&] { return count == blocked_.load(); }));
+    ASSERT_TRUE(submit(background_));
+    ASSERT_TRUE(submit(ui_));
+
+    // Exactly one worker is released so the queued jobs run in order
+    gates.at(0).set_value();
+    const auto done = wait_for([] {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        return 2u == order_.size();
+    });
+
+    for (auto i = std::size_t{1}; i < count; ++i) { gates.at(i).set_value(); }
+
+    ASSERT_TRUE(done);
+    EXPECT_EQ(order_.at(0), ui_);
+    EXPECT_EQ(order_.at(1), background_);
+}
+
+TEST(ThreadPool, idle_workers_steal_queued_jobs)
+{
+    // Stealing requires a second worker
+    if (2u > workers()) { return; }
+
+    register_handlers();
+    ASSERT_TRUE(submit(spawn_));
+    auto future = spawner_.get_future();
+
+    ASSERT_EQ(future.wait_for(timeout_), std::future_status::ready);
+    ASSERT_TRUE(wait_for(recorded(spawned_)));
+
+    const auto spawner = future.get();
+    auto lock = std::lock_guard<std::mutex>{lock_};
+
+    EXPECT_EQ(threads_.size(), spawned_);
+    EXPECT_EQ(std::count(threads_.begin(), threads_.end(), spawner), 0);
+}
+
+TEST(ThreadPool, parallel_visits_every_index_once)
+{
+    constexpr auto count = std::size_t{10000};
+    auto visits = std::vector<std::atomic<int>>(count);
+    const auto success = pool().Parallel(count, 8, [&](const auto index) {
+        ++visits.at(index);
+
+        return true;
+    });
+
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](auto& value) {
+        return 1 == value.load();
+    }));
+}
+
+TEST(ThreadPool, parallel_stops_after_failure)
+{
+    constexpr auto count = std::size_t{10000};
+    auto calls = std::atomic<std::size_t>{0};
+    const auto success = pool().Parallel(count, 8, [&](const auto index) {
+        ++calls;
+
+        return 0u != index;
+    });
+
+    EXPECT_FALSE(success);
+    EXPECT_LT(calls.load(), count);
+}
+
+TEST(ThreadPool, shutdown)
+{
+    register_handlers();
+    pool().Shutdown();
+
+    EXPECT_FALSE(submit(ui_));
+
+    // Shutting down twice is harmless
+    pool().Shutdown();
+}
@@ -5,11 +5,15 @@
 
 #include <gtest/gtest.h>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
 #include "opentxs/OT.hpp"
+#include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/api/Context.hpp"
@@ -65,6 +69,64 @@ TEST(Message, AddFrame_string)
     ASSERT_STREQ("testString", messageString.c_str());
 }
 
+TEST(Message, AddFrame_Space)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    auto buffer = space(std::size_t{1024});
+    const auto* original = buffer.data();
+
+    auto& message = multipartMessage->AddFrame(std::move(buffer));
+    ASSERT_EQ(multipartMessage->size(), 1);
+    ASSERT_EQ(message.size(), 1024);
+    ASSERT_EQ(message.data(), original);
+}
+
+TEST(Message, AddFrame_shared)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    auto buffer = std::make_shared<const Space>(space(std::size_t{1024}));
+
+    auto& message = multipartMessage->AddFrame(buffer);
+    ASSERT_EQ(multipartMessage->size(), 1);
+    ASSERT_EQ(message.size(), 1024);
+    ASSERT_EQ(message.data(), buffer->data());
+    ASSERT_EQ(buffer.use_count(), 2);
+
+    multipartMessage = network::zeromq::Message::Factory();
+    ASSERT_EQ(buffer.use_count(), 1);
+}
+
+TEST(Message, AddFrame_Frame)
+{
+    auto source = network::zeromq::Message::Factory();
+    auto& original = source->AddFrame(space(std::size_t{1024}));
+    auto multipartMessage = network::zeromq::Message::Factory();
+
+    auto& message = multipartMessage->AddFrame(original);
+    ASSERT_EQ(multipartMessage->size(), 1);
+    ASSERT_EQ(message.size(), 1024);
+    ASSERT_EQ(message.data(), original.data());
+}
+
+TEST(Message, AddFrame_Frame_writable)
+{
+    auto source = network::zeromq::Message::Factory();
+    auto view = source->AppendBytes()(1024);
+    std::memset(view.data(), 0x01, view.size());
+    const auto& original = source->at(0);
+    auto multipartMessage = network::zeromq::Message::Factory();
+
+    // A frame which was handed out for writing must not share its buffer
+    auto& message = multipartMessage->AddFrame(original);
+    ASSERT_EQ(multipartMessage->size(), 1);
+    ASSERT_EQ(message.size(), 1024);
+    ASSERT_NE(message.data(), original.data());
+    ASSERT_EQ(message.Bytes(), original.Bytes());
+
+    std::memset(view.data(), 0x02, view.size());
+    ASSERT_NE(message.Bytes(), original.Bytes());
+}
+
 TEST(Message, at)
 {
     auto multipartMessage = network::zeromq::Message::Factory();
@@ -0,0 +1,226 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <fcntl.h>
+#include <unistd.h>
+}
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "network/zeromq/Reactor.hpp"
+
+namespace
+{
+using Reactor = opentxs::network::zeromq::implementation::Reactor;
+
+constexpr auto timeout_{std::chrono::seconds{30}};
+
+auto wait_for(const std::function<bool()>& condition) -> bool
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    while (false == condition()) {
+        if ((std::chrono::steady_clock::now() - start) > timeout_) {
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return true;
+}
+
+// Stands in for a socket by exposing the read end of a non-blocking pipe
+class Pipe final : public Reactor::Handler
+{
+public:
+    std::atomic<std::size_t> attempts_;
+    std::atomic<std::size_t> drained_;
+    std::atomic<std::size_t> received_;
+    std::atomic<bool> busy_;
+    std::function<void()> callback_;
+
+    auto reactor_descriptors() const noexcept -> std::vector<int> final
+    {
+        return {read_};
+    }
+    auto reactor_process() noexcept -> bool final
+    {
+        ++attempts_;
+
+        if (busy_) { return false; }
+
+        auto buffer = char{};
+
+        while (1 == ::read(read_, &buffer, 1)) {
+            ++received_;
+
+            if (callback_) { callback_(); }
+        }
+
+        drained_.store(received_.load());
+
+        return true;
+    }
+    auto Signal() const noexcept -> void
+    {
+        const auto buffer = char{'x'};
+        [[maybe_unused]] const auto bytes = ::write(write_, &buffer, 1);
+    }
+
+    Pipe() noexcept
+        : attempts_(0)
+        , drained_(0)
+        , received_(0)
+        , busy_(false)
+        , callback_()
+        , read_(-1)
+        , write_(-1)
+    {
+        int fds[2]{-1, -1};
+        [[maybe_unused]] const auto rc = ::pipe(fds);
+        read_ = fds[0];
+        write_ = fds[1];
+        ::fcntl(read_, F_SETFL, ::fcntl(read_, F_GETFL) | O_NONBLOCK);
+    }
+
+    ~Pipe() final
+    {
+        ::close(read_);
+        ::close(write_);
+    }
+
+private:
+    int read_;
+    int write_;
+};
+}  // namespace
+
+TEST(Reactor, processes_ready_descriptors)
+{
+    const auto reactor = Reactor::Factory(2);
+
+    if (false == bool(reactor)) { return; }
+
+    auto pipe = Pipe{};
+
+    ASSERT_TRUE(reactor->Add(pipe));
+
+    for (auto i = std::size_t{0}; i < 10u; ++i) { pipe.Signal(); }
+
+    EXPECT_TRUE(wait_for([&] { return 10u == pipe.received_.load(); }));
+
+    reactor->Remove(pipe);
+}
+
+TEST(Reactor, busy_handler_backs_off)
+{
+    const auto reactor = Reactor::Factory(2);
+
+    if (false == bool(reactor)) { return; }
+
+    auto pipe = Pipe{};
+    pipe.busy_ = true;
+
+    ASSERT_TRUE(reactor->Add(pipe));
+
+    pipe.Signal();
+    std::this_thread::sleep_for(std::chrono::milliseconds{500});
+
+    // Without a back-off a busy handler is retried continuously
+    EXPECT_GT(pipe.attempts_.load(), 1u);
+    EXPECT_LT(pipe.attempts_.load(), 25u);
+    EXPECT_EQ(pipe.received_.load(), 0u);
+
+    pipe.busy_ = false;
+
+    EXPECT_TRUE(wait_for([&] { return 1u == pipe.received_.load(); }));
+
+    reactor->Remove(pipe);
+}
+
+TEST(Reactor, blocked_callback_does_not_stall_other_handlers)
+{
+    const auto reactor = Reactor::Factory(1);
+
+    if (false == bool(reactor)) { return; }
+
+    auto first = Pipe{};
+    auto second = Pipe{};
+    auto promise = std::promise<void>{};
+    auto future = promise.get_future();
+    auto unblocked = std::atomic<bool>{false};
+    first.callback_ = [&] {
+        unblocked = (std::future_status::ready == future.wait_for(timeout_));
+    };
+    second.callback_ = [&] { promise.set_value(); };
+
+    ASSERT_TRUE(reactor->Add(first));
+    ASSERT_TRUE(reactor->Add(second));
+
+    first.Signal();
+
+    ASSERT_TRUE(wait_for([&] { return 1u == first.received_.load(); }));
+
+    // The only worker is now blocked until the second handler runs
+    second.Signal();
+
+    EXPECT_TRUE(wait_for([&] { return unblocked.load(); }));
+    EXPECT_GT(reactor->Workers(), 1u);
+
+    reactor->Remove(first);
+    reactor->Remove(second);
+}
+
+TEST(Reactor, removed_handler_is_not_processed)
+{
+    const auto reactor = Reactor::Factory(2);
+
+    if (false == bool(reactor)) { return; }
+
+    auto pipe = Pipe{};
+
+    ASSERT_TRUE(reactor->Add(pipe));
+
+    reactor->Remove(pipe);
+    const auto attempts = pipe.attempts_.load();
+    pipe.Signal();
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    EXPECT_EQ(pipe.attempts_.load(), attempts);
+    EXPECT_EQ(pipe.received_.load(), 0u);
+}
+
+TEST(Reactor, handler_may_remove_itself)
+{
+    const auto reactor = Reactor::Factory(2);
+
+    if (false == bool(reactor)) { return; }
+
+    auto pipe = Pipe{};
+    pipe.callback_ = [&] { reactor->Remove(pipe); };
+
+    ASSERT_TRUE(reactor->Add(pipe));
+
+    pipe.Signal();
+
+    EXPECT_TRUE(wait_for([&] { return 1u == pipe.received_.load(); }));
+    EXPECT_TRUE(wait_for([&] { return 1u == pipe.drained_.load(); }));
+
+    pipe.Signal();
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    EXPECT_EQ(pipe.received_.load(), 1u);
+}
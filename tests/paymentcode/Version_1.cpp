@@ -4,13 +4,16 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <vector>
 
+#include "1_Internal.hpp"  // IWYU pragma: keep
 #include "Helpers.hpp"
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
 #include "VectorsV1.hpp"
+#include "internal/core/Core.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Factory.hpp"
@@ -101,6 +104,61 @@ TEST_F(Test_PaymentCode_v1, incoming)
     }
 }
 
+TEST_F(Test_PaymentCode_v1, outgoing_batch)
+{
+    constexpr auto count = std::size_t{64};
+    const auto& pc =
+        dynamic_cast<const ot::internal::PaymentCode&>(alice_pc_secret_);
+    const auto keys = pc.OutgoingBatch(
+        bob_pc_public_, 0, count, chain_, reason_, version_);
+
+    ASSERT_EQ(keys.size(), count);
+
+    for (auto i = ot::Bip32Index{0}; i < count; ++i) {
+        const auto& pBatch = keys.at(i);
+        const auto pKey = alice_pc_secret_.Outgoing(
+            bob_pc_public_, i, chain_, reason_, version_);
+
+        ASSERT_TRUE(pBatch);
+        ASSERT_TRUE(pKey);
+        EXPECT_EQ(pBatch->PublicKey(), pKey->PublicKey());
+    }
+
+    for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
+        EXPECT_EQ(
+            KeyToAddress(*keys.at(i)),
+            vectors_1_.bob_.receiving_address_.at(i));
+    }
+}
+
+TEST_F(Test_PaymentCode_v1, incoming_batch)
+{
+    constexpr auto count = std::size_t{64};
+    const auto& pc =
+        dynamic_cast<const ot::internal::PaymentCode&>(bob_pc_secret_);
+    const auto keys = pc.IncomingBatch(
+        alice_pc_public_, 0, count, chain_, reason_, version_);
+
+    ASSERT_EQ(keys.size(), count);
+
+    for (auto i = ot::Bip32Index{0}; i < count; ++i) {
+        const auto& pBatch = keys.at(i);
+        const auto pKey = bob_pc_secret_.Incoming(
+            alice_pc_public_, i, chain_, reason_, version_);
+
+        ASSERT_TRUE(pBatch);
+        ASSERT_TRUE(pKey);
+        EXPECT_EQ(pBatch->PublicKey(), pKey->PublicKey());
+        EXPECT_EQ(pBatch->PrivateKey(reason_), pKey->PrivateKey(reason_));
+    }
+
+    for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
+        EXPECT_EQ(
+            KeyToAddress(*keys.at(i)),
+            vectors_1_.bob_.receiving_address_.at(i));
+    }
+}
+
 TEST_F(Test_PaymentCode_v1, blind)
 {
     const auto outpoint =
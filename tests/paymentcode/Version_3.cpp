@@ -10,9 +10,11 @@
 #include <string>
 #include <vector>
 
+#include "1_Internal.hpp"  // IWYU pragma: keep
 #include "Helpers.hpp"
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
 #include "VectorsV3.hpp"
+#include "internal/core/Core.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
@@ -210,6 +212,65 @@ TEST_F(Test_PaymentCode_v3, incoming_testnet)
     }
 }
 
+TEST_F(Test_PaymentCode_v3, outgoing_batch)
+{
+    constexpr auto count = std::size_t{64};
+    const auto chain = vectors_3_.alice_.receive_chain_;
+    const auto& pc =
+        dynamic_cast<const ot::internal::PaymentCode&>(bob_pc_secret_);
+    const auto keys = pc.OutgoingBatch(
+        alice_pc_public_, 0, count, chain, reason_, version_);
+
+    ASSERT_EQ(keys.size(), count);
+
+    for (auto i = ot::Bip32Index{0}; i < count; ++i) {
+        const auto& pBatch = keys.at(i);
+        const auto pKey = bob_pc_secret_.Outgoing(
+            alice_pc_public_, i, chain, reason_, version_);
+
+        ASSERT_TRUE(pBatch);
+        ASSERT_TRUE(pKey);
+        EXPECT_EQ(pBatch->PublicKey(), pKey->PublicKey());
+    }
+
+    for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
+        const auto expect = api_.Factory().Data(
+            vectors_3_.alice_.receive_keys_.at(i), ot::StringStyle::Hex);
+
+        EXPECT_EQ(expect->Bytes(), keys.at(i)->PublicKey());
+    }
+}
+
+TEST_F(Test_PaymentCode_v3, incoming_batch)
+{
+    constexpr auto count = std::size_t{64};
+    const auto chain = vectors_3_.alice_.receive_chain_;
+    const auto& pc =
+        dynamic_cast<const ot::internal::PaymentCode&>(alice_pc_secret_);
+    const auto keys = pc.IncomingBatch(
+        bob_pc_public_, 0, count, chain, reason_, version_);
+
+    ASSERT_EQ(keys.size(), count);
+
+    for (auto i = ot::Bip32Index{0}; i < count; ++i) {
+        const auto& pBatch = keys.at(i);
+        const auto pKey = alice_pc_secret_.Incoming(
+            bob_pc_public_, i, chain, reason_, version_);
+
+        ASSERT_TRUE(pBatch);
+        ASSERT_TRUE(pKey);
+        EXPECT_EQ(pBatch->PublicKey(), pKey->PublicKey());
+        EXPECT_EQ(pBatch->PrivateKey(reason_), pKey->PrivateKey(reason_));
+    }
+
+    for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
+        const auto expect = api_.Factory().Data(
+            vectors_3_.alice_.receive_keys_.at(i), ot::StringStyle::Hex);
+
+        EXPECT_EQ(expect->Bytes(), keys.at(i)->PublicKey());
+    }
+}
+
 TEST_F(Test_PaymentCode_v3, avoid_cross_chain_address_reuse)
 {
     for (auto i = ot::Bip32Index{0}; i < 10u; ++i) {
@@ -0,0 +1,130 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/protobuf/StorageItemHash.pb.h"
+#include "opentxs/protobuf/StorageNymList.pb.h"
+#include "storage/ObjectCache.hpp"
+
+namespace ot = opentxs;
+
+namespace
+{
+using Cache = ot::storage::ObjectCache;
+using Item = ot::proto::StorageItemHash;
+using List = ot::proto::StorageNymList;
+
+constexpr auto object_size_{std::size_t{100}};
+
+auto item(const std::string& id) -> std::shared_ptr<const Item>
+{
+    auto output = std::make_shared<Item>();
+    output->set_version(1);
+    output->set_itemid(id);
+
+    return output;
+}
+}  // namespace
+
+TEST(ObjectCache, hit_shares_the_stored_object)
+{
+    const auto cache = Cache{10 * object_size_};
+    const auto object = item("alice");
+    cache.Store<Item>("hash", object, object_size_);
+    const auto first = cache.Load<Item>("hash");
+    const auto second = cache.Load<Item>("hash");
+
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first.get(), object.get());
+    EXPECT_EQ(second.get(), object.get());
+    EXPECT_EQ(first->itemid(), "alice");
+}
+
+TEST(ObjectCache, miss)
+{
+    const auto cache = Cache{10 * object_size_};
+
+    EXPECT_FALSE(cache.Load<Item>("hash"));
+}
+
+TEST(ObjectCache, type_mismatch_is_a_miss)
+{
+    const auto cache = Cache{10 * object_size_};
+    cache.Store<Item>("hash", item("alice"), object_size_);
+
+    EXPECT_FALSE(cache.Load<List>("hash"));
+    EXPECT_TRUE(cache.Load<Item>("hash"));
+}
+
+TEST(ObjectCache, modified_object_is_found_under_its_new_hash)
+{
+    // Modifying an object changes its content hash, which is how stale
+    // entries are invalidated
+    const auto cache = Cache{10 * object_size_};
+    cache.Store<Item>("old", item("alice"), object_size_);
+    cache.Store<Item>("new", item("bob"), object_size_);
+    const auto before = cache.Load<Item>("old");
+    const auto after = cache.Load<Item>("new");
+
+    ASSERT_TRUE(before);
+    ASSERT_TRUE(after);
+    EXPECT_EQ(before->itemid(), "alice");
+    EXPECT_EQ(after->itemid(), "bob");
+}
+
+TEST(ObjectCache, existing_entry_is_not_replaced)
+{
+    const auto cache = Cache{10 * object_size_};
+    const auto original = item("alice");
+    cache.Store<Item>("hash", original, object_size_);
+    cache.Store<Item>("hash", item("bob"), object_size_);
+
+    EXPECT_EQ(cache.Load<Item>("hash").get(), original.get());
+}
+
+TEST(ObjectCache, least_recently_used_entry_is_evicted)
+{
+    const auto cache = Cache{3 * object_size_};
+    cache.Store<Item>("a", item("a"), object_size_);
+    cache.Store<Item>("b", item("b"), object_size_);
+    cache.Store<Item>("c", item("c"), object_size_);
+
+    // Using a makes b the least recently used entry
+    EXPECT_TRUE(cache.Load<Item>("a"));
+
+    cache.Store<Item>("d", item("d"), object_size_);
+
+    EXPECT_TRUE(cache.Load<Item>("a"));
+    EXPECT_FALSE(cache.Load<Item>("b"));
+    EXPECT_TRUE(cache.Load<Item>("c"));
+    EXPECT_TRUE(cache.Load<Item>("d"));
+}
+
+TEST(ObjectCache, evicted_object_remains_valid_for_holders)
+{
+    const auto cache = Cache{object_size_};
+    cache.Store<Item>("a", item("a"), object_size_);
+    const auto held = cache.Load<Item>("a");
+    cache.Store<Item>("b", item("b"), object_size_);
+
+    EXPECT_FALSE(cache.Load<Item>("a"));
+    ASSERT_TRUE(held);
+    EXPECT_EQ(held->itemid(), "a");
+}
+
+TEST(ObjectCache, oversized_object_is_not_cached)
+{
+    const auto cache = Cache{object_size_};
+    cache.Store<Item>("small", item("small"), object_size_);
+    cache.Store<Item>("large", item("large"), object_size_ + 1);
+
+    EXPECT_FALSE(cache.Load<Item>("large"));
+    EXPECT_TRUE(cache.Load<Item>("small"));
+}
@@ -0,0 +1,291 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "ui/base/Executor.hpp"
+
+namespace
+{
+using Executor = opentxs::ui::implementation::Executor;
+using Priority = Executor::Priority;
+
+constexpr auto timeout_{std::chrono::seconds{30}};
+
+auto executor() -> Executor& { return Executor::Get(); }
+
+auto wait_for(const std::function<bool()>& condition) -> bool
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    while (false == condition()) {
+        if ((std::chrono::steady_clock::now() - start) > timeout_) {
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return true;
+}
+
+// Occupies every worker with a job that waits for its own gate to open
+class Occupied
+{
+public:
+    auto Ready() noexcept -> bool
+    {
+        return wait_for([&] { return gates_.size() == started_.load(); });
+    }
+    auto Release() noexcept -> void
+    {
+        for (auto i = std::size_t{0}; i < gates_.size(); ++i) { Release(i); }
+    }
+    auto Release(const std::size_t index) noexcept -> void
+    {
+        if (false == released_.at(index)) {
+            released_.at(index) = true;
+            gates_.at(index).set_value();
+        }
+    }
+
+    Occupied(const std::size_t count)
+        : gates_(count)
+        , futures_()
+        , started_(0)
+        , released_(count, false)
+        , tasks_()
+    {
+        for (auto& gate : gates_) { futures_.emplace_back(gate.get_future()); }
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            tasks_.emplace_back(executor().Schedule([this, i] {
+                ++started_;
+                futures_.at(i).wait();
+            }));
+        }
+    }
+
+    ~Occupied()
+    {
+        Release();
+
+        for (auto& task : tasks_) { task.Stop(); }
+    }
+
+private:
+    std::vector<std::promise<void>> gates_;
+    std::vector<std::shared_future<void>> futures_;
+    std::atomic<std::size_t> started_;
+    std::vector<bool> released_;
+    std::vector<Executor::Task> tasks_;
+};
+}  // namespace
+
+TEST(Executor, higher_priority_runs_first)
+{
+    auto lock = std::mutex{};
+    auto order = std::vector<Priority>{};
+    auto occupied = Occupied{executor().Workers()};
+
+    ASSERT_TRUE(occupied.Ready());
+
+    auto background = executor().Schedule(
+        [&] {
+            auto guard = std::lock_guard<std::mutex>{lock};
+            order.emplace_back(Priority::Background);
+        },
+        Priority::Background);
+    auto normal = executor().Schedule([&] {
+        auto guard = std::lock_guard<std::mutex>{lock};
+        order.emplace_back(Priority::Normal);
+    });
+    auto visible = executor().Schedule(
+        [&] {
+            auto guard = std::lock_guard<std::mutex>{lock};
+            order.emplace_back(Priority::Visible);
+        },
+        Priority::Visible);
+
+    // Exactly one worker is released so the queued jobs run in order
+    occupied.Release(0);
+    const auto done = wait_for([&] {
+        auto guard = std::lock_guard<std::mutex>{lock};
+
+        return 3u == order.size();
+    });
+    occupied.Release();
+
+    ASSERT_TRUE(done);
+    EXPECT_EQ(order.at(0), Priority::Visible);
+    EXPECT_EQ(order.at(1), Priority::Normal);
+    EXPECT_EQ(order.at(2), Priority::Background);
+}
+
+TEST(Executor, prioritize_promotes_queued_job)
+{
+    auto lock = std::mutex{};
+    auto order = std::vector<int>{};
+    auto occupied = Occupied{executor().Workers()};
+
+    ASSERT_TRUE(occupied.Ready());
+
+    auto first = executor().Schedule([&] {
+        auto guard = std::lock_guard<std::mutex>{lock};
+        order.emplace_back(1);
+    });
+    auto second = executor().Schedule(
+        [&] {
+            auto guard = std::lock_guard<std::mutex>{lock};
+            order.emplace_back(2);
+        },
+        Priority::Background);
+    second.Prioritize(Priority::Visible);
+    occupied.Release(0);
+    const auto done = wait_for([&] {
+        auto guard = std::lock_guard<std::mutex>{lock};
+
+        return 2u == order.size();
+    });
+    occupied.Release();
+
+    ASSERT_TRUE(done);
+    EXPECT_EQ(order.at(0), 2);
+    EXPECT_EQ(order.at(1), 1);
+}
+
+TEST(Executor, stop_cancels_queued_job)
+{
+    auto ran = std::atomic<bool>{false};
+    auto after = std::atomic<bool>{false};
+    auto occupied = Occupied{executor().Workers()};
+
+    ASSERT_TRUE(occupied.Ready());
+
+    auto cancelled = executor().Schedule([&] { ran = true; });
+    cancelled.Stop();
+    auto marker = executor().Schedule([&] { after = true; });
+    occupied.Release();
+
+    ASSERT_TRUE(wait_for([&] { return after.load(); }));
+
+    // A stopped task can not be triggered again
+    cancelled.Trigger(Priority::Visible);
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+
+    EXPECT_FALSE(ran.load());
+}
+
+TEST(Executor, trigger_while_running_runs_again)
+{
+    auto runs = std::atomic<int>{0};
+    auto entered = std::promise<void>{};
+    auto gate = std::promise<void>{};
+    auto future = gate.get_future().share();
+    auto task = executor().Prepare([&] {
+        if (1 == ++runs) {
+            entered.set_value();
+            future.wait();
+        }
+    });
+
+    EXPECT_EQ(runs.load(), 0);
+
+    task.Trigger(Priority::Normal);
+
+    ASSERT_EQ(
+        entered.get_future().wait_for(timeout_), std::future_status::ready);
+
+    // Both triggers made while the job is running collapse into one run
+    task.Trigger(Priority::Normal);
+    task.Trigger(Priority::Visible);
+    gate.set_value();
+
+    ASSERT_TRUE(wait_for([&] { return 2 == runs.load(); }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+
+    EXPECT_EQ(runs.load(), 2);
+
+    task.Stop();
+}
+
+TEST(Executor, blocking_jobs_do_not_starve_other_jobs)
+{
+    const auto workers = executor().Workers();
+    const auto count = workers + 1u;
+    auto started = std::atomic<std::size_t>{0};
+    auto ran = std::atomic<bool>{false};
+    auto gate = std::promise<void>{};
+    auto future = gate.get_future().share();
+    auto blocking = std::vector<Executor::Task>{};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        blocking.emplace_back(executor().Schedule(
+            [&] {
+                ++started;
+                future.wait();
+            },
+            Priority::Visible,
+            true));
+    }
+
+    ASSERT_TRUE(wait_for([&] { return count == started.load(); }));
+
+    auto other = executor().Schedule([&] { ran = true; });
+    const auto progress = wait_for([&] { return ran.load(); });
+    gate.set_value();
+
+    EXPECT_TRUE(progress);
+
+    // Spare threads exit once the blocking jobs have finished
+    EXPECT_TRUE(wait_for([&] { return workers == executor().Workers(); }));
+
+    for (auto& task : blocking) { task.Stop(); }
+}
+
+TEST(Executor, spare_threads_are_limited)
+{
+    const auto workers = executor().Workers();
+    const auto limit = workers + Executor::MaximumSpares;
+    const auto count = limit + 2u;
+    auto started = std::atomic<std::size_t>{0};
+    auto gate = std::promise<void>{};
+    auto future = gate.get_future().share();
+    auto blocking = std::vector<Executor::Task>{};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        blocking.emplace_back(executor().Schedule(
+            [&] {
+                ++started;
+                future.wait();
+            },
+            Priority::Visible,
+            true));
+    }
+
+    ASSERT_TRUE(wait_for([&] { return limit == started.load(); }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    EXPECT_EQ(started.load(), limit);
+    EXPECT_EQ(executor().Workers(), limit);
+
+    gate.set_value();
+
+    EXPECT_TRUE(wait_for([&] { return count == started.load(); }));
+    EXPECT_TRUE(wait_for([&] { return workers == executor().Workers(); }));
+
+    for (auto& task : blocking) { task.Stop(); }
+}
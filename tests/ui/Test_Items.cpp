@@ -4,10 +4,12 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstddef>
 #include <list>
 #include <memory>
 #include <optional>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -490,4 +492,50 @@ TEST(UI_items, reverse_sort)
     EXPECT_TRUE(test_row(items, 4, vector_.at(1)));
     EXPECT_TRUE(test_row(items, 5, vector_.at(0)));
 }
+
+TEST(UI_items, many_rows)
+{
+    constexpr auto count = ID{1000};
+    auto items = Type{false};
+    auto ids = std::vector<ID>{};
+
+    for (auto i = ID{0}; i < count; ++i) { ids.emplace_back(i); }
+
+    std::shuffle(ids.begin(), ids.end(), std::mt19937{});
+
+    for (const auto id : ids) {
+        const auto key = std::to_string(count + id);
+        const auto [it, index] = items.find_insert_position(key, id);
+        items.insert_before(it, key, id, std::make_shared<Value>(key));
+    }
+
+    ASSERT_EQ(items.size(), static_cast<std::size_t>(count));
+
+    for (auto i = ID{0}; i < count; ++i) {
+        const auto key = std::to_string(count + i);
+
+        EXPECT_TRUE(
+            test_row(items, static_cast<std::size_t>(i), {key, i, key}));
+    }
+
+    auto expected = ID{0};
+
+    for (const auto& row : items) { EXPECT_EQ(row.id_, expected++); }
+
+    const auto& id = ids.front();
+    const auto key = std::to_string(count - 1);
+    auto move = items.find_move_position(id, key, id);
+
+    ASSERT_TRUE(move);
+
+    auto& [before, after] = move.value();
+
+    EXPECT_EQ(before.second, static_cast<std::size_t>(id));
+    EXPECT_EQ(after.second, 0);
+
+    items.move_before(id, before.first, key, id, after.first);
+
+    EXPECT_EQ(items.get_index(id).value_or(count), 0);
+    EXPECT_EQ(items.size(), static_cast<std::size_t>(count));
+}
 }  // namespace
@@ -0,0 +1,179 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "1_Internal.hpp"
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/api/client/Client.hpp"
+#include "internal/ui/UI.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "ui/contactlist/ContactList.hpp"
+
+namespace
+{
+constexpr auto timeout_{std::chrono::seconds{30}};
+constexpr auto total_{std::size_t{250}};
+
+auto key(const std::size_t i) -> std::string
+{
+    return std::to_string(1000 + i);
+}
+
+auto wait_for(const std::function<bool()>& condition) -> bool
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    while (false == condition()) {
+        if ((std::chrono::steady_clock::now() - start) > timeout_) {
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return true;
+}
+
+struct Row final : public ot::ui::internal::blank::ContactListItem {
+    const std::string key_;
+
+    Row(const std::string& key) noexcept
+        : key_(key)
+    {
+    }
+};
+
+/// A list whose rows are all unloaded until pages are requested
+class PagedList final : public ot::ui::implementation::ContactListList
+{
+public:
+    auto AddContact(const std::string&, const std::string&, const std::string&)
+        const noexcept -> std::string final
+    {
+        return {};
+    }
+    auto ID() const noexcept -> const ot::Identifier& final { return id_; }
+    auto Keys() const noexcept -> std::vector<std::string>
+    {
+        auto output = std::vector<std::string>{};
+        for_each_row([&](const auto& row) {
+            output.emplace_back(dynamic_cast<const Row&>(row).key_);
+        });
+
+        return output;
+    }
+    auto Rows() const noexcept -> std::size_t { return size(); }
+
+    PagedList(
+        const ot::api::client::internal::Manager& api,
+        const ot::identifier::Nym& nym) noexcept
+        : ContactListList(api, nym, ot::SimpleCallback{})
+        , id_(ot::Identifier::Random())
+        , lock_()
+        , pending_()
+    {
+        for (auto i = std::size_t{0}; i < total_; ++i) {
+            pending_.emplace_back(key(i));
+        }
+
+        finish_startup();
+    }
+
+    ~PagedList() final { fetch_.Stop(); }
+
+private:
+    const ot::OTIdentifier id_;
+    mutable std::mutex lock_;
+    // Sorted oldest first
+    std::vector<std::string> pending_;
+
+    auto construct_row(
+        const ot::ui::implementation::ContactListRowID&,
+        const ot::ui::implementation::ContactListSortKey& index,
+        ot::ui::implementation::CustomData&) const noexcept
+        -> RowPointer final
+    {
+        return std::make_shared<Row>(index);
+    }
+    auto unloaded() const noexcept -> std::size_t final
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        return pending_.size();
+    }
+
+    auto load_page(const std::size_t count) noexcept
+        -> std::vector<ItemData> final
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+        auto output = std::vector<ItemData>{};
+
+        while ((output.size() < count) && (false == pending_.empty())) {
+            output.emplace_back(
+                ot::Identifier::Random(),
+                pending_.back(),
+                ot::ui::implementation::CustomData{});
+            pending_.pop_back();
+        }
+
+        return output;
+    }
+};
+
+TEST(ListPaging, pages_are_loaded_newest_first)
+{
+    const auto& api = dynamic_cast<const ot::api::client::internal::Manager&>(
+        ot::Context().StartClient(OTTestEnvironment::Args(), 0));
+    auto list = PagedList{api, api.Factory().NymID()};
+    const auto all = [] {
+        auto out = std::vector<std::string>{};
+
+        for (auto i = std::size_t{0}; i < total_; ++i) {
+            out.emplace_back(key(i));
+        }
+
+        return out;
+    }();
+
+    EXPECT_EQ(list.Rows(), 0u);
+    EXPECT_TRUE(list.CanFetchMore());
+
+    for (const auto loaded : {100u, 200u, 250u}) {
+        list.FetchMore();
+
+        ASSERT_TRUE(wait_for([&] { return list.Rows() == loaded; }));
+
+        const auto keys = list.Keys();
+
+        EXPECT_TRUE(std::equal(
+            std::prev(all.end(), loaded), all.end(), keys.begin(), keys.end()));
+    }
+
+    EXPECT_FALSE(list.CanFetchMore());
+
+    list.FetchMore();
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    EXPECT_EQ(list.Rows(), total_);
+    EXPECT_EQ(list.Keys(), all);
+}
+}  // namespace